@@ -1,6 +1,13 @@
 #ifndef OPEN_STL_ALGORITHM_H_
 #define OPEN_STL_ALGORITHM_H_
 
+#include <OpenSTL/functional.h>
+#include <OpenSTL/internal/iterator.h>
+#include <OpenSTL/type_traits.h>
+#include <OpenSTL/utility.h>
+
+#include <cstddef>
+
 namespace open_stl {
 
 /*
@@ -24,8 +31,10 @@ namespace open_stl {
    ranges.
 */
 template <typename InputIterator>
-bool lexicographical_compare(InputIterator lhs_begin, InputIterator lhs_end,
-                             InputIterator rhs_begin, InputIterator rhs_end) {
+constexpr bool lexicographical_compare(InputIterator lhs_begin,
+                                       InputIterator lhs_end,
+                                       InputIterator rhs_begin,
+                                       InputIterator rhs_end) {
   while (lhs_begin != lhs_end && rhs_begin != rhs_end) {
     if (*lhs_begin < *rhs_begin) {
       return true;
@@ -65,8 +74,8 @@ bool lexicographical_compare(InputIterator lhs_begin, InputIterator lhs_end,
    returns true. Otherwise, it returns false.
 */
 template <typename InputIterator>
-bool equal(InputIterator lhs_begin, InputIterator lhs_end,
-           InputIterator rhs_begin, InputIterator rhs_end) {
+constexpr bool equal(InputIterator lhs_begin, InputIterator lhs_end,
+                     InputIterator rhs_begin, InputIterator rhs_end) {
   while (lhs_begin != lhs_end && rhs_begin != rhs_end) {
     if (*lhs_begin != *rhs_begin) {
       return false;
@@ -81,6 +90,784 @@ bool equal(InputIterator lhs_begin, InputIterator lhs_end,
   }
 }
 
+/*
+    Finds the first element of a sorted range that is not less than a value.
+
+    Template Parameters:
+        - ForwardIterator: The type of iterator for the range.
+        - T: The type of the value searched for.
+        - Compare: The ordering the range is sorted by.
+
+    Parameters:
+        - first: The beginning of the range.
+        - last: The end of the range.
+        - value: The value to search for.
+        - comp: Returns true if its first argument is ordered before its
+   second.
+
+    Returns:
+        - An iterator to the first element x with !comp(x, value), or `last`
+   if there is none.
+
+    For random-access iterators the search is branchless: every step halves
+   the remaining length unconditionally and only the base moves, so the loop
+   runs a fixed ceil(log2(n)) times and the comparison becomes a conditional
+   move instead of a hard-to-predict branch.
+*/
+template <typename ForwardIterator, typename T, typename Compare>
+constexpr ForwardIterator lower_bound(ForwardIterator first,
+                                      ForwardIterator last, const T &value,
+                                      Compare comp) {
+  if constexpr (internal::is_random_access_iterator<ForwardIterator>::value) {
+    auto length = last - first;
+    if (length == 0) return first;
+    while (length > 1) {
+      auto half = length / 2;
+      first = comp(first[half], value) ? first + half : first;
+      length -= half;
+    }
+    return first + comp(*first, value);
+  } else {
+    std::ptrdiff_t length = internal::distance(first, last);
+    while (length > 0) {
+      std::ptrdiff_t half = length / 2;
+      ForwardIterator middle = first;
+      internal::advance(middle, half);
+      if (comp(*middle, value)) {
+        first = ++middle;
+        length -= half + 1;
+      } else {
+        length = half;
+      }
+    }
+    return first;
+  }
+}
+
+// Finds the first element of a sorted range that is not less than a value,
+// comparing with operator<.
+template <typename ForwardIterator, typename T>
+constexpr ForwardIterator lower_bound(ForwardIterator first,
+                                      ForwardIterator last, const T &value) {
+  return open_stl::lower_bound(first, last, value, less<>());
+}
+
+/*
+    Finds the first element of a sorted range that is greater than a value.
+
+    Template Parameters:
+        - ForwardIterator: The type of iterator for the range.
+        - T: The type of the value searched for.
+        - Compare: The ordering the range is sorted by.
+
+    Parameters:
+        - first: The beginning of the range.
+        - last: The end of the range.
+        - value: The value to search for.
+        - comp: Returns true if its first argument is ordered before its
+   second.
+
+    Returns:
+        - An iterator to the first element x with comp(value, x), or `last`
+   if there is none.
+
+    Uses the same branchless halving as lower_bound for random-access
+   iterators.
+*/
+template <typename ForwardIterator, typename T, typename Compare>
+constexpr ForwardIterator upper_bound(ForwardIterator first,
+                                      ForwardIterator last, const T &value,
+                                      Compare comp) {
+  if constexpr (internal::is_random_access_iterator<ForwardIterator>::value) {
+    auto length = last - first;
+    if (length == 0) return first;
+    while (length > 1) {
+      auto half = length / 2;
+      first = !comp(value, first[half]) ? first + half : first;
+      length -= half;
+    }
+    return first + !comp(value, *first);
+  } else {
+    std::ptrdiff_t length = internal::distance(first, last);
+    while (length > 0) {
+      std::ptrdiff_t half = length / 2;
+      ForwardIterator middle = first;
+      internal::advance(middle, half);
+      if (!comp(value, *middle)) {
+        first = ++middle;
+        length -= half + 1;
+      } else {
+        length = half;
+      }
+    }
+    return first;
+  }
+}
+
+// Finds the first element of a sorted range that is greater than a value,
+// comparing with operator<.
+template <typename ForwardIterator, typename T>
+constexpr ForwardIterator upper_bound(ForwardIterator first,
+                                      ForwardIterator last, const T &value) {
+  return open_stl::upper_bound(first, last, value, less<>());
+}
+
+/*
+    Finds the subrange of a sorted range whose elements are equivalent to a
+   value.
+
+    Template Parameters:
+        - ForwardIterator: The type of iterator for the range.
+        - T: The type of the value searched for.
+        - Compare: The ordering the range is sorted by.
+
+    Parameters:
+        - first: The beginning of the range.
+        - last: The end of the range.
+        - value: The value to search for.
+        - comp: Returns true if its first argument is ordered before its
+   second.
+
+    Returns:
+        - A pair holding lower_bound and upper_bound of `value`.
+
+    The upper bound is searched for only in the part of the range at or after
+   the lower bound.
+*/
+template <typename ForwardIterator, typename T, typename Compare>
+constexpr pair<ForwardIterator, ForwardIterator> equal_range(
+    ForwardIterator first, ForwardIterator last, const T &value, Compare comp) {
+  ForwardIterator lower = open_stl::lower_bound(first, last, value, comp);
+  return pair<ForwardIterator, ForwardIterator>(
+      lower, open_stl::upper_bound(lower, last, value, comp));
+}
+
+// Finds the subrange of a sorted range whose elements are equal to a value,
+// comparing with operator<.
+template <typename ForwardIterator, typename T>
+constexpr pair<ForwardIterator, ForwardIterator> equal_range(
+    ForwardIterator first, ForwardIterator last, const T &value) {
+  return open_stl::equal_range(first, last, value, less<>());
+}
+
+/*
+    Checks whether a sorted range contains an element equivalent to a value.
+
+    Template Parameters:
+        - ForwardIterator: The type of iterator for the range.
+        - T: The type of the value searched for.
+        - Compare: The ordering the range is sorted by.
+
+    Parameters:
+        - first: The beginning of the range.
+        - last: The end of the range.
+        - value: The value to search for.
+        - comp: Returns true if its first argument is ordered before its
+   second.
+
+    Returns:
+        - True if an element equivalent to `value` exists, false otherwise.
+*/
+template <typename ForwardIterator, typename T, typename Compare>
+constexpr bool binary_search(ForwardIterator first, ForwardIterator last,
+                             const T &value, Compare comp) {
+  first = open_stl::lower_bound(first, last, value, comp);
+  return first != last && !comp(value, *first);
+}
+
+// Checks whether a sorted range contains a value, comparing with operator<.
+template <typename ForwardIterator, typename T>
+constexpr bool binary_search(ForwardIterator first, ForwardIterator last,
+                             const T &value) {
+  return open_stl::binary_search(first, last, value, less<>());
+}
+
+namespace internal {
+
+/*
+    Restores the heap property below a hole in a max-heap.
+
+    Template Parameters:
+        - Arity: The number of children of every node; 2 for a binary heap.
+        - RandomIterator: The type of iterator for the heap.
+        - Compare: The ordering of the heap; the largest element is on top.
+
+    Parameters:
+        - first: The beginning of the heap.
+        - hole: The index whose value may be smaller than its children.
+        - length: The number of elements in the heap.
+        - comp: Returns true if its first argument is ordered before its
+   second.
+
+    The value at `hole` is lifted out once and the largest child is moved up
+   into the hole until the value fits, so each level costs one move instead
+   of a swap. The children of node i are Arity * i + 1 through
+   Arity * i + Arity.
+*/
+template <std::ptrdiff_t Arity = 2, typename RandomIterator, typename Compare>
+constexpr void sift_down(RandomIterator first, std::ptrdiff_t hole,
+                         std::ptrdiff_t length, Compare comp) {
+  remove_cvref_t<decltype(*first)> value = move(first[hole]);
+  while (true) {
+    std::ptrdiff_t child = Arity * hole + 1;
+    if (child >= length) break;
+    std::ptrdiff_t last_child = child + Arity < length ? child + Arity : length;
+    for (std::ptrdiff_t sibling = child + 1; sibling < last_child; sibling++) {
+      if (comp(first[child], first[sibling])) child = sibling;
+    }
+    if (!comp(value, first[child])) break;
+    first[hole] = move(first[child]);
+    hole = child;
+  }
+  first[hole] = move(value);
+}
+
+// Moves the value at `hole` up a max-heap of the given arity until its
+// parent is not ordered before it.
+template <std::ptrdiff_t Arity = 2, typename RandomIterator, typename Compare>
+constexpr void sift_up(RandomIterator first, std::ptrdiff_t hole,
+                       Compare comp) {
+  remove_cvref_t<decltype(*first)> value = move(first[hole]);
+  while (hole > 0) {
+    std::ptrdiff_t parent = (hole - 1) / Arity;
+    if (!comp(first[parent], value)) break;
+    first[hole] = move(first[parent]);
+    hole = parent;
+  }
+  first[hole] = move(value);
+}
+
+// Arranges [first, last) into a max-heap of the given arity under `comp`,
+// in O(n).
+template <std::ptrdiff_t Arity = 2, typename RandomIterator, typename Compare>
+constexpr void make_heap(RandomIterator first, RandomIterator last,
+                         Compare comp) {
+  std::ptrdiff_t length = last - first;
+  if (length < 2) return;
+  for (std::ptrdiff_t hole = (length - 2) / Arity; hole >= 0; hole--) {
+    internal::sift_down<Arity>(first, hole, length, comp);
+  }
+}
+
+// Turns the max-heap [first, last) into a range sorted under `comp`.
+template <typename RandomIterator, typename Compare>
+constexpr void sort_heap(RandomIterator first, RandomIterator last,
+                         Compare comp) {
+  for (std::ptrdiff_t length = last - first; length > 1; length--) {
+    open_stl::swap(first[0], first[length - 1]);
+    internal::sift_down(first, 0, length - 1, comp);
+  }
+}
+
+// Sorts [first, last) by insertion; the fastest choice for a handful of
+// elements.
+template <typename RandomIterator, typename Compare>
+constexpr void insertion_sort(RandomIterator first, RandomIterator last,
+                              Compare comp) {
+  if (first == last) return;
+  for (RandomIterator it = first + 1; it < last; ++it) {
+    remove_cvref_t<decltype(*first)> value = move(*it);
+    RandomIterator hole = it;
+    for (; hole > first && comp(value, *(hole - 1)); --hole) {
+      *hole = move(*(hole - 1));
+    }
+    *hole = move(value);
+  }
+}
+
+// Moves the median of *a, *b and *c under `comp` into *a.
+template <typename RandomIterator, typename Compare>
+constexpr void median_of_three_to_front(RandomIterator a, RandomIterator b,
+                                        RandomIterator c, Compare comp) {
+  if (comp(*b, *a)) open_stl::swap(*a, *b);
+  if (comp(*c, *b)) {
+    open_stl::swap(*b, *c);
+    if (comp(*b, *a)) open_stl::swap(*a, *b);
+  }
+  open_stl::swap(*a, *b);
+}
+
+/*
+    Partitions [first, last) around the pivot stored at *first.
+
+    Returns:
+        - The final position of the pivot. Everything before it is not
+   ordered after the pivot, everything after it is not ordered before it.
+
+    Elements equivalent to the pivot stop both scans and are swapped, so a
+   range full of duplicates is still split down the middle.
+*/
+template <typename RandomIterator, typename Compare>
+constexpr RandomIterator partition_around_first(RandomIterator first,
+                                                RandomIterator last,
+                                                Compare comp) {
+  RandomIterator lo = first + 1;
+  RandomIterator hi = last - 1;
+  while (true) {
+    while (lo <= hi && comp(*lo, *first)) ++lo;
+    while (lo <= hi && comp(*first, *hi)) --hi;
+    if (lo >= hi) break;
+    open_stl::swap(*lo, *hi);
+    ++lo;
+    --hi;
+  }
+  open_stl::swap(*first, *hi);
+  return hi;
+}
+
+// Ranges at most this long are finished with insertion sort.
+inline constexpr std::ptrdiff_t insertion_sort_threshold = 16;
+
+template <typename RandomIterator, typename Compare>
+constexpr void introselect(RandomIterator first, RandomIterator nth,
+                           RandomIterator last, Compare comp, int depth_limit);
+
+/*
+    Moves a pivot that is guaranteed to split [first, last) no worse than
+   30/70 into *first.
+
+    The range is cut into groups of five, the median of every group is
+   moved to the front, and the median of those medians is selected
+   recursively. This keeps introselect linear even on adversarial input.
+*/
+template <typename RandomIterator, typename Compare>
+constexpr void median_of_medians_to_front(RandomIterator first,
+                                          RandomIterator last, Compare comp) {
+  std::ptrdiff_t groups = (last - first) / 5;
+  for (std::ptrdiff_t group = 0; group < groups; group++) {
+    RandomIterator start = first + 5 * group;
+    internal::insertion_sort(start, start + 5, comp);
+    open_stl::swap(first[group], start[2]);
+  }
+  RandomIterator median = first + groups / 2;
+  internal::introselect(first, median, first + groups, comp, 0);
+  open_stl::swap(*first, *median);
+}
+
+/*
+    Partially sorts [first, last) so that *nth holds the element that would
+   be there if the whole range were sorted.
+
+    Each step partitions around a median-of-three pivot and keeps only the
+   side holding nth. Once `depth_limit` partitions have been spent the
+   pivots come from median_of_medians_to_front instead, which bounds the
+   worst case at linear time.
+*/
+template <typename RandomIterator, typename Compare>
+constexpr void introselect(RandomIterator first, RandomIterator nth,
+                           RandomIterator last, Compare comp, int depth_limit) {
+  while (last - first > insertion_sort_threshold) {
+    if (depth_limit == 0) {
+      internal::median_of_medians_to_front(first, last, comp);
+    } else {
+      depth_limit--;
+      internal::median_of_three_to_front(first, first + (last - first) / 2,
+                                         last - 1, comp);
+    }
+    RandomIterator cut =
+        internal::partition_around_first(first, last, comp);
+    if (cut == nth) return;
+    if (nth < cut) {
+      last = cut;
+    } else {
+      first = cut + 1;
+    }
+  }
+  internal::insertion_sort(first, last, comp);
+}
+
+/*
+    Sorts [first, last) with an introsort.
+
+    Each step partitions around a median-of-three pivot, recurses into the
+   smaller side and loops on the larger one, so the stack depth stays
+   logarithmic. Once `depth_limit` partitions have been spent on a range it
+   is heap sorted instead, which bounds the worst case at O(n log n). Short
+   ranges are finished with insertion sort.
+*/
+template <typename RandomIterator, typename Compare>
+constexpr void introsort(RandomIterator first, RandomIterator last,
+                         Compare comp, int depth_limit) {
+  while (last - first > insertion_sort_threshold) {
+    if (depth_limit == 0) {
+      internal::make_heap(first, last, comp);
+      internal::sort_heap(first, last, comp);
+      return;
+    }
+    depth_limit--;
+    internal::median_of_three_to_front(first, first + (last - first) / 2,
+                                       last - 1, comp);
+    RandomIterator cut =
+        internal::partition_around_first(first, last, comp);
+    if (cut - first < last - cut) {
+      internal::introsort(first, cut, comp, depth_limit);
+      first = cut + 1;
+    } else {
+      internal::introsort(cut + 1, last, comp, depth_limit);
+      last = cut;
+    }
+  }
+  internal::insertion_sort(first, last, comp);
+}
+
+// Returns floor(log2(n)) for n >= 1.
+constexpr int log2_floor(std::ptrdiff_t n) {
+  int log = 0;
+  while (n > 1) {
+    n >>= 1;
+    log++;
+  }
+  return log;
+}
+
+}  // namespace internal
+
+/*
+    Adds the element at `last - 1` to the max-heap [first, last - 1).
+
+    Template Parameters:
+        - RandomIterator: The type of iterator for the heap.
+        - Compare: The ordering of the heap; the largest element is on top.
+
+    Parameters:
+        - first: The beginning of the heap.
+        - last: The end of the heap, including the new element.
+        - comp: Returns true if its first argument is ordered before its
+   second.
+
+    Runs in O(log n). The heap functions use the binary layout of
+   std::push_heap, so a heap built by either library is valid for the
+   other; priority_queue uses wider nodes.
+*/
+template <typename RandomIterator, typename Compare>
+constexpr void push_heap(RandomIterator first, RandomIterator last,
+                         Compare comp) {
+  if (last - first > 1) internal::sift_up(first, last - first - 1, comp);
+}
+
+// Adds the element at `last - 1` to a max-heap, comparing with operator<.
+template <typename RandomIterator>
+constexpr void push_heap(RandomIterator first, RandomIterator last) {
+  open_stl::push_heap(first, last, less<>());
+}
+
+// Moves the largest element of the max-heap [first, last) to `last - 1` and
+// makes [first, last - 1) a heap again, in O(log n).
+template <typename RandomIterator, typename Compare>
+constexpr void pop_heap(RandomIterator first, RandomIterator last,
+                        Compare comp) {
+  std::ptrdiff_t length = last - first;
+  if (length < 2) return;
+  open_stl::swap(first[0], first[length - 1]);
+  internal::sift_down(first, 0, length - 1, comp);
+}
+
+// Moves the largest element of a max-heap to its end, comparing with
+// operator<.
+template <typename RandomIterator>
+constexpr void pop_heap(RandomIterator first, RandomIterator last) {
+  open_stl::pop_heap(first, last, less<>());
+}
+
+// Arranges [first, last) into a max-heap under `comp`, in O(n).
+template <typename RandomIterator, typename Compare>
+constexpr void make_heap(RandomIterator first, RandomIterator last,
+                         Compare comp) {
+  internal::make_heap(first, last, comp);
+}
+
+// Arranges [first, last) into a max-heap, comparing with operator<.
+template <typename RandomIterator>
+constexpr void make_heap(RandomIterator first, RandomIterator last) {
+  internal::make_heap(first, last, less<>());
+}
+
+// Turns the max-heap [first, last) into a range sorted under `comp`.
+template <typename RandomIterator, typename Compare>
+constexpr void sort_heap(RandomIterator first, RandomIterator last,
+                         Compare comp) {
+  internal::sort_heap(first, last, comp);
+}
+
+// Turns a max-heap into an ascending range, comparing with operator<.
+template <typename RandomIterator>
+constexpr void sort_heap(RandomIterator first, RandomIterator last) {
+  internal::sort_heap(first, last, less<>());
+}
+
+// Checks whether [first, last) is a max-heap under `comp`.
+template <typename RandomIterator, typename Compare>
+constexpr bool is_heap(RandomIterator first, RandomIterator last,
+                       Compare comp) {
+  std::ptrdiff_t length = last - first;
+  for (std::ptrdiff_t child = 1; child < length; child++) {
+    if (comp(first[(child - 1) / 2], first[child])) return false;
+  }
+  return true;
+}
+
+// Checks whether [first, last) is a max-heap, comparing with operator<.
+template <typename RandomIterator>
+constexpr bool is_heap(RandomIterator first, RandomIterator last) {
+  return open_stl::is_heap(first, last, less<>());
+}
+
+/*
+    Rearranges a range so that the element at `nth` is the one that would be
+   there if the range were sorted.
+
+    Template Parameters:
+        - RandomIterator: The type of iterator for the range.
+        - Compare: The ordering to select by.
+
+    Parameters:
+        - first: The beginning of the range.
+        - nth: The position to fill with its sorted element.
+        - last: The end of the range.
+        - comp: Returns true if its first argument is ordered before its
+   second.
+
+    After the call no element before `nth` is ordered after it and no
+   element after `nth` is ordered before it. The selection is an introselect:
+   quickselect with median-of-three pivots, falling back to median-of-medians
+   pivots after 2 * log2(n) partitions, so it is linear on average and in
+   the worst case.
+*/
+template <typename RandomIterator, typename Compare>
+constexpr void nth_element(RandomIterator first, RandomIterator nth,
+                           RandomIterator last, Compare comp) {
+  if (first == last || nth == last) return;
+  internal::introselect(first, nth, last, comp,
+                        2 * internal::log2_floor(last - first));
+}
+
+// Selects the nth smallest element of a range, comparing with operator<.
+template <typename RandomIterator>
+constexpr void nth_element(RandomIterator first, RandomIterator nth,
+                           RandomIterator last) {
+  open_stl::nth_element(first, nth, last, less<>());
+}
+
+/*
+    Sorts the smallest elements of a range into its front.
+
+    Template Parameters:
+        - RandomIterator: The type of iterator for the range.
+        - Compare: The ordering to sort by.
+
+    Parameters:
+        - first: The beginning of the range.
+        - middle: The end of the part to be sorted.
+        - last: The end of the range.
+        - comp: Returns true if its first argument is ordered before its
+   second.
+
+    After the call [first, middle) holds the `middle - first` smallest
+   elements in sorted order; the order of the rest is unspecified. The front
+   is kept as a max-heap while the rest of the range is scanned once, so the
+   cost is O(n log k) rather than the O(n log n) of a full sort.
+*/
+template <typename RandomIterator, typename Compare>
+constexpr void partial_sort(RandomIterator first, RandomIterator middle,
+                            RandomIterator last, Compare comp) {
+  if (first == middle) return;
+  std::ptrdiff_t length = middle - first;
+  internal::make_heap(first, middle, comp);
+  for (RandomIterator it = middle; it < last; ++it) {
+    if (comp(*it, *first)) {
+      open_stl::swap(*it, *first);
+      internal::sift_down(first, 0, length, comp);
+    }
+  }
+  internal::sort_heap(first, middle, comp);
+}
+
+// Sorts the smallest elements of a range into its front, comparing with
+// operator<.
+template <typename RandomIterator>
+constexpr void partial_sort(RandomIterator first, RandomIterator middle,
+                            RandomIterator last) {
+  open_stl::partial_sort(first, middle, last, less<>());
+}
+
+/*
+    Copies the smallest elements of a range, in sorted order, into another
+   range.
+
+    Template Parameters:
+        - InputIterator: The type of iterator for the input range.
+        - RandomIterator: The type of iterator for the output range.
+        - Compare: The ordering to sort by.
+
+    Parameters:
+        - first: The beginning of the input range.
+        - last: The end of the input range.
+        - d_first: The beginning of the output range.
+        - d_last: The end of the output range.
+        - comp: Returns true if its first argument is ordered before its
+   second.
+
+    Returns:
+        - An iterator past the last element written, which is d_first plus
+   the smaller of the two range lengths.
+
+    The input is read exactly once and never modified, so it may be a single
+   pass input range. Only the output range is used as scratch space.
+*/
+template <typename InputIterator, typename RandomIterator, typename Compare>
+constexpr RandomIterator partial_sort_copy(InputIterator first,
+                                           InputIterator last,
+                                           RandomIterator d_first,
+                                           RandomIterator d_last,
+                                           Compare comp) {
+  RandomIterator d_end = d_first;
+  for (; first != last && d_end != d_last; ++first, ++d_end) {
+    *d_end = *first;
+  }
+  if (d_end == d_first) return d_end;
+  std::ptrdiff_t length = d_end - d_first;
+  internal::make_heap(d_first, d_end, comp);
+  for (; first != last; ++first) {
+    if (comp(*first, *d_first)) {
+      *d_first = *first;
+      internal::sift_down(d_first, 0, length, comp);
+    }
+  }
+  internal::sort_heap(d_first, d_end, comp);
+  return d_end;
+}
+
+// Copies the smallest elements of a range, in sorted order, into another
+// range, comparing with operator<.
+template <typename InputIterator, typename RandomIterator>
+constexpr RandomIterator partial_sort_copy(InputIterator first,
+                                           InputIterator last,
+                                           RandomIterator d_first,
+                                           RandomIterator d_last) {
+  return open_stl::partial_sort_copy(first, last, d_first, d_last, less<>());
+}
+
+/*
+    Sorts a range.
+
+    Template Parameters:
+        - RandomIterator: The type of iterator for the range.
+        - Compare: The ordering to sort by.
+
+    Parameters:
+        - first: The beginning of the range.
+        - last: The end of the range.
+        - comp: Returns true if its first argument is ordered before its
+   second.
+
+    The sort is an introsort: quicksort with median-of-three pivots that
+   switches to heap sort after 2 * log2(n) partitions, so it is O(n log n)
+   in the worst case. It is not stable.
+*/
+template <typename RandomIterator, typename Compare>
+constexpr void sort(RandomIterator first, RandomIterator last, Compare comp) {
+  if (last - first < 2) return;
+  internal::introsort(first, last, comp,
+                      2 * internal::log2_floor(last - first));
+}
+
+// Sorts a range, comparing with operator<.
+template <typename RandomIterator>
+constexpr void sort(RandomIterator first, RandomIterator last) {
+  open_stl::sort(first, last, less<>());
+}
+
+/*
+    Removes consecutive duplicates from a range.
+
+    Template Parameters:
+        - ForwardIterator: The type of iterator for the range.
+        - BinaryPredicate: The equivalence to collapse.
+
+    Parameters:
+        - first: The beginning of the range.
+        - last: The end of the range.
+        - pred: Returns true if its two arguments are equivalent.
+
+    Returns:
+        - The new end of the range. Of every run of equivalent elements only
+   the first is kept; the elements past the new end are left in a valid but
+   unspecified state.
+
+    Applied to a sorted range this leaves every value exactly once.
+*/
+template <typename ForwardIterator, typename BinaryPredicate>
+constexpr ForwardIterator unique(ForwardIterator first, ForwardIterator last,
+                                 BinaryPredicate pred) {
+  if (first == last) return last;
+  ForwardIterator result = first;
+  while (++first != last) {
+    if (!pred(*result, *first) && ++result != first) {
+      *result = move(*first);
+    }
+  }
+  return ++result;
+}
+
+// Removes consecutive duplicates from a range, comparing with operator==.
+template <typename ForwardIterator>
+constexpr ForwardIterator unique(ForwardIterator first, ForwardIterator last) {
+  return open_stl::unique(first, last, equal_to<>());
+}
+
+// Assigns `value` to every element of a range.
+template <typename ForwardIterator, typename T>
+constexpr void fill(ForwardIterator first, ForwardIterator last,
+                    const T &value) {
+  for (; first != last; ++first) {
+    *first = value;
+  }
+}
+
+/*
+    Applies a function to every element of a range and stores the results.
+
+    Template Parameters:
+        - InputIterator: The type of iterator for the input range.
+        - OutputIterator: The type of iterator for the output range.
+        - UnaryOperation: The function to apply.
+
+    Parameters:
+        - first: The beginning of the input range.
+        - last: The end of the input range.
+        - d_first: The beginning of the output range; it may equal `first`.
+        - op: Called once per element, in order.
+
+    Returns:
+        - An iterator past the last element written.
+
+    Like the rest of this header it is constexpr, so together with sort and
+   fill it can compute lookup tables during compilation.
+*/
+template <typename InputIterator, typename OutputIterator,
+          typename UnaryOperation>
+constexpr OutputIterator transform(InputIterator first, InputIterator last,
+                                   OutputIterator d_first, UnaryOperation op) {
+  for (; first != last; ++first, ++d_first) {
+    *d_first = op(*first);
+  }
+  return d_first;
+}
+
+// Combines the elements of two ranges pairwise with `op` and stores the
+// results; the second range must be at least as long as the first.
+template <typename InputIterator1, typename InputIterator2,
+          typename OutputIterator, typename BinaryOperation>
+constexpr OutputIterator transform(InputIterator1 first1, InputIterator1 last1,
+                                   InputIterator2 first2,
+                                   OutputIterator d_first,
+                                   BinaryOperation op) {
+  for (; first1 != last1; ++first1, ++first2, ++d_first) {
+    *d_first = op(*first1, *first2);
+  }
+  return d_first;
+}
+
 }  // namespace open_stl
 
 #endif  // OPEN_STL_ALGORITHM_H_
\ No newline at end of file
@@ -44,7 +44,7 @@ struct array {
       out of range, it throws an `std::out_of_range` exception with an
      appropriate error message.
   */
-  reference at(size_type off) {
+  constexpr reference at(size_type off) {
     if (off < 0 || off >= N) {
       throw std::out_of_range(
           "Error: Array index out of range. Please ensure the index is within "
@@ -74,7 +74,7 @@ struct array {
      the index is out of range, it throws an `std::out_of_range` exception with
      an appropriate error message.
   */
-  const_reference at(size_type off) const {
+  constexpr const_reference at(size_type off) const {
     if (off < 0 || off >= N) {
       throw std::out_of_range(
           "Error: Array index out of range. Please ensure the index is within "
@@ -98,7 +98,7 @@ struct array {
       This function provides access to the last element of the array. It assumes
       that the array is not empty, so it does not perform any bounds checking.
   */
-  reference back() { return m_data[N - 1]; }
+  constexpr reference back() { return m_data[N - 1]; }
 
   /*
       Accesses the last element in the array (const version).
@@ -116,7 +116,7 @@ struct array {
       It assumes that the array is not empty, so it does not perform any bounds
      checking.
   */
-  const_reference back() const { return m_data[N - 1]; }
+  constexpr const_reference back() const { return m_data[N - 1]; }
 
   /*
     Returns an iterator to the beginning of the array.
@@ -133,7 +133,7 @@ struct array {
     This function provides an iterator that points to the beginning of the
     array. It can be used to iterate over the elements of the array.
   */
-  iterator begin() { return &m_data[0]; }
+  constexpr iterator begin() { return &m_data[0]; }
 
   /*
       Returns a const iterator to the beginning of the array.
@@ -151,7 +151,7 @@ struct array {
      the array. It can be used to iterate over the elements of the array in a
      read-only manner.
   */
-  const_iterator begin() const { return &m_data[0]; }
+  constexpr const_iterator begin() const { return &m_data[0]; }
 
   /*
       Returns a const iterator to the beginning of the array
@@ -168,7 +168,7 @@ struct array {
      the array. It can be used to iterate over the elements of the array in a
      read-only manner.
   */
-  const_iterator cbegin() const { return &m_data[0]; }
+  constexpr const_iterator cbegin() const { return &m_data[0]; }
 
   /*
       Returns a const reverse iterator to the beginning of the reversed array.
@@ -186,7 +186,7 @@ struct array {
      element of the array, allowing iteration over the elements of the array in
      reverse order in a read-only manner.
   */
-  const_reverse_iterator crbegin() const {
+  constexpr const_reverse_iterator crbegin() const {
     return const_reverse_iterator(&m_data[N - 1]);
   }
 
@@ -207,7 +207,7 @@ struct array {
      the last element in the array. It can be used to determine the end of the
      array when iterating over its elements in a read-only manner.
   */
-  const_iterator cend() const { return &m_data[N]; }
+  constexpr const_iterator cend() const { return &m_data[N]; }
 
   /*
       Returns a const reverse iterator to the end of the reversed array.
@@ -227,7 +227,7 @@ struct array {
      the end of the array when iterating over its elements in reverse order in a
      read-only manner.
   */
-  const_reverse_iterator crend() const {
+  constexpr const_reverse_iterator crend() const {
     return const_reverse_iterator(&m_data[-1]);
   }
 
@@ -246,7 +246,7 @@ struct array {
       This function returns a pointer to the first element in the array,
      providing direct access to the underlying data of the array.
   */
-  pointer data() { return &m_data[0]; }
+  constexpr pointer data() { return &m_data[0]; }
 
   /*
       Returns a const pointer to the underlying data (const version).
@@ -263,7 +263,7 @@ struct array {
       This function returns a const pointer to the first element in the array,
       providing read-only access to the underlying data of the array.
   */
-  const_pointer data() const { return &m_data[0]; }
+  constexpr const_pointer data() const { return &m_data[0]; }
 
   /*
       Returns an iterator to the end of the array.
@@ -282,7 +282,7 @@ struct array {
      last element in the array. It can be used to determine the end of the array
      when iterating over its elements.
   */
-  iterator end() { return &m_data[N]; }
+  constexpr iterator end() { return &m_data[N]; }
 
   /*
       Returns a const iterator to the end of the array (const version).
@@ -301,7 +301,7 @@ struct array {
      the last element in the array. It can be used to determine the end of the
      array when iterating over its elements in a read-only manner.
   */
-  const_iterator end() const { return &m_data[N]; }
+  constexpr const_iterator end() const { return &m_data[N]; }
 
   /*
       Checks if the array is empty.
@@ -319,7 +319,7 @@ struct array {
      zero), and false otherwise. It is constexpr, allowing its evaluation at
      compile time.
   */
-  bool empty() const { return N == 0; }
+  constexpr bool empty() const { return N == 0; }
 
   /*
       Returns a reference to the first element in the array.
@@ -336,7 +336,7 @@ struct array {
       This function returns a reference to the first element in the array,
       allowing direct access to modify or read the element.
   */
-  reference front() { return m_data[0]; }
+  constexpr reference front() { return m_data[0]; }
 
   /*
       Returns a const reference to the first element in the array (const
@@ -355,7 +355,7 @@ struct array {
       allowing read-only access to the element. It is constexpr, allowing its
       evaluation at compile time.
   */
-  const_reference front() const { return m_data[0]; }
+  constexpr const_reference front() const { return m_data[0]; }
 
   /*
       Returns the maximum possible size of the array.
@@ -373,7 +373,7 @@ struct array {
       determined by the template parameter N. It is constexpr, allowing its
       evaluation at compile time.
   */
-  size_type max_size() const { return N; }
+  constexpr size_type max_size() const { return N; }
 
   /*
       Returns a reverse iterator to the beginning of the reversed array.
@@ -391,7 +391,9 @@ struct array {
       of the array, allowing iteration over the elements of the array in reverse
      order.
   */
-  reverse_iterator rbegin() { return reverse_iterator(&m_data[N - 1]); }
+  constexpr reverse_iterator rbegin() {
+    return reverse_iterator(&m_data[N - 1]);
+  }
 
   /*
       Returns a const reverse iterator to the beginning of the reversed array
@@ -410,7 +412,7 @@ struct array {
      element of the array, allowing iteration over the elements of the array in
      reverse order in a read-only manner.
   */
-  const_reverse_iterator rbegin() const {
+  constexpr const_reverse_iterator rbegin() const {
     return const_reverse_iterator(&m_data[N - 1]);
   }
 
@@ -431,7 +433,7 @@ struct array {
      before the first element in the array, allowing iteration over the elements
      of the array in reverse order.
   */
-  reverse_iterator rend() { return reverse_iterator(&m_data[-1]); }
+  constexpr reverse_iterator rend() { return reverse_iterator(&m_data[-1]); }
 
   /*
       Returns a const reverse iterator to the end of the reversed array (const
@@ -451,7 +453,7 @@ struct array {
      before the first element in the array, allowing iteration over the elements
      of the array in reverse order in a read-only manner.
   */
-  const_reverse_iterator rend() const {
+  constexpr const_reverse_iterator rend() const {
     return const_reverse_iterator(&m_data[-1]);
   }
 
@@ -471,7 +473,7 @@ struct array {
       template parameter N. It is constexpr, allowing its evaluation at compile
      time.
   */
-  size_type size() const { return N; }
+  constexpr size_type size() const { return N; }
 
   /*
       Fills the array with the specified value.
@@ -488,7 +490,7 @@ struct array {
       This function assigns the specified value `val` to each element of the
      array.
   */
-  void fill(const_reference val) {
+  constexpr void fill(const_reference val) {
     for (size_type i = 0; i < N; i++) {
       m_data[i] = val;
     }
@@ -510,7 +512,7 @@ struct array {
       Each element of this array is swapped with the corresponding element of
      `right`.
   */
-  void swap(array<T, N> &right) {
+  constexpr void swap(array<T, N> &right) {
     for (size_type i = 0; i < N; i++) {
       open_stl::swap(m_data[i], right.m_data[i]);
     }
@@ -536,7 +538,7 @@ struct array {
      `off`. No bounds checking is performed, so the caller must ensure that the
      index is within the valid range.
   */
-  reference operator[](size_type off) { return m_data[off]; }
+  constexpr reference operator[](size_type off) { return m_data[off]; }
 
   /*
       Accesses the element at the specified position without bounds checking
@@ -559,58 +561,8 @@ struct array {
      index `off`. No bounds checking is performed, so the caller must ensure
      that the index is within the valid range.
   */
-  const_reference operator[](size_type off) const { return m_data[off]; }
-
-  /*
-      Assignment operator for assigning one array to another.
-
-      Template Parameters:
-          - None.
-
-      Parameters:
-          - right: The array to assign from.
-
-      Returns:
-          - A reference to the current array after assignment.
-
-      Note:
-          - Checks for self-assignment are performed to prevent unnecessary
-     work.
-
-      This assignment operator copies each element from the array `right` to
-      the corresponding position in the current array.
-  */
-  array<T, N> &operator=(const array<T, N> &right) {
-    if (this != &right) {
-      for (size_type i = 0; i < N; i++) {
-        m_data[i] = right.m_data[i];
-      }
-    }
-    return *this;
-  }
-
-  /*
-      Move assignment operator for moving the contents of one array to another.
-
-      Template Parameters:
-          - None.
-
-      Parameters:
-          - right: The rvalue reference to another array object.
-
-      Returns:
-          - A reference to the current array after move assignment.
-
-      This move assignment operator moves each element from the array `right` to
-      the corresponding position in the current array. After moving, the
-     elements in the `right` array are set to default values.
-  */
-  array<T, N> &operator=(array<T, N> &&right) {
-    for (size_type i = 0; i < N; i++) {
-      m_data[i] = move(right.m_data[i]);
-      right.m_data[i] = {};
-    }
-    return *this;
+  constexpr const_reference operator[](size_type off) const {
+    return m_data[off];
   }
 
   /*
@@ -630,7 +582,7 @@ struct array {
      array with the corresponding element of the `right` array. If any pair of
      elements are not equal, it returns false. Otherwise, it returns true.
   */
-  bool operator==(const array<T, N> &right) const {
+  constexpr bool operator==(const array<T, N> &right) const {
     return equal(begin(), end(), right.begin(), right.end());
   }
 
@@ -651,7 +603,9 @@ struct array {
      comparison operator. It returns true if the current array is not equal to
      the `right` array, and false otherwise.
   */
-  bool operator!=(const array<T, N> &right) const { return !(*this == right); }
+  constexpr bool operator!=(const array<T, N> &right) const {
+    return !(*this == right);
+  }
 
   /*
       Less-than comparison operator for comparing two arrays lexicographically.
@@ -670,7 +624,7 @@ struct array {
      `right` array lexicographically. It uses the lexicographical comparison
      function to perform the comparison between the elements of the two arrays.
   */
-  bool operator<(const array<T, N> &right) const {
+  constexpr bool operator<(const array<T, N> &right) const {
     return lexicographical_compare(begin(), end(), right.begin(), right.end());
   }
 
@@ -692,7 +646,7 @@ struct array {
      current array lexicographically. It uses the lexicographical comparison
      function to perform the comparison between the elements of the two arrays.
   */
-  bool operator>(const array<T, N> &right) const {
+  constexpr bool operator>(const array<T, N> &right) const {
     return lexicographical_compare(right.begin(), right.end(), begin(), end());
   }
 
@@ -714,7 +668,7 @@ struct array {
      comparison function to perform the comparison between the elements of the
      two arrays. If the arrays are equal, it returns true.
   */
-  bool operator<=(const array<T, N> &right) const {
+  constexpr bool operator<=(const array<T, N> &right) const {
     return lexicographical_compare(begin(), end(), right.begin(),
                                    right.end()) ||
            *this == right;
@@ -738,13 +692,16 @@ struct array {
      comparison function to perform the comparison between the elements of the
      two arrays. If the arrays are equal, it returns true.
   */
-  bool operator>=(const array<T, N> &right) const {
+  constexpr bool operator>=(const array<T, N> &right) const {
     return lexicographical_compare(right.begin(), right.end(), begin(),
                                    end()) ||
            *this == right;
   }
 
  public:
+  // array declares no constructors or assignment operators: it stays an
+  // aggregate whose copies and moves are the implicit memberwise ones, so
+  // constant expressions can copy it too.
   value_type m_data[N] = {value_type()};
 };
 
@@ -762,62 +719,91 @@ struct array<T, 0> {
   using reverse_iterator = internal::reverse_iterator<iterator>;
   using size_type = std::size_t;
 
-  reference at(size_type off) {
+  constexpr reference at(size_type off) {
     throw std::out_of_range(
         "Error: Array index out of range. Please ensure the index is within "
         "the valid range.");
     return nullptr;
   }
 
-  const_reference at(size_type off) const {
+  constexpr const_reference at(size_type off) const {
     throw std::out_of_range(
         "Error: Array index out of range. Please ensure the index is within "
         "the valid range.");
     return nullptr;
   }
 
-  reference back() { return nullptr; }
+  constexpr reference back() { return nullptr; }
 
-  const_reference back() const { return nullptr; }
+  constexpr const_reference back() const { return nullptr; }
 
-  iterator begin() { return nullptr; }
+  constexpr iterator begin() { return nullptr; }
 
-  const_iterator begin() const { return nullptr; }
+  constexpr const_iterator begin() const { return nullptr; }
 
-  const_iterator cbegin() const { return nullptr; }
+  constexpr const_iterator cbegin() const { return nullptr; }
 
-  const_reverse_iterator crbegin() const {
+  constexpr const_reverse_iterator crbegin() const {
     return const_reverse_iterator(nullptr);
   }
 
-  const_iterator cend() const { return nullptr; }
+  constexpr const_iterator cend() const { return nullptr; }
 
-  const_reverse_iterator crend() const {
+  constexpr const_reverse_iterator crend() const {
     return const_reverse_iterator(nullptr);
   }
 
-  pointer data() { return nullptr; }
-  const_pointer data() const { return nullptr; }
-
-  iterator end() { return nullptr; }
-  const_iterator end() const { return nullptr; }
-  bool empty() const { return true; }
-  reference front() { return *data(); }
-  const_reference front() const { return *data(); }
-  size_type max_size() const { return 0; }
-  reverse_iterator rbegin() { return reverse_iterator(nullptr); }
-  const_reverse_iterator rbegin() const {
+  constexpr pointer data() { return nullptr; }
+  constexpr const_pointer data() const { return nullptr; }
+
+  constexpr iterator end() { return nullptr; }
+  constexpr const_iterator end() const { return nullptr; }
+  constexpr bool empty() const { return true; }
+  constexpr reference front() { return *data(); }
+  constexpr const_reference front() const { return *data(); }
+  constexpr size_type max_size() const { return 0; }
+  constexpr reverse_iterator rbegin() { return reverse_iterator(nullptr); }
+  constexpr const_reverse_iterator rbegin() const {
     return const_reverse_iterator(nullptr);
   }
-  reverse_iterator rend() { return reverse_iterator(nullptr); }
-  const_reverse_iterator rend() const {
+  constexpr reverse_iterator rend() { return reverse_iterator(nullptr); }
+  constexpr const_reverse_iterator rend() const {
     return const_reverse_iterator(nullptr);
   }
-  size_type size() const { return 0; }
-  void fill(const_reference val) {}
-  void swap(array<T, 0> &right) {}
-  reference operator[](size_type off) { return *data(); }
-  const_reference operator[](size_type off) const { return *data(); }
+  constexpr size_type size() const { return 0; }
+  constexpr void fill(const_reference val) {}
+  constexpr void swap(array<T, 0> &right) {}
+  constexpr reference operator[](size_type off) { return *data(); }
+  constexpr const_reference operator[](size_type off) const { return *data(); }
 };
+
+/*
+    Builds an array whose element i is generator(i).
+
+    Template Parameters:
+        - T: The element type.
+        - N: The number of elements.
+        - Generator: Called with each index from 0 to N - 1.
+
+    Returns:
+        - The filled array.
+
+    Evaluated in a constexpr context, the whole table is computed by the
+   compiler and lands in read-only data, so a CRC table or lookup table
+   costs nothing at startup:
+
+       constexpr auto squares =
+           open_stl::generate_array<int, 16>([](std::size_t i) {
+             return int(i * i);
+           });
+*/
+template <typename T, std::size_t N, typename Generator>
+constexpr array<T, N> generate_array(Generator generator) {
+  array<T, N> result;
+  for (std::size_t i = 0; i < N; i++) {
+    result[i] = generator(i);
+  }
+  return result;
+}
 }  // namespace open_stl
 #endif  // OPEN_STL_ARRAY_H_
@@ -0,0 +1,296 @@
+#ifndef OPEN_STL_BLOOM_FILTER_H_
+#define OPEN_STL_BLOOM_FILTER_H_
+
+#include <OpenSTL/hash.h>
+#include <OpenSTL/internal/config.h>
+#include <OpenSTL/internal/prefetch.h>
+#include <OpenSTL/memory.h>
+#include <OpenSTL/vector.h>
+
+#if defined(OPEN_STL_HAS_AVX2)
+#include <immintrin.h>
+#elif defined(OPEN_STL_HAS_SSE2)
+#include <emmintrin.h>
+#endif
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+namespace open_stl {
+namespace internal {
+
+/*
+    A block of a bloom_filter: eight 32-bit lanes in which a key sets one
+   bit each.
+
+    A block is 32 bytes and aligned to that, so it never straddles a cache
+   line.
+*/
+struct alignas(32) bloom_block {
+  static constexpr std::size_t lanes = 8;
+  std::uint32_t words[lanes];
+};
+
+// Odd multipliers that pick a key's bit in each lane of a block.
+inline constexpr std::uint32_t bloom_salts[bloom_block::lanes] = {
+    0x47b6137bu, 0x44974d91u, 0x8824ad5bu, 0xa2b7289du,
+    0x705495c7u, 0x2df1424bu, 0x9efc4947u, 0x5c6bfb31u};
+
+// Fills `masks` with the bit a key with hash `hash` sets in each lane: bit
+// (hash * salt) >> 27 of the lane. This is the scalar form of the masks the
+// SIMD paths below build.
+inline void bloom_masks(std::uint32_t hash,
+                        std::uint32_t (&masks)[bloom_block::lanes]) {
+  for (std::size_t lane = 0; lane < bloom_block::lanes; lane++) {
+    masks[lane] = std::uint32_t(1) << ((hash * bloom_salts[lane]) >> 27);
+  }
+}
+
+#if defined(OPEN_STL_HAS_AVX2)
+// Builds the eight lane masks in one 256-bit register: a multiply, a shift
+// and a variable shift of 1 by each lane's bit index.
+inline __m256i bloom_masks_avx2(std::uint32_t hash) {
+  const __m256i salts =
+      _mm256_loadu_si256(reinterpret_cast<const __m256i *>(bloom_salts));
+  __m256i bits = _mm256_srli_epi32(
+      _mm256_mullo_epi32(_mm256_set1_epi32(int(hash)), salts), 27);
+  return _mm256_sllv_epi32(_mm256_set1_epi32(1), bits);
+}
+#elif defined(OPEN_STL_HAS_SSE2)
+// Builds four lane masks, for the salts at `salts`, in a 128-bit register.
+// SSE2 has neither a 32-bit multiply nor a variable shift: the products of
+// the even and odd lanes come from two 32x32->64-bit multiplies, and 1 << b
+// is made by storing b + 127 as the exponent of a float and converting that
+// float, 2^b, back to an integer. 2^31 is out of range for the conversion,
+// which then yields 0x80000000, the right mask again.
+inline __m128i bloom_masks_sse2(std::uint32_t hash,
+                                const std::uint32_t *salts) {
+  __m128i key = _mm_set1_epi32(int(hash));
+  __m128i salt = _mm_loadu_si128(reinterpret_cast<const __m128i *>(salts));
+  __m128i even = _mm_mul_epu32(key, salt);
+  __m128i odd = _mm_mul_epu32(key, _mm_srli_epi64(salt, 32));
+  __m128i product = _mm_unpacklo_epi32(
+      _mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)),
+      _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+  __m128i bits = _mm_srli_epi32(product, 27);
+  __m128i exponent =
+      _mm_slli_epi32(_mm_add_epi32(bits, _mm_set1_epi32(127)), 23);
+  return _mm_cvttps_epi32(_mm_castsi128_ps(exponent));
+}
+#endif
+
+// Sets the bits of a key with hash `hash` in `block`.
+inline void bloom_insert(bloom_block &block, std::uint32_t hash) {
+#if defined(OPEN_STL_HAS_AVX2)
+  __m256i *words = reinterpret_cast<__m256i *>(block.words);
+  _mm256_store_si256(words,
+                     _mm256_or_si256(_mm256_load_si256(words),
+                                     bloom_masks_avx2(hash)));
+#elif defined(OPEN_STL_HAS_SSE2)
+  __m128i *words = reinterpret_cast<__m128i *>(block.words);
+  _mm_store_si128(words, _mm_or_si128(_mm_load_si128(words),
+                                      bloom_masks_sse2(hash, bloom_salts)));
+  _mm_store_si128(words + 1,
+                  _mm_or_si128(_mm_load_si128(words + 1),
+                               bloom_masks_sse2(hash, bloom_salts + 4)));
+#else
+  std::uint32_t masks[bloom_block::lanes];
+  bloom_masks(hash, masks);
+  for (std::size_t lane = 0; lane < bloom_block::lanes; lane++) {
+    block.words[lane] |= masks[lane];
+  }
+#endif
+}
+
+// Checks whether every bit of a key with hash `hash` is set in `block`. All
+// lanes are tested together rather than stopping at the first missing bit.
+inline bool bloom_contains(const bloom_block &block, std::uint32_t hash) {
+#if defined(OPEN_STL_HAS_AVX2)
+  // testc is 1 when the masks have no bit that the block lacks.
+  return _mm256_testc_si256(
+             _mm256_load_si256(reinterpret_cast<const __m256i *>(block.words)),
+             bloom_masks_avx2(hash)) != 0;
+#elif defined(OPEN_STL_HAS_SSE2)
+  const __m128i *words = reinterpret_cast<const __m128i *>(block.words);
+  __m128i missing = _mm_or_si128(
+      _mm_andnot_si128(_mm_load_si128(words),
+                       bloom_masks_sse2(hash, bloom_salts)),
+      _mm_andnot_si128(_mm_load_si128(words + 1),
+                       bloom_masks_sse2(hash, bloom_salts + 4)));
+  return _mm_movemask_epi8(_mm_cmpeq_epi32(missing, _mm_setzero_si128())) ==
+         0xffff;
+#else
+  std::uint32_t masks[bloom_block::lanes];
+  bloom_masks(hash, masks);
+  std::uint32_t missing = 0;
+  for (std::size_t lane = 0; lane < bloom_block::lanes; lane++) {
+    missing |= ~block.words[lane] & masks[lane];
+  }
+  return missing == 0;
+#endif
+}
+
+}  // namespace internal
+
+/*
+    A split-block Bloom filter: a set membership test with no false
+   negatives and a tunable rate of false positives.
+
+    Template Parameters:
+        - Key: The type of the keys.
+        - Hash: The hash function object; its result is mixed unless it
+       declares `is_avalanching` and std::size_t has 64 bits.
+        - Allocator: The allocator; it is rebound to allocate the blocks.
+
+    A classic Bloom filter sets k bits scattered over the whole array, so a
+   query costs k cache misses. Here the high half of the hash picks one
+   32-byte block and the low half sets one bit in each of its eight 32-bit
+   lanes, so every query costs a single miss. The eight lane masks are
+   built and tested in one AVX2 register, or two SSE2 registers, with a
+   scalar loop on other targets. Packing the bits into a block costs some
+   accuracy: at the default 10 bits per key the false positive rate is
+   about 1%, against 0.8% for an unblocked filter.
+
+    insert_batch() and contains_batch() hash a group of keys and prefetch
+   their blocks before touching any of them, so the misses of the group
+   overlap instead of being paid one after another.
+*/
+template <typename Key, typename Hash = hash<Key>,
+          typename Allocator = allocator<Key>>
+class bloom_filter {
+  using block_type = internal::bloom_block;
+  using block_allocator =
+      typename Allocator::template rebind<block_type>::other;
+
+ public:
+  using key_type = Key;
+  using size_type = std::size_t;
+  using hasher = Hash;
+  using allocator_type = Allocator;
+
+  /*
+      Constructor sizing the filter for a number of keys.
+
+      Parameters:
+          - expected_keys: The number of keys the filter is meant to hold.
+          - bits_per_key: The memory to spend per key; the false positive
+         rate falls roughly tenfold for every 5 more bits.
+          - hash: The hash function object.
+  */
+  explicit bloom_filter(size_type expected_keys, double bits_per_key = 10,
+                        const Hash &hash = Hash())
+      : m_blocks(block_count(expected_keys, bits_per_key), block_type{}),
+        m_hash(hash) {}
+
+  // Returns the size of the filter in bits
+  size_type bit_count() const {
+    return m_blocks.size() * block_type::lanes * 32;
+  }
+
+  // Adds `key` to the set.
+  void insert(const key_type &key) { insert_hash(hash_of(key)); }
+
+  // Checks whether `key` may be in the set. False means it certainly is
+  // not; true is wrong at the false positive rate.
+  bool contains(const key_type &key) const {
+    return contains_hash(hash_of(key));
+  }
+
+  // Adds `count` keys starting at `keys`, overlapping their cache misses.
+  void insert_batch(const key_type *keys, size_type count) {
+    std::uint64_t hashes[internal::prefetch_batch_size];
+    for (size_type base = 0; base < count;
+         base += internal::prefetch_batch_size) {
+      size_type size = batch_length(count - base);
+      prefetch_batch(keys + base, size, hashes);
+      for (size_type i = 0; i < size; i++) {
+        insert_hash(hashes[i]);
+      }
+    }
+  }
+
+  /*
+      Tests `count` keys starting at `keys`, overlapping their cache misses.
+
+      Parameters:
+          - results: Receives, for every key, whether it may be in the set.
+
+      Returns:
+          - The number of keys that may be in the set.
+  */
+  size_type contains_batch(const key_type *keys, size_type count,
+                           bool *results) const {
+    std::uint64_t hashes[internal::prefetch_batch_size];
+    size_type found = 0;
+    for (size_type base = 0; base < count;
+         base += internal::prefetch_batch_size) {
+      size_type size = batch_length(count - base);
+      prefetch_batch(keys + base, size, hashes);
+      for (size_type i = 0; i < size; i++) {
+        results[base + i] = contains_hash(hashes[i]);
+        found += results[base + i];
+      }
+    }
+    return found;
+  }
+
+  // Removes every key.
+  void clear() {
+    for (size_type i = 0; i < m_blocks.size(); i++) {
+      m_blocks[i] = block_type{};
+    }
+  }
+
+ private:
+  vector<block_type, block_allocator> m_blocks;
+  Hash m_hash;
+
+  static size_type block_count(size_type keys, double bits_per_key) {
+    double bits = double(keys) * bits_per_key;
+    size_type blocks = size_type(std::ceil(bits / (32 * block_type::lanes)));
+    return blocks < 1 ? 1 : blocks;
+  }
+
+  std::uint64_t hash_of(const key_type &key) const {
+    return internal::hash64(m_hash, key);
+  }
+
+  // Maps the high 32 bits of the hash onto the blocks by a multiply and a
+  // shift, which needs no power-of-two block count.
+  const block_type &block_for(std::uint64_t hash) const {
+    std::uint64_t high = hash >> 32;
+    return m_blocks[size_type((high * m_blocks.size()) >> 32)];
+  }
+
+  block_type &block_for(std::uint64_t hash) {
+    return const_cast<block_type &>(
+        static_cast<const bloom_filter &>(*this).block_for(hash));
+  }
+
+  void insert_hash(std::uint64_t hash) {
+    internal::bloom_insert(block_for(hash), std::uint32_t(hash));
+  }
+
+  bool contains_hash(std::uint64_t hash) const {
+    return internal::bloom_contains(block_for(hash), std::uint32_t(hash));
+  }
+
+  static size_type batch_length(size_type remaining) {
+    return remaining < internal::prefetch_batch_size
+               ? remaining
+               : internal::prefetch_batch_size;
+  }
+
+  // Hashes `size` keys into `hashes` and prefetches their blocks.
+  void prefetch_batch(const key_type *keys, size_type size,
+                      std::uint64_t *hashes) const {
+    for (size_type i = 0; i < size; i++) {
+      hashes[i] = hash_of(keys[i]);
+      internal::prefetch(&block_for(hashes[i]));
+    }
+  }
+};
+}  // namespace open_stl
+
+#endif  // OPEN_STL_BLOOM_FILTER_H_
@@ -0,0 +1,381 @@
+#ifndef OPEN_STL_BTREE_MAP_H_
+#define OPEN_STL_BTREE_MAP_H_
+
+#include <OpenSTL/functional.h>
+#include <OpenSTL/internal/btree.h>
+#include <OpenSTL/internal/iterator.h>
+#include <OpenSTL/memory.h>
+#include <OpenSTL/utility.h>
+#include <OpenSTL/vector.h>
+
+#include <cstddef>
+#include <initializer_list>
+#include <stdexcept>
+
+namespace open_stl {
+namespace internal {
+
+/*
+    Bidirectional iterator over a btree_map, walking the linked leaves.
+
+    Template Parameters:
+        - Leaf: The leaf node type of the tree.
+        - Mapped: The mapped type, const-qualified for const iterators.
+
+    Like flat_map_iterator, dereferencing yields a pair of references,
+   because keys and values live in separate arrays of the leaf.
+*/
+template <typename Leaf, typename Mapped>
+class btree_map_iterator {
+  using Key = typename Leaf::key_type;
+
+ public:
+  using iterator_category = bidirectional_iterator_tag;
+  using value_type = pair<Key, typename remove_cv<Mapped>::type>;
+  using difference_type = std::ptrdiff_t;
+  using reference = pair<const Key &, Mapped &>;
+
+  // Holds a dereferenced pair so that `it->second` works.
+  struct pointer {
+    reference ref;
+    const reference *operator->() const { return &ref; }
+  };
+
+  btree_map_iterator() : m_leaf(nullptr), m_index(0) {}
+
+  btree_map_iterator(Leaf *leaf, std::size_t index)
+      : m_leaf(leaf), m_index(index) {}
+
+  // Converts an iterator to a const iterator.
+  template <typename Other>
+    requires(is_same<Mapped, const Other>::value && !is_const<Other>::value)
+  btree_map_iterator(const btree_map_iterator<Leaf, Other> &other)
+      : m_leaf(other.m_leaf), m_index(other.m_index) {}
+
+  reference operator*() const { return reference(key(), value()); }
+  pointer operator->() const { return pointer{**this}; }
+
+  // Returns the key the iterator points to.
+  const Key &key() const { return m_leaf->keys[m_index]; }
+
+  // Returns the value the iterator points to.
+  Mapped &value() const { return m_leaf->values[m_index]; }
+
+  btree_map_iterator &operator++() {
+    btree_increment(m_leaf, m_index);
+    return *this;
+  }
+
+  btree_map_iterator operator++(int) {
+    btree_map_iterator it = *this;
+    ++(*this);
+    return it;
+  }
+
+  btree_map_iterator &operator--() {
+    btree_decrement(m_leaf, m_index);
+    return *this;
+  }
+
+  btree_map_iterator operator--(int) {
+    btree_map_iterator it = *this;
+    --(*this);
+    return it;
+  }
+
+  bool operator==(const btree_map_iterator &right) const {
+    return m_leaf == right.m_leaf && m_index == right.m_index;
+  }
+  bool operator!=(const btree_map_iterator &right) const {
+    return !(*this == right);
+  }
+
+ private:
+  template <typename L, typename M>
+  friend class btree_map_iterator;
+
+  Leaf *m_leaf;
+  std::size_t m_index;
+};
+
+}  // namespace internal
+
+/*
+    An ordered map stored in a B+tree.
+
+    Template Parameters:
+        - Key: The type of the keys.
+        - T: The type of the mapped values.
+        - Compare: The ordering of the keys.
+        - Allocator: The allocator; it is rebound to allocate the nodes.
+
+    Nodes are sized to a few cache lines and searched with a branchless
+   binary search, so lookups cost a handful of cache misses even for very
+   large maps, and iterating a range walks the linked leaves, which are
+   dense arrays. See internal::btree for the layout. Build large maps from
+   sorted vectors with the sorted_unique constructor, which loads the tree
+   bottom-up in O(n).
+
+    Differences from std::map:
+        - Inserting or erasing invalidates all iterators, since elements
+       move within and between leaves.
+        - Dereferencing an iterator yields a pair<const Key &, T &> rather
+       than a reference to a stored pair.
+        - Keys and values must be default constructible.
+*/
+template <typename Key, typename T, typename Compare = less<Key>,
+          typename Allocator = allocator<Key>>
+class btree_map {
+  using tree_type = internal::btree<Key, T, Compare, Allocator>;
+  using leaf_type = typename tree_type::leaf_type;
+  using slot = typename tree_type::slot;
+
+  static constexpr bool transparent = internal::is_transparent_v<Compare>;
+
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = pair<Key, T>;
+  using key_compare = Compare;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference = pair<const Key &, T &>;
+  using const_reference = pair<const Key &, const T &>;
+  using iterator = internal::btree_map_iterator<leaf_type, T>;
+  using const_iterator = internal::btree_map_iterator<leaf_type, const T>;
+
+  // Default constructor
+  btree_map() : m_tree() {}
+
+  // Constructor taking the key ordering
+  explicit btree_map(const Compare &comp) : m_tree(comp) {}
+
+  /*
+      Constructor bulk loading a key vector that is already sorted and free
+     of duplicates, together with the matching values.
+
+      Throws std::invalid_argument if the vectors differ in size. The tree
+     is built bottom-up in O(n), with no comparisons at all.
+  */
+  btree_map(sorted_unique_t, vector<Key> keys, vector<T> values,
+            const Compare &comp = Compare())
+      : m_tree(comp) {
+    if (keys.size() != values.size()) {
+      throw std::invalid_argument(
+          "Error: btree_map key and value vectors differ in size. Please "
+          "pass one value per key.");
+    }
+    size_type next = 0;
+    m_tree.bulk_load(keys.size(),
+                     [&keys, &values, &next](leaf_type *leaf, size_type i) {
+                       leaf->keys[i] = move(keys[next]);
+                       leaf->values[i] = move(values[next]);
+                       next++;
+                     });
+  }
+
+  // Constructor taking a range of pairs in any order; of equivalent keys the
+  // first one is kept.
+  template <typename InputIterator>
+  btree_map(InputIterator first, InputIterator last,
+            const Compare &comp = Compare())
+      : m_tree(comp) {
+    for (; first != last; ++first) {
+      insert(*first);
+    }
+  }
+
+  // Constructor taking an std::initializer_list of pairs in any order.
+  btree_map(std::initializer_list<value_type> values,
+            const Compare &comp = Compare())
+      : btree_map(values.begin(), values.end(), comp) {}
+
+  // Returns an iterator to the first element
+  iterator begin() { return make_iterator(m_tree.begin_slot()); }
+
+  // Returns a const iterator to the first element
+  const_iterator begin() const {
+    return make_const_iterator(m_tree.begin_slot());
+  }
+
+  // Returns a const iterator to the first element
+  const_iterator cbegin() const { return begin(); }
+
+  // Returns an iterator past the last element
+  iterator end() { return make_iterator(m_tree.end_slot()); }
+
+  // Returns a const iterator past the last element
+  const_iterator end() const { return make_const_iterator(m_tree.end_slot()); }
+
+  // Returns a const iterator past the last element
+  const_iterator cend() const { return end(); }
+
+  // Checks whether the map is empty
+  bool empty() const { return m_tree.size() == 0; }
+
+  // Returns the number of elements
+  size_type size() const { return m_tree.size(); }
+
+  // Returns the key ordering
+  key_compare key_comp() const { return m_tree.key_comp(); }
+
+  // Removes every element
+  void clear() { m_tree.clear(); }
+
+  // Inserts `value` unless its key is present. Returns an iterator to the
+  // element with that key and whether the insertion happened.
+  pair<iterator, bool> insert(const value_type &value) {
+    return make_result(m_tree.emplace(value.first, value.second));
+  }
+
+  // Constructs a pair from `args` and inserts it unless its key is present.
+  template <typename... Args>
+  pair<iterator, bool> emplace(Args &&...args) {
+    value_type value(open_stl::forward<Args>(args)...);
+    return make_result(m_tree.emplace(move(value.first), move(value.second)));
+  }
+
+  // Inserts `value` under `key`, or assigns it if the key is present.
+  pair<iterator, bool> insert_or_assign(const key_type &key,
+                                        const mapped_type &value) {
+    pair<iterator, bool> result = make_result(m_tree.emplace(key, value));
+    if (!result.second) result.first.value() = value;
+    return result;
+  }
+
+  // Returns the value mapped to `key`, inserting a value-initialized one if
+  // the key is absent.
+  mapped_type &operator[](const key_type &key) {
+    return make_result(m_tree.emplace(key)).first.value();
+  }
+
+  // Returns the value mapped to `key`; throws std::out_of_range if absent.
+  mapped_type &at(const key_type &key) {
+    return make_iterator(at_slot(key)).value();
+  }
+
+  // Returns the value mapped to `key`; throws std::out_of_range if absent.
+  const mapped_type &at(const key_type &key) const {
+    return make_const_iterator(at_slot(key)).value();
+  }
+
+  // Returns an iterator to the element with `key`, or end().
+  iterator find(const key_type &key) {
+    return make_iterator(m_tree.find(key));
+  }
+
+  // Returns a const iterator to the element with `key`, or end().
+  const_iterator find(const key_type &key) const {
+    return make_const_iterator(m_tree.find(key));
+  }
+
+  // Heterogeneous overload of find(), enabled for a transparent Compare.
+  template <typename K>
+    requires transparent
+  iterator find(const K &key) {
+    return make_iterator(m_tree.find(key));
+  }
+
+  // Heterogeneous overload of find(), enabled for a transparent Compare.
+  template <typename K>
+    requires transparent
+  const_iterator find(const K &key) const {
+    return make_const_iterator(m_tree.find(key));
+  }
+
+  // Checks whether an element with `key` is present.
+  bool contains(const key_type &key) const { return find(key) != end(); }
+
+  // Heterogeneous overload of contains(), enabled for a transparent Compare.
+  template <typename K>
+    requires transparent
+  bool contains(const K &key) const {
+    return find(key) != end();
+  }
+
+  // Returns the number of elements with `key`, which is 0 or 1.
+  size_type count(const key_type &key) const { return contains(key) ? 1 : 0; }
+
+  // Returns an iterator to the first element whose key is not ordered
+  // before `key`.
+  iterator lower_bound(const key_type &key) {
+    return make_iterator(m_tree.lower_bound(key));
+  }
+
+  // Returns a const iterator to the first element whose key is not ordered
+  // before `key`.
+  const_iterator lower_bound(const key_type &key) const {
+    return make_const_iterator(m_tree.lower_bound(key));
+  }
+
+  // Returns an iterator to the first element whose key is ordered after
+  // `key`.
+  iterator upper_bound(const key_type &key) {
+    return make_iterator(m_tree.upper_bound(key));
+  }
+
+  // Returns a const iterator to the first element whose key is ordered after
+  // `key`.
+  const_iterator upper_bound(const key_type &key) const {
+    return make_const_iterator(m_tree.upper_bound(key));
+  }
+
+  // Removes the element with `key`, returning how many were removed.
+  size_type erase(const key_type &key) { return m_tree.erase(key); }
+
+  // Removes the element at `position` and returns an iterator to the element
+  // after it.
+  iterator erase(const_iterator position) {
+    key_type key = position.key();
+    m_tree.erase(key);
+    return lower_bound(key);
+  }
+
+  // Swaps the contents of two maps.
+  void swap(btree_map &right) { m_tree.swap(right.m_tree); }
+
+  // Checks if this map holds the same key-value pairs as another map.
+  bool operator==(const btree_map &right) const {
+    if (size() != right.size()) return false;
+    const_iterator it = right.begin();
+    for (const_reference element : *this) {
+      if (element.first != it.key() || element.second != it.value()) {
+        return false;
+      }
+      ++it;
+    }
+    return true;
+  }
+
+  // Checks if this map differs from another map.
+  bool operator!=(const btree_map &right) const { return !(*this == right); }
+
+ private:
+  tree_type m_tree;
+
+  static iterator make_iterator(slot position) {
+    return iterator(position.leaf, position.index);
+  }
+
+  static const_iterator make_const_iterator(slot position) {
+    return const_iterator(position.leaf, position.index);
+  }
+
+  static pair<iterator, bool> make_result(pair<slot, bool> result) {
+    return pair<iterator, bool>(make_iterator(result.first), result.second);
+  }
+
+  // Returns the slot holding `key`; throws std::out_of_range if absent.
+  slot at_slot(const key_type &key) const {
+    slot position = m_tree.find(key);
+    if (make_iterator(position) == make_iterator(m_tree.end_slot())) {
+      throw std::out_of_range(
+          "Error: btree_map key not found. Please ensure the key is present "
+          "before calling at().");
+    }
+    return position;
+  }
+};
+}  // namespace open_stl
+
+#endif  // OPEN_STL_BTREE_MAP_H_
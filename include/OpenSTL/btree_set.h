@@ -0,0 +1,264 @@
+#ifndef OPEN_STL_BTREE_SET_H_
+#define OPEN_STL_BTREE_SET_H_
+
+#include <OpenSTL/functional.h>
+#include <OpenSTL/internal/btree.h>
+#include <OpenSTL/internal/iterator.h>
+#include <OpenSTL/memory.h>
+#include <OpenSTL/utility.h>
+#include <OpenSTL/vector.h>
+
+#include <cstddef>
+#include <initializer_list>
+
+namespace open_stl {
+namespace internal {
+
+/*
+    Bidirectional iterator over a btree_set, walking the linked leaves.
+
+    Template Parameters:
+        - Leaf: The leaf node type of the tree.
+
+    Keys are never modifiable through an iterator.
+*/
+template <typename Leaf>
+class btree_set_iterator {
+  using Key = typename Leaf::key_type;
+
+ public:
+  using iterator_category = bidirectional_iterator_tag;
+  using value_type = Key;
+  using difference_type = std::ptrdiff_t;
+  using reference = const Key &;
+  using pointer = const Key *;
+
+  btree_set_iterator() : m_leaf(nullptr), m_index(0) {}
+
+  btree_set_iterator(Leaf *leaf, std::size_t index)
+      : m_leaf(leaf), m_index(index) {}
+
+  reference operator*() const { return m_leaf->keys[m_index]; }
+  pointer operator->() const { return &**this; }
+
+  btree_set_iterator &operator++() {
+    btree_increment(m_leaf, m_index);
+    return *this;
+  }
+
+  btree_set_iterator operator++(int) {
+    btree_set_iterator it = *this;
+    ++(*this);
+    return it;
+  }
+
+  btree_set_iterator &operator--() {
+    btree_decrement(m_leaf, m_index);
+    return *this;
+  }
+
+  btree_set_iterator operator--(int) {
+    btree_set_iterator it = *this;
+    --(*this);
+    return it;
+  }
+
+  bool operator==(const btree_set_iterator &right) const {
+    return m_leaf == right.m_leaf && m_index == right.m_index;
+  }
+  bool operator!=(const btree_set_iterator &right) const {
+    return !(*this == right);
+  }
+
+ private:
+  Leaf *m_leaf;
+  std::size_t m_index;
+};
+
+}  // namespace internal
+
+/*
+    An ordered set stored in a B+tree.
+
+    Template Parameters:
+        - Key: The type of the keys.
+        - Compare: The ordering of the keys.
+        - Allocator: The allocator; it is rebound to allocate the nodes.
+
+    The set shares its tree with btree_map, see internal::btree. Leaves
+   hold nothing but keys, so a range scan streams through dense arrays of
+   keys. Build large sets from a sorted vector with the sorted_unique
+   constructor, which loads the tree bottom-up in O(n). Inserting or erasing
+   invalidates all iterators, and keys must be default constructible.
+*/
+template <typename Key, typename Compare = less<Key>,
+          typename Allocator = allocator<Key>>
+class btree_set {
+  using tree_type = internal::btree<Key, void, Compare, Allocator>;
+  using leaf_type = typename tree_type::leaf_type;
+  using slot = typename tree_type::slot;
+
+  static constexpr bool transparent = internal::is_transparent_v<Compare>;
+
+ public:
+  using key_type = Key;
+  using value_type = Key;
+  using key_compare = Compare;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference = const Key &;
+  using const_reference = const Key &;
+  // Keys are never modifiable through an iterator.
+  using iterator = internal::btree_set_iterator<leaf_type>;
+  using const_iterator = iterator;
+
+  // Default constructor
+  btree_set() : m_tree() {}
+
+  // Constructor taking the key ordering
+  explicit btree_set(const Compare &comp) : m_tree(comp) {}
+
+  // Constructor bulk loading a vector that is already sorted and free of
+  // duplicates, in O(n).
+  btree_set(sorted_unique_t, vector<Key> keys, const Compare &comp = Compare())
+      : m_tree(comp) {
+    size_type next = 0;
+    m_tree.bulk_load(keys.size(),
+                     [&keys, &next](leaf_type *leaf, size_type i) {
+                       leaf->keys[i] = move(keys[next++]);
+                     });
+  }
+
+  // Constructor taking a range of keys in any order.
+  template <typename InputIterator>
+  btree_set(InputIterator first, InputIterator last,
+            const Compare &comp = Compare())
+      : m_tree(comp) {
+    for (; first != last; ++first) {
+      insert(*first);
+    }
+  }
+
+  // Constructor taking an std::initializer_list of keys in any order.
+  btree_set(std::initializer_list<value_type> values,
+            const Compare &comp = Compare())
+      : btree_set(values.begin(), values.end(), comp) {}
+
+  // Returns an iterator to the first key
+  iterator begin() const { return make_iterator(m_tree.begin_slot()); }
+
+  // Returns an iterator to the first key
+  const_iterator cbegin() const { return begin(); }
+
+  // Returns an iterator past the last key
+  iterator end() const { return make_iterator(m_tree.end_slot()); }
+
+  // Returns an iterator past the last key
+  const_iterator cend() const { return end(); }
+
+  // Checks whether the set is empty
+  bool empty() const { return m_tree.size() == 0; }
+
+  // Returns the number of keys
+  size_type size() const { return m_tree.size(); }
+
+  // Returns the key ordering
+  key_compare key_comp() const { return m_tree.key_comp(); }
+
+  // Removes every key
+  void clear() { m_tree.clear(); }
+
+  // Inserts `key` unless it is present. Returns an iterator to the key and
+  // whether the insertion happened.
+  pair<iterator, bool> insert(const key_type &key) {
+    return make_result(m_tree.emplace(key));
+  }
+
+  // Inserts `key` by moving it unless it is present.
+  pair<iterator, bool> insert(key_type &&key) {
+    return make_result(m_tree.emplace(move(key)));
+  }
+
+  // Constructs a key from `args` and inserts it unless it is present.
+  template <typename... Args>
+  pair<iterator, bool> emplace(Args &&...args) {
+    return make_result(m_tree.emplace(Key(open_stl::forward<Args>(args)...)));
+  }
+
+  // Returns an iterator to `key`, or end().
+  iterator find(const key_type &key) const {
+    return make_iterator(m_tree.find(key));
+  }
+
+  // Heterogeneous overload of find(), enabled for a transparent Compare.
+  template <typename K>
+    requires transparent
+  iterator find(const K &key) const {
+    return make_iterator(m_tree.find(key));
+  }
+
+  // Checks whether `key` is present.
+  bool contains(const key_type &key) const { return find(key) != end(); }
+
+  // Heterogeneous overload of contains(), enabled for a transparent Compare.
+  template <typename K>
+    requires transparent
+  bool contains(const K &key) const {
+    return find(key) != end();
+  }
+
+  // Returns the number of keys equivalent to `key`, which is 0 or 1.
+  size_type count(const key_type &key) const { return contains(key) ? 1 : 0; }
+
+  // Returns an iterator to the first key not ordered before `key`.
+  iterator lower_bound(const key_type &key) const {
+    return make_iterator(m_tree.lower_bound(key));
+  }
+
+  // Returns an iterator to the first key ordered after `key`.
+  iterator upper_bound(const key_type &key) const {
+    return make_iterator(m_tree.upper_bound(key));
+  }
+
+  // Removes `key`, returning how many keys were removed.
+  size_type erase(const key_type &key) { return m_tree.erase(key); }
+
+  // Removes the key at `position` and returns an iterator to the key after
+  // it.
+  iterator erase(const_iterator position) {
+    key_type key = *position;
+    m_tree.erase(key);
+    return lower_bound(key);
+  }
+
+  // Swaps the contents of two sets.
+  void swap(btree_set &right) { m_tree.swap(right.m_tree); }
+
+  // Checks if this set holds the same keys as another set.
+  bool operator==(const btree_set &right) const {
+    if (size() != right.size()) return false;
+    iterator it = right.begin();
+    for (const Key &key : *this) {
+      if (key != *it) return false;
+      ++it;
+    }
+    return true;
+  }
+
+  // Checks if this set differs from another set.
+  bool operator!=(const btree_set &right) const { return !(*this == right); }
+
+ private:
+  tree_type m_tree;
+
+  static iterator make_iterator(slot position) {
+    return iterator(position.leaf, position.index);
+  }
+
+  static pair<iterator, bool> make_result(pair<slot, bool> result) {
+    return pair<iterator, bool>(make_iterator(result.first), result.second);
+  }
+};
+}  // namespace open_stl
+
+#endif  // OPEN_STL_BTREE_SET_H_
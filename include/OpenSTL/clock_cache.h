@@ -0,0 +1,337 @@
+#ifndef OPEN_STL_CLOCK_CACHE_H_
+#define OPEN_STL_CLOCK_CACHE_H_
+
+#include <OpenSTL/flat_hash_map.h>
+#include <OpenSTL/functional.h>
+#include <OpenSTL/hash.h>
+#include <OpenSTL/internal/prefetch.h>
+#include <OpenSTL/internal/raw_hash_table.h>
+#include <OpenSTL/memory.h>
+#include <OpenSTL/utility.h>
+#include <OpenSTL/vector.h>
+
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <shared_mutex>
+
+namespace open_stl {
+// Counters of a clock_cache, summed over its shards.
+struct cache_stats {
+  std::uint64_t hits;
+  std::uint64_t misses;
+  std::uint64_t evictions;
+};
+
+namespace internal {
+
+/*
+    One shard of a clock_cache: a fixed slab of entries, a hash index into
+   it and the CLOCK state.
+
+    Slot i of the slab holds keys[i], values[i] and its reference bit. The
+   slab is sized once, so entries never move and a put allocates nothing
+   unless the index has to grow.
+*/
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+struct alignas(cache_line_size) clock_cache_shard {
+  template <typename U>
+  using rebound = typename Allocator::template rebind<U>::other;
+
+  // Held shared by lookups and exclusively by everything that changes the
+  // index or the slab.
+  mutable std::shared_mutex mutex;
+  flat_hash_map<Key, std::size_t, Hash, KeyEqual,
+                rebound<pair<Key, std::size_t>>>
+      index;
+  vector<Key, rebound<Key>> keys;
+  vector<T, rebound<T>> values;
+  // Set by a hit, under the shared lock, through std::atomic_ref.
+  vector<unsigned char, rebound<unsigned char>> referenced;
+  // Slots holding no entry; the clock hand only runs once it is empty.
+  vector<std::size_t, rebound<std::size_t>> free_slots;
+  std::size_t capacity = 0;
+  std::size_t hand = 0;
+  std::atomic<std::uint64_t> hits{0};
+  std::atomic<std::uint64_t> misses{0};
+  std::atomic<std::uint64_t> evictions{0};
+};
+
+}  // namespace internal
+
+/*
+    A bounded, thread-safe key-value cache with CLOCK eviction.
+
+    Template Parameters:
+        - Key: The type of the keys.
+        - T: The type of the cached values.
+        - Hash: The hash function object.
+        - KeyEqual: The key equality function object.
+        - Allocator: The allocator; it is rebound to allocate the shards and
+       their slabs.
+
+    The cache is split into a power-of-two number of shards, chosen by the
+   top bits of the key's hash, each with its own lock, so threads working
+   on different keys rarely meet. Within a shard the entries sit in a slab
+   of parallel vectors allocated up front, indexed by a flat_hash_map from
+   key to slot: a put costs no allocation per entry, unlike a hash map of
+   list nodes.
+
+    Eviction is CLOCK, an approximation of LRU: a hit only sets the entry's
+   reference bit, and when a full shard needs a slot its hand sweeps the
+   slab, clearing set bits and evicting the first entry whose bit is
+   already clear. Because a hit does not reorder anything, get() takes the
+   shard lock shared and lookups of one shard proceed in parallel; only
+   put() and erase() take it exclusively. Hits, misses and evictions are
+   counted per shard; see stats().
+
+    Every shard holds capacity / shards entries, so a shard can evict while
+   others still have room; with many more entries than shards the
+   difference is negligible. Keys and values must be default constructible
+   and copy assignable; get() returns a copy, since a reference could be
+   evicted under the caller.
+*/
+template <typename Key, typename T, typename Hash = hash<Key>,
+          typename KeyEqual = equal_to<Key>,
+          typename Allocator = allocator<pair<Key, T>>>
+class clock_cache {
+  using shard_type =
+      internal::clock_cache_shard<Key, T, Hash, KeyEqual, Allocator>;
+  using shard_allocator =
+      typename Allocator::template rebind<shard_type>::other;
+
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using size_type = std::size_t;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+  using allocator_type = Allocator;
+
+  /*
+      Constructor taking the capacity and the number of shards.
+
+      Parameters:
+          - capacity: The maximum number of entries.
+          - shards: The number of shards, rounded up to a power of two and
+         down to at most `capacity`.
+          - hash: The hash function object.
+          - eq: The key equality function object.
+  */
+  explicit clock_cache(size_type capacity, size_type shards = 16,
+                       const Hash &hash = Hash(),
+                       const KeyEqual &eq = KeyEqual())
+      : m_shards(nullptr), m_shard_bits(0), m_hash(hash) {
+    size_type count = std::bit_ceil(shards < 1 ? size_type(1) : shards);
+    size_type limit = std::bit_floor(capacity < 1 ? size_type(1) : capacity);
+    if (count > limit) count = limit;
+    m_shard_bits = std::countr_zero(count);
+
+    shard_allocator alloc;
+    m_shards = alloc.allocate(count);
+    for (size_type i = 0; i < count; i++) {
+      shard_type &shard = m_shards[i];
+      // Spread the remainder over the first shards.
+      shard.capacity = capacity / count + (i < capacity % count ? 1 : 0);
+      shard.index = decltype(shard.index)(shard.capacity, hash, eq);
+      shard.keys.resize(shard.capacity);
+      shard.values.resize(shard.capacity);
+      shard.referenced.resize(shard.capacity);
+      shard.free_slots.reserve(shard.capacity);
+      for (size_type slot = shard.capacity; slot > 0; slot--) {
+        shard.free_slots.push_back(slot - 1);
+      }
+    }
+  }
+
+  clock_cache(const clock_cache &) = delete;
+  clock_cache &operator=(const clock_cache &) = delete;
+
+  // Destructor
+  ~clock_cache() {
+    shard_allocator alloc;
+    alloc.deallocate(m_shards);
+  }
+
+  // Returns the maximum number of entries
+  size_type capacity() const {
+    size_type total = 0;
+    for (size_type i = 0; i < shard_count(); i++) {
+      total += m_shards[i].capacity;
+    }
+    return total;
+  }
+
+  // Returns the number of shards
+  size_type shard_count() const { return size_type(1) << m_shard_bits; }
+
+  // Returns the number of entries at some instant during the call
+  size_type size() const {
+    size_type total = 0;
+    for (size_type i = 0; i < shard_count(); i++) {
+      std::shared_lock<std::shared_mutex> lock(m_shards[i].mutex);
+      total += m_shards[i].index.size();
+    }
+    return total;
+  }
+
+  // Checks whether the cache was empty at some instant during the call
+  bool empty() const { return size() == 0; }
+
+  /*
+      Looks up a key, in O(1).
+
+      Parameters:
+          - key: The key to look up.
+          - value: Receives a copy of the cached value on a hit.
+
+      Returns:
+          - True on a hit. A hit marks the entry as recently used; either
+         outcome is counted.
+  */
+  bool get(const key_type &key, mapped_type &value) const {
+    shard_type &shard = shard_for(key);
+    std::shared_lock<std::shared_mutex> lock(shard.mutex);
+    auto it = shard.index.find(key);
+    if (it == shard.index.end()) {
+      shard.misses.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    }
+    size_type slot = it->second;
+    value = shard.values[slot];
+    // Other readers may set the same bit; skip the store if it is set, so a
+    // hot entry's cache line is not written on every hit.
+    std::atomic_ref<unsigned char> bit(shard.referenced[slot]);
+    if (bit.load(std::memory_order_relaxed) == 0) {
+      bit.store(1, std::memory_order_relaxed);
+    }
+    shard.hits.fetch_add(1, std::memory_order_relaxed);
+    return true;
+  }
+
+  // Checks whether `key` is cached, without counting or marking it.
+  bool contains(const key_type &key) const {
+    shard_type &shard = shard_for(key);
+    std::shared_lock<std::shared_mutex> lock(shard.mutex);
+    return shard.index.find(key) != shard.index.end();
+  }
+
+  /*
+      Caches `value` under `key`, in amortized O(1).
+
+      Returns:
+          - True if the key was inserted, false if an existing entry was
+         overwritten. Inserting into a full shard evicts one entry of that
+         shard.
+  */
+  bool put(const key_type &key, const mapped_type &value) {
+    shard_type &shard = shard_for(key);
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);
+    auto it = shard.index.find(key);
+    if (it != shard.index.end()) {
+      shard.values[it->second] = value;
+      shard.referenced[it->second] = 1;
+      return false;
+    }
+    if (shard.capacity == 0) return false;
+    size_type slot;
+    if (!shard.free_slots.empty()) {
+      slot = shard.free_slots.back();
+      shard.free_slots.pop_back();
+    } else {
+      slot = evict(shard);
+    }
+    shard.keys[slot] = key;
+    shard.values[slot] = value;
+    // A new entry must be hit once before it survives a sweep of the hand.
+    shard.referenced[slot] = 0;
+    shard.index.insert(pair<Key, size_type>(key, slot));
+    return true;
+  }
+
+  // Removes `key`, returning whether it was cached.
+  bool erase(const key_type &key) {
+    shard_type &shard = shard_for(key);
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);
+    auto it = shard.index.find(key);
+    if (it == shard.index.end()) return false;
+    size_type slot = it->second;
+    shard.index.erase(key);
+    release_slot(shard, slot);
+    return true;
+  }
+
+  // Removes every entry. The counters are kept.
+  void clear() {
+    for (size_type i = 0; i < shard_count(); i++) {
+      shard_type &shard = m_shards[i];
+      std::unique_lock<std::shared_mutex> lock(shard.mutex);
+      for (auto element : shard.index) {
+        release_slot(shard, element.second);
+      }
+      shard.index.clear();
+      shard.hand = 0;
+    }
+  }
+
+  // Returns the hit, miss and eviction counts summed over the shards.
+  cache_stats stats() const {
+    cache_stats total{0, 0, 0};
+    for (size_type i = 0; i < shard_count(); i++) {
+      total.hits += m_shards[i].hits.load(std::memory_order_relaxed);
+      total.misses += m_shards[i].misses.load(std::memory_order_relaxed);
+      total.evictions += m_shards[i].evictions.load(std::memory_order_relaxed);
+    }
+    return total;
+  }
+
+ private:
+  shard_type *m_shards;
+  int m_shard_bits;
+  Hash m_hash;
+
+  // Picks a shard by the top bits of the hash. flat_hash_map indexes with
+  // the low bits, so the two choices stay independent.
+  shard_type &shard_for(const key_type &key) const {
+    size_type hash = m_hash(key);
+    if constexpr (!requires { typename Hash::is_avalanching; }) {
+      hash = internal::mix_hash(hash);
+    }
+    if (m_shard_bits == 0) return m_shards[0];
+    return m_shards[hash >> (std::numeric_limits<size_type>::digits -
+                             m_shard_bits)];
+  }
+
+  // Advances the hand of a full shard to an entry that has not been hit
+  // since the hand last passed it, removes that entry from the index and
+  // returns its slot. Hit entries passed on the way lose their bit.
+  static size_type evict(shard_type &shard) {
+    while (true) {
+      size_type slot = shard.hand;
+      shard.hand = slot + 1 == shard.capacity ? 0 : slot + 1;
+      if (shard.referenced[slot] != 0) {
+        shard.referenced[slot] = 0;
+        continue;
+      }
+      shard.index.erase(shard.keys[slot]);
+      shard.evictions.fetch_add(1, std::memory_order_relaxed);
+      return slot;
+    }
+  }
+
+  // Resets an emptied slot, releasing what its key and value held, and
+  // returns it to the free list.
+  static void release_slot(shard_type &shard, size_type slot) {
+    shard.keys[slot] = Key();
+    shard.values[slot] = T();
+    shard.referenced[slot] = 0;
+    shard.free_slots.push_back(slot);
+  }
+};
+}  // namespace open_stl
+
+#endif  // OPEN_STL_CLOCK_CACHE_H_
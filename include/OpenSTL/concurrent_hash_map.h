@@ -0,0 +1,731 @@
+#ifndef OPEN_STL_CONCURRENT_HASH_MAP_H_
+#define OPEN_STL_CONCURRENT_HASH_MAP_H_
+
+#include <OpenSTL/functional.h>
+#include <OpenSTL/hash.h>
+#include <OpenSTL/internal/prefetch.h>
+#include <OpenSTL/internal/raw_hash_table.h>
+#include <OpenSTL/memory.h>
+#include <OpenSTL/utility.h>
+
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <limits>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+
+namespace open_stl {
+namespace internal {
+
+// The unit in which concurrent_hash_map copies keys and values, so that a
+// reader racing with a writer performs only atomic loads.
+using concurrent_word = std::uintptr_t;
+
+// Number of words needed to hold a U.
+template <typename U>
+inline constexpr std::size_t concurrent_word_count =
+    (sizeof(U) + sizeof(concurrent_word) - 1) / sizeof(concurrent_word);
+
+/*
+    A bucket of concurrent_hash_map: a few entries guarded by a sequence
+   lock.
+
+    A writer makes `sequence` odd before changing the bucket and even again
+   afterwards; a reader copies what it needs and retries if the sequence was
+   odd or changed meanwhile. A tag of zero marks a free slot; otherwise it
+   holds the top bits of the entry's hash. `moved` is set once a resize has
+   copied the bucket into the next table.
+
+    When both buckets of a key are full, the entry goes into a chain of
+   overflow buckets hanging off its first bucket. The chain is part of that
+   bucket: its entries are written under the bucket's sequence lock, and its
+   `sequence` and `moved` fields are unused.
+*/
+template <typename Key, typename T>
+struct alignas(cache_line_size) concurrent_bucket {
+  static constexpr std::size_t slots = 8;
+  static constexpr std::size_t key_words = concurrent_word_count<Key>;
+  static constexpr std::size_t value_words = concurrent_word_count<T>;
+
+  std::atomic<std::uint32_t> sequence{0};
+  std::atomic<bool> moved{false};
+  std::atomic<concurrent_bucket *> overflow{nullptr};
+  std::atomic<std::uint8_t> tags[slots];
+  std::atomic<concurrent_word> keys[slots][key_words];
+  std::atomic<concurrent_word> values[slots][value_words];
+};
+
+// A bucket array of concurrent_hash_map. A resize links the table to its
+// successor before moving any bucket, and the table stays allocated until
+// the map is destroyed, since lock-free readers may still be inside it.
+template <typename Bucket>
+struct concurrent_table {
+  Bucket *buckets = nullptr;
+  std::size_t mask = 0;
+  std::atomic<concurrent_table *> next{nullptr};
+};
+
+// A writer lock of concurrent_hash_map, on its own cache line.
+struct alignas(cache_line_size) concurrent_stripe {
+  std::mutex mutex;
+};
+
+// Copies the `size` bytes at `source` into words, with relaxed stores.
+inline void store_words(std::atomic<concurrent_word> *destination,
+                        const void *source, std::size_t size) {
+  const unsigned char *bytes = static_cast<const unsigned char *>(source);
+  for (std::size_t offset = 0; offset < size;
+       offset += sizeof(concurrent_word)) {
+    concurrent_word word = 0;
+    std::size_t count = size - offset < sizeof(word) ? size - offset
+                                                     : sizeof(word);
+    std::memcpy(&word, bytes + offset, count);
+    destination[offset / sizeof(word)].store(word, std::memory_order_relaxed);
+  }
+}
+
+// Copies words, read with relaxed loads, into the `size` bytes at
+// `destination`.
+inline void load_words(void *destination,
+                       const std::atomic<concurrent_word> *source,
+                       std::size_t size) {
+  unsigned char *bytes = static_cast<unsigned char *>(destination);
+  for (std::size_t offset = 0; offset < size;
+       offset += sizeof(concurrent_word)) {
+    concurrent_word word =
+        source[offset / sizeof(word)].load(std::memory_order_relaxed);
+    std::size_t count = size - offset < sizeof(word) ? size - offset
+                                                     : sizeof(word);
+    std::memcpy(bytes + offset, &word, count);
+  }
+}
+
+}  // namespace internal
+
+/*
+    A hash map for many threads in which lookups take no lock.
+
+    Template Parameters:
+        - Key: The type of the keys; trivially copyable and default
+       constructible.
+        - T: The type of the mapped values; trivially copyable and default
+       constructible.
+        - Hash: The hash function object.
+        - KeyEqual: The key equality function object.
+        - Allocator: The allocator; it is rebound to allocate the tables and
+       the stripes.
+
+    Entries live in cache-line-aligned buckets of eight slots, and every key
+   may go into one of two buckets picked by independent bits of its hash,
+   the emptier one on insertion. If both are full the entry is chained to
+   an overflow bucket instead, so a Hash that sends many keys to the same
+   value only makes their lookups slower. Each bucket is guarded by a
+   sequence lock: find() copies the key and value out with plain atomic
+   loads and retries if a writer touched the bucket meanwhile, so readers
+   never write shared memory and never wait for each other. This is why
+   keys and values must be trivially copyable: a reader may copy a
+   half-written entry before it notices the race and throws the copy away,
+   and KeyEqual must tolerate being called on such a copy.
+
+    Writers lock the stripes that own their key's two buckets, a bucket
+   belonging to stripe (index % stripes), so writers of different stripes
+   run in parallel. compute(), update() and merge() apply a function to an
+   entry under those locks, which makes read-modify-write atomic.
+
+    When the table passes three quarters full it grows online: the writer
+   that noticed links a table of twice the size to the current one and
+   migrates it one stripe at a time, and any writer that locks a stripe
+   during the migration first moves that stripe itself. Readers are never
+   blocked: a moved bucket sends them on to the next table. Because readers
+   hold no reference to a table, replaced tables are only freed with the
+   map; as tables double, this at most doubles the memory footprint.
+*/
+template <typename Key, typename T, typename Hash = hash<Key>,
+          typename KeyEqual = equal_to<Key>,
+          typename Allocator = allocator<pair<Key, T>>>
+class concurrent_hash_map {
+  static_assert(std::is_trivially_copyable_v<Key> &&
+                    std::is_trivially_copyable_v<T>,
+                "concurrent_hash_map requires trivially copyable keys and "
+                "values");
+
+  using bucket_type = internal::concurrent_bucket<Key, T>;
+  using table_type = internal::concurrent_table<bucket_type>;
+  using stripe_type = internal::concurrent_stripe;
+
+  template <typename U>
+  using rebound = typename Allocator::template rebind<U>::other;
+
+  static constexpr std::size_t bucket_slots = bucket_type::slots;
+  static constexpr int hash_bits = std::numeric_limits<std::size_t>::digits;
+
+  // What a modification does to the entry it looked at.
+  enum class action { keep, assign, erase };
+
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using size_type = std::size_t;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+  using allocator_type = Allocator;
+
+  /*
+      Constructor taking the expected number of entries and of stripes.
+
+      Parameters:
+          - capacity: The number of entries to make room for up front.
+          - stripes: The number of writer locks, rounded up to a power of
+         two.
+          - hash: The hash function object.
+          - eq: The key equality function object.
+  */
+  explicit concurrent_hash_map(size_type capacity = 0, size_type stripes = 64,
+                               const Hash &hash = Hash(),
+                               const KeyEqual &eq = KeyEqual())
+      : m_table(nullptr),
+        m_oldest(nullptr),
+        m_stripes(nullptr),
+        m_stripe_mask(std::bit_ceil(stripes < 1 ? size_type(1) : stripes) -
+                      1),
+        m_size(0),
+        m_hash(hash),
+        m_eq(eq) {
+    rebound<stripe_type> alloc;
+    m_stripes = alloc.allocate(m_stripe_mask + 1);
+    // Every stripe owns at least one bucket, and a table keeps the stripe
+    // of each bucket when it doubles.
+    size_type buckets = capacity * 4 / (bucket_slots * 3) + 1;
+    if (buckets < m_stripe_mask + 1) buckets = m_stripe_mask + 1;
+    m_oldest = make_table(std::bit_ceil(buckets));
+    m_table.store(m_oldest, std::memory_order_release);
+  }
+
+  concurrent_hash_map(const concurrent_hash_map &) = delete;
+  concurrent_hash_map &operator=(const concurrent_hash_map &) = delete;
+
+  // Destructor
+  ~concurrent_hash_map() {
+    rebound<bucket_type> bucket_alloc;
+    rebound<table_type> table_alloc;
+    table_type *table = m_oldest;
+    while (table != nullptr) {
+      table_type *next = table->next.load(std::memory_order_relaxed);
+      for (size_type index = 0; index <= table->mask; index++) {
+        bucket_type *link =
+            table->buckets[index].overflow.load(std::memory_order_relaxed);
+        while (link != nullptr) {
+          bucket_type *after = link->overflow.load(std::memory_order_relaxed);
+          bucket_alloc.deallocate(link);
+          link = after;
+        }
+      }
+      bucket_alloc.deallocate(table->buckets);
+      table_alloc.deallocate(table);
+      table = next;
+    }
+    rebound<stripe_type> stripe_alloc;
+    stripe_alloc.deallocate(m_stripes);
+  }
+
+  // Returns the number of entries at some instant during the call
+  size_type size() const { return m_size.load(std::memory_order_relaxed); }
+
+  // Checks whether the map was empty at some instant during the call
+  bool empty() const { return size() == 0; }
+
+  // Returns the number of entries the current table holds before growing
+  size_type capacity() const {
+    return max_load(*m_table.load(std::memory_order_acquire));
+  }
+
+  // Returns the number of writer locks
+  size_type stripe_count() const { return m_stripe_mask + 1; }
+
+  /*
+      Looks up a key without taking any lock.
+
+      Parameters:
+          - key: The key to look up.
+          - value: Receives a copy of the mapped value if the key is found.
+
+      Returns:
+          - True if the key was found.
+  */
+  bool find(const key_type &key, mapped_type &value) const {
+    size_type hash = hash_of(key);
+    const table_type *table = m_table.load(std::memory_order_acquire);
+    return read(table, hash, hash, key, value) ||
+           read(table, second_index(hash), hash, key, value);
+  }
+
+  // Checks whether `key` is in the map, without taking any lock.
+  bool contains(const key_type &key) const {
+    mapped_type value;
+    return find(key, value);
+  }
+
+  // Inserts `value` under `key` unless the key is present. Returns whether
+  // it was inserted.
+  bool insert(const key_type &key, const mapped_type &value) {
+    bool inserted = false;
+    modify(key, true,
+           [&value, &inserted](mapped_type &current, bool present) {
+             if (present) return action::keep;
+             inserted = true;
+             current = value;
+             return action::assign;
+           });
+    return inserted;
+  }
+
+  // Stores `value` under `key`. Returns true if the key was inserted, false
+  // if an existing value was overwritten.
+  bool insert_or_assign(const key_type &key, const mapped_type &value) {
+    bool inserted = false;
+    modify(key, true,
+           [&value, &inserted](mapped_type &current, bool present) {
+             inserted = !present;
+             current = value;
+             return action::assign;
+           });
+    return inserted;
+  }
+
+  // Removes `key`, returning whether it was present.
+  bool erase(const key_type &key) {
+    bool erased = false;
+    modify(key, false, [&erased](mapped_type &, bool) {
+      erased = true;
+      return action::erase;
+    });
+    return erased;
+  }
+
+  /*
+      Atomically computes the entry of a key.
+
+      Parameters:
+          - key: The key.
+          - f: Called as f(value, present) with the stripe locks held, where
+         `value` is the mapped value, or a default-constructed one if the
+         key is absent. It may change `value` and returns whether the entry
+         should exist afterwards. It must not call back into the map.
+
+      Returns:
+          - Whether the key is present afterwards.
+  */
+  template <typename F>
+  bool compute(const key_type &key, F f) {
+    bool kept = false;
+    modify(key, true, [&f, &kept](mapped_type &value, bool present) {
+      kept = f(value, present);
+      if (kept) return action::assign;
+      return present ? action::erase : action::keep;
+    });
+    return kept;
+  }
+
+  // Atomically applies f(value) to the value of `key` if it is present.
+  // Returns whether it was.
+  template <typename F>
+  bool update(const key_type &key, F f) {
+    bool found = false;
+    modify(key, false, [&f, &found](mapped_type &value, bool) {
+      found = true;
+      f(value);
+      return action::assign;
+    });
+    return found;
+  }
+
+  /*
+      Atomically merges a value into the entry of a key.
+
+      Parameters:
+          - key: The key.
+          - value: Inserted if the key is absent.
+          - f: Otherwise the entry becomes f(old value, value).
+
+      Returns:
+          - The value stored under the key.
+  */
+  template <typename F>
+  mapped_type merge(const key_type &key, const mapped_type &value, F f) {
+    mapped_type result;
+    modify(key, true,
+           [&value, &f, &result](mapped_type &current, bool present) {
+             current = present ? f(current, value) : value;
+             result = current;
+             return action::assign;
+           });
+    return result;
+  }
+
+  // Removes every entry. Runs exclusively with writers but not readers,
+  // which see each bucket either before or after it is emptied.
+  void clear() {
+    std::lock_guard<std::mutex> resize_lock(m_resize_mutex);
+    for (size_type i = 0; i <= m_stripe_mask; i++) {
+      m_stripes[i].mutex.lock();
+    }
+    table_type &table = *m_table.load(std::memory_order_relaxed);
+    for (size_type index = 0; index <= table.mask; index++) {
+      bucket_type &bucket = table.buckets[index];
+      begin_write(bucket);
+      for (bucket_type *link = &bucket; link != nullptr;
+           link = link->overflow.load(std::memory_order_relaxed)) {
+        for (size_type slot = 0; slot < bucket_slots; slot++) {
+          link->tags[slot].store(0, std::memory_order_relaxed);
+        }
+      }
+      end_write(bucket);
+    }
+    m_size.store(0, std::memory_order_relaxed);
+    for (size_type i = 0; i <= m_stripe_mask; i++) {
+      m_stripes[i].mutex.unlock();
+    }
+  }
+
+ private:
+  // A slot of a bucket, or no slot when `bucket` is null. `owner` is the
+  // table bucket whose sequence lock guards the slot: `bucket` itself, or
+  // the bucket whose overflow chain `bucket` belongs to.
+  struct location {
+    bucket_type *bucket;
+    size_type slot;
+    bucket_type *owner;
+  };
+
+  // Holds the stripe locks of a key's two buckets, taken in index order.
+  class stripe_guard {
+   public:
+    stripe_guard(stripe_type *stripes, size_type first, size_type second)
+        : m_first(&stripes[first < second ? first : second].mutex),
+          m_second(first == second
+                       ? nullptr
+                       : &stripes[first < second ? second : first].mutex) {
+      m_first->lock();
+      if (m_second != nullptr) m_second->lock();
+    }
+
+    stripe_guard(const stripe_guard &) = delete;
+    stripe_guard &operator=(const stripe_guard &) = delete;
+
+    ~stripe_guard() { unlock(); }
+
+    void unlock() {
+      if (m_second != nullptr) m_second->unlock();
+      if (m_first != nullptr) m_first->unlock();
+      m_first = m_second = nullptr;
+    }
+
+   private:
+    std::mutex *m_first;
+    std::mutex *m_second;
+  };
+
+  // The newest table; replaced once a resize has moved every bucket.
+  std::atomic<table_type *> m_table;
+  // The first table of the chain, for the destructor.
+  table_type *m_oldest;
+  stripe_type *m_stripes;
+  size_type m_stripe_mask;
+  std::atomic<size_type> m_size;
+  // Serializes resizes and clear().
+  std::mutex m_resize_mutex;
+  Hash m_hash;
+  KeyEqual m_eq;
+
+  size_type hash_of(const key_type &key) const {
+    if constexpr (requires { typename Hash::is_avalanching; }) {
+      return m_hash(key);
+    } else {
+      return internal::mix_hash(m_hash(key));
+    }
+  }
+
+  // The first bucket of a key is indexed by the low bits of its hash, the
+  // second by the high bits, so the two are independent.
+  static size_type second_index(size_type hash) {
+    return std::rotl(hash, hash_bits / 2);
+  }
+
+  // Marks an occupied slot with the top bits of the hash.
+  static std::uint8_t tag_of(size_type hash) {
+    return std::uint8_t(0x80 | (hash >> (hash_bits - 7)));
+  }
+
+  static size_type max_load(const table_type &table) {
+    return (table.mask + 1) * bucket_slots * 3 / 4;
+  }
+
+  table_type *make_table(size_type buckets) {
+    rebound<table_type> table_alloc;
+    rebound<bucket_type> bucket_alloc;
+    table_type *table = table_alloc.allocate(1);
+    table->buckets = bucket_alloc.allocate(buckets);
+    table->mask = buckets - 1;
+    return table;
+  }
+
+  static void begin_write(bucket_type &bucket) {
+    std::uint32_t sequence = bucket.sequence.load(std::memory_order_relaxed);
+    bucket.sequence.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+  }
+
+  static void end_write(bucket_type &bucket) {
+    std::uint32_t sequence = bucket.sequence.load(std::memory_order_relaxed);
+    bucket.sequence.store(sequence + 1, std::memory_order_release);
+  }
+
+  static key_type load_key(const bucket_type &bucket, size_type slot) {
+    key_type key;
+    internal::load_words(&key, bucket.keys[slot], sizeof(Key));
+    return key;
+  }
+
+  static void store_entry(bucket_type &bucket, size_type slot,
+                          std::uint8_t tag, const key_type &key,
+                          const mapped_type &value) {
+    internal::store_words(bucket.keys[slot], &key, sizeof(Key));
+    internal::store_words(bucket.values[slot], &value, sizeof(T));
+    bucket.tags[slot].store(tag, std::memory_order_relaxed);
+  }
+
+  /*
+      Looks for a key in the bucket `index` selects, following moved
+     buckets into newer tables, under the sequence lock only.
+
+      Returns:
+          - True if the key was found, with its value copied to `value`.
+  */
+  bool read(const table_type *table, size_type index, size_type hash,
+            const key_type &key, mapped_type &value) const {
+    std::uint8_t tag = tag_of(hash);
+    while (true) {
+      const bucket_type &bucket = table->buckets[index & table->mask];
+      int spins = 0;
+      while (true) {
+        std::uint32_t before = bucket.sequence.load(std::memory_order_acquire);
+        if ((before & 1) != 0) {
+          // A writer holds the bucket for a few stores; let it finish.
+          if (++spins > 64) std::this_thread::yield();
+          continue;
+        }
+        bool moved = bucket.moved.load(std::memory_order_relaxed);
+        bool found = false;
+        for (const bucket_type *link = moved ? nullptr : &bucket;
+             !found && link != nullptr;
+             link = link->overflow.load(std::memory_order_acquire)) {
+          for (size_type slot = 0; slot < bucket_slots; slot++) {
+            if (link->tags[slot].load(std::memory_order_relaxed) != tag) {
+              continue;
+            }
+            if (m_eq(load_key(*link, slot), key)) {
+              internal::load_words(&value, link->values[slot], sizeof(T));
+              found = true;
+              break;
+            }
+          }
+        }
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (bucket.sequence.load(std::memory_order_relaxed) != before) {
+          continue;
+        }
+        if (!moved) return found;
+        break;
+      }
+      table = table->next.load(std::memory_order_acquire);
+    }
+  }
+
+  // Finds the slot holding `key` in one of its buckets, with the stripe
+  // locks held.
+  location locate(table_type &table, size_type hash, const key_type &key) {
+    std::uint8_t tag = tag_of(hash);
+    for (size_type index : {hash, second_index(hash)}) {
+      bucket_type &bucket = table.buckets[index & table.mask];
+      for (bucket_type *link = &bucket; link != nullptr;
+           link = link->overflow.load(std::memory_order_relaxed)) {
+        for (size_type slot = 0; slot < bucket_slots; slot++) {
+          if (link->tags[slot].load(std::memory_order_relaxed) == tag &&
+              m_eq(load_key(*link, slot), key)) {
+            return location{link, slot, &bucket};
+          }
+        }
+      }
+    }
+    return location{nullptr, 0, nullptr};
+  }
+
+  // Finds a free slot in the emptier of the two buckets of `hash`, or in
+  // the overflow chain of the first if both are full.
+  static location free_slot(table_type &table, size_type hash) {
+    location best{nullptr, 0, nullptr};
+    size_type best_used = bucket_slots;
+    for (size_type index : {hash, second_index(hash)}) {
+      bucket_type &bucket = table.buckets[index & table.mask];
+      size_type used = 0;
+      size_type free = bucket_slots;
+      for (size_type slot = 0; slot < bucket_slots; slot++) {
+        if (bucket.tags[slot].load(std::memory_order_relaxed) != 0) {
+          used++;
+        } else if (free == bucket_slots) {
+          free = slot;
+        }
+      }
+      if (used < best_used) {
+        best = location{&bucket, free, &bucket};
+        best_used = used;
+      }
+    }
+    if (best.bucket == nullptr) {
+      return overflow_slot(table.buckets[hash & table.mask]);
+    }
+    return best;
+  }
+
+  // Finds a free slot in the overflow chain of `bucket`, appending a new
+  // overflow bucket if the chain is full. The stripe lock must be held.
+  static location overflow_slot(bucket_type &bucket) {
+    bucket_type *link = &bucket;
+    while (bucket_type *next = link->overflow.load(std::memory_order_relaxed)) {
+      link = next;
+      for (size_type slot = 0; slot < bucket_slots; slot++) {
+        if (link->tags[slot].load(std::memory_order_relaxed) == 0) {
+          return location{link, slot, &bucket};
+        }
+      }
+    }
+    // Readers may follow the new link at once; they see an empty bucket.
+    rebound<bucket_type> bucket_alloc;
+    bucket_type *added = bucket_alloc.allocate(1);
+    link->overflow.store(added, std::memory_order_release);
+    return location{added, 0, &bucket};
+  }
+
+  // Moves every bucket of `stripe` from `from` into its successor, unless
+  // that was done already. The stripe lock must be held.
+  void migrate_stripe(table_type &from, size_type stripe) {
+    if (from.buckets[stripe].moved.load(std::memory_order_relaxed)) return;
+    table_type &to = *from.next.load(std::memory_order_acquire);
+    for (size_type index = stripe; index <= from.mask;
+         index += m_stripe_mask + 1) {
+      bucket_type &bucket = from.buckets[index];
+      begin_write(bucket);
+      for (bucket_type *link = &bucket; link != nullptr;
+           link = link->overflow.load(std::memory_order_relaxed)) {
+        for (size_type slot = 0; slot < bucket_slots; slot++) {
+          std::uint8_t tag = link->tags[slot].load(std::memory_order_relaxed);
+          if (tag == 0) continue;
+          key_type key = load_key(*link, slot);
+          mapped_type value;
+          internal::load_words(&value, link->values[slot], sizeof(T));
+          // Keep the entry under the same choice of bucket: its new bucket
+          // then belongs to the same stripe and is fed by this bucket alone,
+          // so it only overflows if this bucket did.
+          size_type hash = hash_of(key);
+          size_type target =
+              (hash & from.mask) == index ? hash : second_index(hash);
+          bucket_type &destination = to.buckets[target & to.mask];
+          location at{nullptr, 0, &destination};
+          for (size_type free = 0; free < bucket_slots; free++) {
+            if (destination.tags[free].load(std::memory_order_relaxed) == 0) {
+              at = location{&destination, free, &destination};
+              break;
+            }
+          }
+          if (at.bucket == nullptr) at = overflow_slot(destination);
+          begin_write(destination);
+          store_entry(*at.bucket, at.slot, tag, key, value);
+          end_write(destination);
+        }
+      }
+      bucket.moved.store(true, std::memory_order_relaxed);
+      end_write(bucket);
+    }
+  }
+
+  // Doubles `from`, unless another thread replaced it already, moving one
+  // stripe at a time while other stripes stay available to writers.
+  void grow(table_type &from) {
+    std::lock_guard<std::mutex> resize_lock(m_resize_mutex);
+    if (m_table.load(std::memory_order_relaxed) != &from) return;
+    table_type *to = make_table(2 * (from.mask + 1));
+    from.next.store(to, std::memory_order_release);
+    for (size_type stripe = 0; stripe <= m_stripe_mask; stripe++) {
+      std::lock_guard<std::mutex> stripe_lock(m_stripes[stripe].mutex);
+      migrate_stripe(from, stripe);
+    }
+    m_table.store(to, std::memory_order_release);
+  }
+
+  /*
+      Applies a modification to the entry of a key under its stripe locks.
+
+      Parameters:
+          - key: The key.
+          - may_insert: Whether an absent key gets an entry. If not, `f` is
+         only called for a present key.
+          - f: Called once as f(value, present); returns what to do with
+         the entry.
+
+      Returns:
+          - Whether `f` was called.
+  */
+  template <typename F>
+  bool modify(const key_type &key, bool may_insert, F &&f) {
+    size_type hash = hash_of(key);
+    stripe_guard guard(m_stripes, hash & m_stripe_mask,
+                       second_index(hash) & m_stripe_mask);
+    table_type *table = m_table.load(std::memory_order_acquire);
+    // Finish moving both stripes out of any table being replaced, so the
+    // key is only ever in the newest table.
+    while (table_type *next = table->next.load(std::memory_order_acquire)) {
+      migrate_stripe(*table, hash & m_stripe_mask);
+      migrate_stripe(*table, second_index(hash) & m_stripe_mask);
+      table = next;
+    }
+
+    location at = locate(*table, hash, key);
+    bool present = at.bucket != nullptr;
+    if (!present) {
+      if (!may_insert) return false;
+      at = free_slot(*table, hash);
+    }
+
+    mapped_type value{};
+    if (present) {
+      internal::load_words(&value, at.bucket->values[at.slot], sizeof(T));
+    }
+    action result = f(value, present);
+    if (result == action::keep) return true;
+    begin_write(*at.owner);
+    if (result == action::erase) {
+      at.bucket->tags[at.slot].store(0, std::memory_order_relaxed);
+    } else {
+      store_entry(*at.bucket, at.slot, tag_of(hash), key, value);
+    }
+    end_write(*at.owner);
+
+    if (result == action::erase) {
+      m_size.fetch_sub(1, std::memory_order_relaxed);
+    } else if (!present &&
+               m_size.fetch_add(1, std::memory_order_relaxed) + 1 >
+                   max_load(*table)) {
+      guard.unlock();
+      grow(*table);
+    }
+    return true;
+  }
+};
+}  // namespace open_stl
+
+#endif  // OPEN_STL_CONCURRENT_HASH_MAP_H_
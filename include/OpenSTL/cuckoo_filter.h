@@ -0,0 +1,319 @@
+#ifndef OPEN_STL_CUCKOO_FILTER_H_
+#define OPEN_STL_CUCKOO_FILTER_H_
+
+#include <OpenSTL/hash.h>
+#include <OpenSTL/internal/prefetch.h>
+#include <OpenSTL/memory.h>
+#include <OpenSTL/vector.h>
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+namespace open_stl {
+/*
+    A cuckoo filter: a set membership test like a Bloom filter that also
+   supports deletion.
+
+    Template Parameters:
+        - Key: The type of the keys.
+        - Hash: The hash function object; its result is mixed unless it
+       declares `is_avalanching` and std::size_t has 64 bits.
+        - Allocator: The allocator; it is rebound to allocate the buckets.
+
+    The filter stores a 16-bit fingerprint of every key in one of two
+   buckets of four slots, and a bucket is a single 64-bit word. The second
+   bucket is the first XOR a hash of the fingerprint, so either bucket can
+   be computed from the other and the fingerprint alone, which is what lets
+   insertion evict a fingerprint to its other bucket, cuckoo-hashing style,
+   without knowing its key. A query reads two words, and compares all four
+   fingerprints of a word at once with a few arithmetic operations.
+
+    The filter holds up to about 95% of its slots. At that load the false
+   positive rate is about 0.012%, at roughly 17 bits per key. When an
+   insertion cannot find room after a bounded number of evictions, the last
+   evicted fingerprint is kept aside and the filter reports itself full:
+   later insertions fail until an erasure makes room.
+
+    erase() must only be given keys that were inserted; erasing any other
+   key may remove the fingerprint of a different key that collides with it.
+   A key inserted twice is stored twice and must be erased twice.
+*/
+template <typename Key, typename Hash = hash<Key>,
+          typename Allocator = allocator<Key>>
+class cuckoo_filter {
+  using bucket_allocator =
+      typename Allocator::template rebind<std::uint64_t>::other;
+
+  static constexpr std::size_t bucket_slots = 4;
+  // Evictions an insertion tries before it declares the filter full.
+  static constexpr int max_kicks = 500;
+  static constexpr std::uint64_t low_bits = 0x0001000100010001ull;
+  static constexpr std::uint64_t high_bits = 0x8000800080008000ull;
+
+ public:
+  using key_type = Key;
+  using size_type = std::size_t;
+  using hasher = Hash;
+  using allocator_type = Allocator;
+
+  /*
+      Constructor sizing the filter for a number of keys.
+
+      Parameters:
+          - expected_keys: The number of keys the filter must be able to
+         hold; the bucket count is rounded up to a power of two.
+          - hash: The hash function object.
+  */
+  explicit cuckoo_filter(size_type expected_keys, const Hash &hash = Hash())
+      : m_buckets(bucket_count(expected_keys), 0),
+        m_mask(m_buckets.size() - 1),
+        m_size(0),
+        m_victim{false, 0, 0},
+        m_random(0x9e3779b97f4a7c15ull),
+        m_hash(hash) {}
+
+  // Returns the number of keys stored
+  size_type size() const { return m_size; }
+
+  // Checks whether the filter is empty
+  bool empty() const { return m_size == 0; }
+
+  // Returns the number of fingerprint slots
+  size_type capacity() const { return m_buckets.size() * bucket_slots; }
+
+  // Checks whether the last insertion ran out of room
+  bool full() const { return m_victim.used; }
+
+  // Adds `key`. Returns false, changing nothing, if the filter is full.
+  bool insert(const key_type &key) { return insert_hash(hash_of(key)); }
+
+  // Checks whether `key` may be in the set. False means it certainly is
+  // not; true is wrong at the false positive rate.
+  bool contains(const key_type &key) const {
+    return contains_hash(hash_of(key));
+  }
+
+  // Removes one copy of `key`, which must have been inserted. Returns false
+  // if no matching fingerprint was found.
+  bool erase(const key_type &key) {
+    std::uint64_t hash = hash_of(key);
+    std::uint16_t fingerprint = fingerprint_of(hash);
+    size_type first = size_type(hash & m_mask);
+    size_type second = alternate(first, fingerprint);
+    if (m_victim.used && m_victim.fingerprint == fingerprint &&
+        (m_victim.index == first || m_victim.index == second)) {
+      m_victim.used = false;
+      m_size--;
+      return true;
+    }
+    if (!remove(first, fingerprint) && !remove(second, fingerprint)) {
+      return false;
+    }
+    m_size--;
+    // The freed slot may let the fingerprint kept aside back in.
+    if (m_victim.used) {
+      m_victim.used = false;
+      place(m_victim.index, m_victim.fingerprint);
+    }
+    return true;
+  }
+
+  /*
+      Adds `count` keys starting at `keys`, overlapping their cache misses.
+
+      Returns:
+          - The number of keys inserted; the rest found the filter full.
+  */
+  size_type insert_batch(const key_type *keys, size_type count) {
+    std::uint64_t hashes[internal::prefetch_batch_size];
+    size_type inserted = 0;
+    for (size_type base = 0; base < count;
+         base += internal::prefetch_batch_size) {
+      size_type size = batch_length(count - base);
+      prefetch_batch(keys + base, size, hashes);
+      for (size_type i = 0; i < size; i++) {
+        inserted += insert_hash(hashes[i]);
+      }
+    }
+    return inserted;
+  }
+
+  /*
+      Tests `count` keys starting at `keys`, overlapping their cache misses.
+
+      Parameters:
+          - results: Receives, for every key, whether it may be in the set.
+
+      Returns:
+          - The number of keys that may be in the set.
+  */
+  size_type contains_batch(const key_type *keys, size_type count,
+                           bool *results) const {
+    std::uint64_t hashes[internal::prefetch_batch_size];
+    size_type found = 0;
+    for (size_type base = 0; base < count;
+         base += internal::prefetch_batch_size) {
+      size_type size = batch_length(count - base);
+      prefetch_batch(keys + base, size, hashes);
+      for (size_type i = 0; i < size; i++) {
+        results[base + i] = contains_hash(hashes[i]);
+        found += results[base + i];
+      }
+    }
+    return found;
+  }
+
+  // Removes every key.
+  void clear() {
+    for (size_type i = 0; i < m_buckets.size(); i++) {
+      m_buckets[i] = 0;
+    }
+    m_size = 0;
+    m_victim.used = false;
+  }
+
+ private:
+  // A fingerprint that found no slot, and the bucket it was evicted from.
+  struct victim {
+    bool used;
+    size_type index;
+    std::uint16_t fingerprint;
+  };
+
+  // Each bucket packs four fingerprints into 16-bit lanes; zero is empty.
+  vector<std::uint64_t, bucket_allocator> m_buckets;
+  size_type m_mask;
+  size_type m_size;
+  victim m_victim;
+  // State of the generator choosing which fingerprint to evict.
+  std::uint64_t m_random;
+  Hash m_hash;
+
+  static size_type bucket_count(size_type keys) {
+    // Ask for 5% headroom over the load the filter can reach.
+    size_type buckets = keys * 20 / (19 * bucket_slots) + 1;
+    return std::bit_ceil(buckets);
+  }
+
+  std::uint64_t hash_of(const key_type &key) const {
+    return internal::hash64(m_hash, key);
+  }
+
+  // Takes the fingerprint from the top bits, which the bucket index does
+  // not use, avoiding the empty marker.
+  static std::uint16_t fingerprint_of(std::uint64_t hash) {
+    std::uint16_t fingerprint = std::uint16_t(hash >> 48);
+    return fingerprint == 0 ? 1 : fingerprint;
+  }
+
+  // The other bucket of a fingerprint in bucket `index`. Applying it twice
+  // gives back `index`.
+  size_type alternate(size_type index, std::uint16_t fingerprint) const {
+    return (index ^ (size_type(fingerprint) * 0x5bd1e995u)) & m_mask;
+  }
+
+  // Checks all four lanes of a bucket for a fingerprint at once: after the
+  // XOR a matching lane is zero, and subtracting one from every lane leaves
+  // a top bit set that was clear before only if some lane was zero.
+  static bool holds(std::uint64_t bucket, std::uint16_t fingerprint) {
+    std::uint64_t x = bucket ^ (low_bits * fingerprint);
+    return ((x - low_bits) & ~x & high_bits) != 0;
+  }
+
+  static std::uint16_t lane(std::uint64_t bucket, size_type slot) {
+    return std::uint16_t(bucket >> (16 * slot));
+  }
+
+  static void set_lane(std::uint64_t &bucket, size_type slot,
+                       std::uint16_t fingerprint) {
+    bucket &= ~(std::uint64_t(0xffff) << (16 * slot));
+    bucket |= std::uint64_t(fingerprint) << (16 * slot);
+  }
+
+  // Puts a fingerprint into a free slot of bucket `index`, if it has one.
+  bool try_place(size_type index, std::uint16_t fingerprint) {
+    std::uint64_t &bucket = m_buckets[index];
+    if (!holds(bucket, 0)) return false;
+    for (size_type slot = 0; slot < bucket_slots; slot++) {
+      if (lane(bucket, slot) == 0) {
+        set_lane(bucket, slot, fingerprint);
+        return true;
+      }
+    }
+    return false;
+  }
+
+  // Clears one slot of bucket `index` holding `fingerprint`, if any.
+  bool remove(size_type index, std::uint16_t fingerprint) {
+    std::uint64_t &bucket = m_buckets[index];
+    if (!holds(bucket, fingerprint)) return false;
+    for (size_type slot = 0; slot < bucket_slots; slot++) {
+      if (lane(bucket, slot) == fingerprint) {
+        set_lane(bucket, slot, 0);
+        return true;
+      }
+    }
+    return false;
+  }
+
+  // Stores a fingerprint starting at bucket `index`, evicting residents to
+  // their other buckets as needed. If that does not end, the fingerprint
+  // left over becomes the victim.
+  void place(size_type index, std::uint16_t fingerprint) {
+    for (int kick = 0; kick < max_kicks; kick++) {
+      if (try_place(index, fingerprint)) return;
+      if (try_place(alternate(index, fingerprint), fingerprint)) return;
+      // xorshift64
+      m_random ^= m_random << 13;
+      m_random ^= m_random >> 7;
+      m_random ^= m_random << 17;
+      size_type slot = m_random % bucket_slots;
+      std::uint16_t evicted = lane(m_buckets[index], slot);
+      set_lane(m_buckets[index], slot, fingerprint);
+      fingerprint = evicted;
+      index = alternate(index, fingerprint);
+    }
+    m_victim = victim{true, index, fingerprint};
+  }
+
+  bool insert_hash(std::uint64_t hash) {
+    if (m_victim.used) return false;
+    place(size_type(hash & m_mask), fingerprint_of(hash));
+    m_size++;
+    return true;
+  }
+
+  bool contains_hash(std::uint64_t hash) const {
+    std::uint16_t fingerprint = fingerprint_of(hash);
+    size_type first = size_type(hash & m_mask);
+    size_type second = alternate(first, fingerprint);
+    if (m_victim.used && m_victim.fingerprint == fingerprint &&
+        (m_victim.index == first || m_victim.index == second)) {
+      return true;
+    }
+    return holds(m_buckets[first], fingerprint) ||
+           holds(m_buckets[second], fingerprint);
+  }
+
+  static size_type batch_length(size_type remaining) {
+    return remaining < internal::prefetch_batch_size
+               ? remaining
+               : internal::prefetch_batch_size;
+  }
+
+  // Hashes `size` keys into `hashes` and prefetches both of their buckets.
+  void prefetch_batch(const key_type *keys, size_type size,
+                      std::uint64_t *hashes) const {
+    for (size_type i = 0; i < size; i++) {
+      hashes[i] = hash_of(keys[i]);
+      size_type first = size_type(hashes[i] & m_mask);
+      internal::prefetch(&m_buckets[first]);
+      internal::prefetch(
+          &m_buckets[alternate(first, fingerprint_of(hashes[i]))]);
+    }
+  }
+};
+}  // namespace open_stl
+
+#endif  // OPEN_STL_CUCKOO_FILTER_H_
@@ -0,0 +1,549 @@
+#ifndef OPEN_STL_DEQUE_H_
+#define OPEN_STL_DEQUE_H_
+
+#include <OpenSTL/algorithm.h>
+#include <OpenSTL/internal/iterator.h>
+#include <OpenSTL/internal/reverse_iterator.h>
+#include <OpenSTL/memory.h>
+#include <OpenSTL/utility.h>
+
+#include <bit>
+#include <cstddef>
+#include <initializer_list>
+#include <stdexcept>
+
+namespace open_stl {
+namespace internal {
+
+/*
+    Random access iterator over a deque.
+
+    Template Parameters:
+        - T: The element type, const-qualified for const iterators.
+
+    The iterator holds the deque's block table and a position counted from
+   the start of its first block, so dereferencing is one shift, one mask and
+   two loads. It is invalidated by any operation that grows or shrinks the
+   deque, even though the elements themselves do not move.
+*/
+template <typename T, std::size_t BlockShift>
+class deque_iterator {
+ public:
+  using iterator_category = random_access_iterator_tag;
+  using value_type = typename remove_cv<T>::type;
+  using difference_type = std::ptrdiff_t;
+  using pointer = T *;
+  using reference = T &;
+
+  deque_iterator() : m_blocks(nullptr), m_pos(0) {}
+
+  deque_iterator(value_type *const *blocks, difference_type pos)
+      : m_blocks(blocks), m_pos(pos) {}
+
+  // Converts an iterator to a const iterator.
+  template <typename Other>
+    requires(is_same<T, const Other>::value && !is_const<Other>::value)
+  deque_iterator(const deque_iterator<Other, BlockShift> &other)
+      : m_blocks(other.m_blocks), m_pos(other.m_pos) {}
+
+  reference operator*() const {
+    return m_blocks[m_pos >> BlockShift][m_pos & block_mask];
+  }
+  pointer operator->() const { return &**this; }
+  reference operator[](difference_type off) const { return *(*this + off); }
+
+  deque_iterator &operator++() {
+    ++m_pos;
+    return *this;
+  }
+
+  deque_iterator operator++(int) {
+    deque_iterator it = *this;
+    ++m_pos;
+    return it;
+  }
+
+  deque_iterator &operator--() {
+    --m_pos;
+    return *this;
+  }
+
+  deque_iterator operator--(int) {
+    deque_iterator it = *this;
+    --m_pos;
+    return it;
+  }
+
+  deque_iterator &operator+=(difference_type off) {
+    m_pos += off;
+    return *this;
+  }
+
+  deque_iterator &operator-=(difference_type off) {
+    m_pos -= off;
+    return *this;
+  }
+
+  deque_iterator operator+(difference_type off) const {
+    return deque_iterator(m_blocks, m_pos + off);
+  }
+
+  deque_iterator operator-(difference_type off) const {
+    return deque_iterator(m_blocks, m_pos - off);
+  }
+
+  difference_type operator-(const deque_iterator &right) const {
+    return m_pos - right.m_pos;
+  }
+
+  bool operator==(const deque_iterator &right) const {
+    return m_pos == right.m_pos;
+  }
+  bool operator!=(const deque_iterator &right) const {
+    return m_pos != right.m_pos;
+  }
+  bool operator<(const deque_iterator &right) const {
+    return m_pos < right.m_pos;
+  }
+  bool operator>(const deque_iterator &right) const {
+    return m_pos > right.m_pos;
+  }
+  bool operator<=(const deque_iterator &right) const {
+    return m_pos <= right.m_pos;
+  }
+  bool operator>=(const deque_iterator &right) const {
+    return m_pos >= right.m_pos;
+  }
+
+ private:
+  template <typename Other, std::size_t Shift>
+  friend class deque_iterator;
+
+  static constexpr difference_type block_mask =
+      (difference_type(1) << BlockShift) - 1;
+
+  value_type *const *m_blocks;
+  difference_type m_pos;
+};
+
+}  // namespace internal
+
+/*
+    A double-ended queue stored as a table of fixed-size blocks.
+
+    Template Parameters:
+        - T: The type of the elements.
+        - Allocator: The allocator for the blocks; it is rebound to allocate
+   the block table.
+
+    Elements live in blocks of a power-of-two number of elements, about 4 KiB
+   each. The block table holds pointers to the blocks in order and keeps
+   free room at both ends, so push_front and push_back are O(1): they write
+   into the first or last block and only allocate a new block when it is
+   full. Growing the table copies block pointers, never elements, so
+   references and pointers to elements stay valid until the element itself
+   is removed. Iterators are invalidated by every push and pop.
+
+    One emptied block is kept aside and reused, so a deque used as a FIFO
+   queue stops allocating once it has reached its steady-state size.
+*/
+template <typename T, typename Allocator = allocator<T>>
+class deque {
+  static constexpr std::size_t block_shift =
+      std::bit_width((sizeof(T) >= 4096 / 16 ? 16 : 4096 / sizeof(T))) - 1;
+
+ public:
+  using value_type = T;
+  using allocator_type = Allocator;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference = T &;
+  using const_reference = const T &;
+  using pointer = T *;
+  using const_pointer = const T *;
+  using iterator = internal::deque_iterator<T, block_shift>;
+  using const_iterator = internal::deque_iterator<const T, block_shift>;
+  using reverse_iterator = internal::reverse_iterator<iterator>;
+  using const_reverse_iterator = internal::reverse_iterator<const_iterator>;
+
+  // Number of elements per block.
+  static constexpr size_type block_size = size_type(1) << block_shift;
+
+  // Default constructor
+  deque()
+      : m_map(nullptr),
+        m_map_capacity(0),
+        m_first_block(0),
+        m_block_count(0),
+        m_offset(0),
+        m_size(0),
+        m_spare(nullptr) {}
+
+  // Constructor with size argument
+  explicit deque(size_type count) : deque() { resize(count); }
+
+  // Constructor with size and value arguments
+  deque(size_type count, const_reference value) : deque() {
+    for (size_type i = 0; i < count; i++) {
+      push_back(value);
+    }
+  }
+
+  // Constructor taking an std::initializer_list
+  deque(std::initializer_list<T> values) : deque() {
+    for (const_reference value : values) {
+      push_back(value);
+    }
+  }
+
+  // Copy constructor
+  deque(const deque &right) : deque() {
+    for (size_type i = 0; i < right.m_size; i++) {
+      push_back(right[i]);
+    }
+  }
+
+  // Move constructor
+  deque(deque &&right) : deque() { swap(right); }
+
+  // Destructor
+  ~deque() {
+    release_blocks();
+    if (m_spare != nullptr) deallocate_block(m_spare);
+    map_allocator map_alloc;
+    map_alloc.deallocate(m_map);
+  }
+
+  // Assigns the contents of another deque to this deque.
+  deque &operator=(const deque &right) {
+    if (this != &right) {
+      deque copy(right);
+      swap(copy);
+    }
+    return *this;
+  }
+
+  // Assigns the contents of another deque to this deque using move
+  // semantics.
+  deque &operator=(deque &&right) {
+    if (this != &right) {
+      deque moved(move(right));
+      swap(moved);
+    }
+    return *this;
+  }
+
+  // Returns a reference to the element at `off`; throws std::out_of_range if
+  // `off` is not less than size().
+  reference at(size_type off) {
+    check_index(off);
+    return (*this)[off];
+  }
+
+  // Returns a const reference to the element at `off`; throws
+  // std::out_of_range if `off` is not less than size().
+  const_reference at(size_type off) const {
+    check_index(off);
+    return (*this)[off];
+  }
+
+  // Returns a reference to the element at `off`.
+  reference operator[](size_type off) {
+    size_type pos = m_offset + off;
+    return m_map[m_first_block + (pos >> block_shift)][pos & (block_size - 1)];
+  }
+
+  // Returns a const reference to the element at `off`.
+  const_reference operator[](size_type off) const {
+    size_type pos = m_offset + off;
+    return m_map[m_first_block + (pos >> block_shift)][pos & (block_size - 1)];
+  }
+
+  // Returns a reference to the first element
+  reference front() { return (*this)[0]; }
+
+  // Returns a const reference to the first element
+  const_reference front() const { return (*this)[0]; }
+
+  // Returns a reference to the last element
+  reference back() { return (*this)[m_size - 1]; }
+
+  // Returns a const reference to the last element
+  const_reference back() const { return (*this)[m_size - 1]; }
+
+  // Returns an iterator to the first element
+  iterator begin() { return iterator(blocks(), m_offset); }
+
+  // Returns a const iterator to the first element
+  const_iterator begin() const { return const_iterator(blocks(), m_offset); }
+
+  // Returns a const iterator to the first element
+  const_iterator cbegin() const { return begin(); }
+
+  // Returns an iterator past the last element
+  iterator end() { return begin() + m_size; }
+
+  // Returns a const iterator past the last element
+  const_iterator end() const { return begin() + m_size; }
+
+  // Returns a const iterator past the last element
+  const_iterator cend() const { return end(); }
+
+  // Returns a reverse iterator to the last element
+  reverse_iterator rbegin() { return reverse_iterator(end() - 1); }
+
+  // Returns a const reverse iterator to the last element
+  const_reverse_iterator rbegin() const {
+    return const_reverse_iterator(end() - 1);
+  }
+
+  // Returns a reverse iterator before the first element
+  reverse_iterator rend() { return reverse_iterator(begin() - 1); }
+
+  // Returns a const reverse iterator before the first element
+  const_reverse_iterator rend() const {
+    return const_reverse_iterator(begin() - 1);
+  }
+
+  // Checks whether the deque is empty
+  bool empty() const { return m_size == 0; }
+
+  // Returns the number of elements
+  size_type size() const { return m_size; }
+
+  // Removes every element and releases all blocks but one spare.
+  void clear() {
+    release_blocks();
+    m_first_block = m_map_capacity / 2;
+    m_offset = 0;
+    m_size = 0;
+  }
+
+  // Releases the spare block and any unused block table capacity beyond what
+  // the current blocks need.
+  void shrink_to_fit() {
+    if (m_spare != nullptr) {
+      deallocate_block(m_spare);
+      m_spare = nullptr;
+    }
+    if (m_block_count == 0 && m_map != nullptr) {
+      map_allocator map_alloc;
+      map_alloc.deallocate(m_map);
+      m_map = nullptr;
+      m_map_capacity = 0;
+      m_first_block = 0;
+    }
+  }
+
+  // Changes the number of elements, appending default values or removing
+  // elements from the back.
+  void resize(size_type count) {
+    while (m_size > count) pop_back();
+    while (m_size < count) push_back(value_type());
+  }
+
+  // Adds a copy of `value` to the end.
+  void push_back(const_reference value) { *prepare_back() = value; }
+
+  // Moves `value` to the end.
+  void push_back(value_type &&value) { *prepare_back() = move(value); }
+
+  // Constructs an element at the end.
+  template <typename... Args>
+  reference emplace_back(Args &&...args) {
+    value_type *slot = prepare_back();
+    *slot = value_type(open_stl::forward<Args>(args)...);
+    return *slot;
+  }
+
+  // Adds a copy of `value` to the front.
+  void push_front(const_reference value) { *prepare_front() = value; }
+
+  // Moves `value` to the front.
+  void push_front(value_type &&value) { *prepare_front() = move(value); }
+
+  // Constructs an element at the front.
+  template <typename... Args>
+  reference emplace_front(Args &&...args) {
+    value_type *slot = prepare_front();
+    *slot = value_type(open_stl::forward<Args>(args)...);
+    return *slot;
+  }
+
+  // Removes the last element.
+  void pop_back() {
+    back() = value_type();
+    m_size--;
+    if (m_offset + m_size == (m_block_count - 1) * block_size) {
+      release_block(m_map[m_first_block + m_block_count - 1]);
+      m_block_count--;
+    }
+  }
+
+  // Removes the first element.
+  void pop_front() {
+    front() = value_type();
+    m_size--;
+    m_offset++;
+    if (m_offset == block_size) {
+      release_block(m_map[m_first_block]);
+      m_first_block++;
+      m_block_count--;
+      m_offset = 0;
+    }
+  }
+
+  // Swaps the contents of two deques.
+  void swap(deque &right) {
+    open_stl::swap(m_map, right.m_map);
+    open_stl::swap(m_map_capacity, right.m_map_capacity);
+    open_stl::swap(m_first_block, right.m_first_block);
+    open_stl::swap(m_block_count, right.m_block_count);
+    open_stl::swap(m_offset, right.m_offset);
+    open_stl::swap(m_size, right.m_size);
+    open_stl::swap(m_spare, right.m_spare);
+  }
+
+  // Checks if this deque is equal to another deque.
+  bool operator==(const deque &right) const {
+    return m_size == right.m_size &&
+           open_stl::equal(begin(), end(), right.begin(), right.end());
+  }
+
+  // Checks if this deque is not equal to another deque.
+  bool operator!=(const deque &right) const { return !(*this == right); }
+
+ private:
+  using map_allocator =
+      typename Allocator::template rebind<value_type *>::other;
+
+  // Table of block pointers; blocks in use occupy
+  // [m_first_block, m_first_block + m_block_count).
+  value_type **m_map;
+  size_type m_map_capacity;
+  size_type m_first_block;
+  size_type m_block_count;
+  // Position of the first element inside the first block, in [0, block_size).
+  size_type m_offset;
+  size_type m_size;
+  // An emptied block kept for reuse, or nullptr.
+  value_type *m_spare;
+
+  value_type *const *blocks() const { return m_map + m_first_block; }
+
+  void check_index(size_type off) const {
+    if (off >= m_size) {
+      throw std::out_of_range(
+          "Error: Index out of range in deque. Please ensure the index is "
+          "within the valid range of elements.");
+    }
+  }
+
+  value_type *allocate_block() {
+    if (m_spare != nullptr) {
+      value_type *block = m_spare;
+      m_spare = nullptr;
+      return block;
+    }
+    Allocator alloc;
+    return alloc.allocate(block_size);
+  }
+
+  void deallocate_block(value_type *block) {
+    Allocator alloc;
+    alloc.deallocate(block);
+  }
+
+  // Keeps an emptied block as the spare, or frees it if there already is
+  // one. Its slots have already been reset by the pops that emptied it.
+  void release_block(value_type *block) {
+    if (m_spare == nullptr) {
+      m_spare = block;
+    } else {
+      deallocate_block(block);
+    }
+  }
+
+  // Resets every element and hands all blocks to release_block.
+  void release_blocks() {
+    for (size_type i = 0; i < m_size; i++) {
+      (*this)[i] = value_type();
+    }
+    for (size_type i = 0; i < m_block_count; i++) {
+      release_block(m_map[m_first_block + i]);
+    }
+    m_block_count = 0;
+  }
+
+  /*
+      Makes room in the block table for one more block at the front or back.
+
+      If the table is at most half full the used range is re-centered in
+     place; otherwise a table twice as large is allocated and the block
+     pointers are copied to its middle. Either way only pointers move, and
+     the amortized cost per block is O(1).
+  */
+  void reserve_map_slot(bool at_front) {
+    bool room = at_front ? m_first_block > 0
+                         : m_first_block + m_block_count < m_map_capacity;
+    if (room) return;
+    size_type needed = m_block_count + 1;
+    if (m_map != nullptr && 2 * needed <= m_map_capacity) {
+      size_type first = (m_map_capacity - needed) / 2 + (at_front ? 1 : 0);
+      if (first < m_first_block) {
+        for (size_type i = 0; i < m_block_count; i++) {
+          m_map[first + i] = m_map[m_first_block + i];
+        }
+      } else {
+        for (size_type i = m_block_count; i > 0; i--) {
+          m_map[first + i - 1] = m_map[m_first_block + i - 1];
+        }
+      }
+      m_first_block = first;
+      return;
+    }
+    size_type capacity = m_map_capacity == 0 ? 8 : 2 * m_map_capacity;
+    map_allocator map_alloc;
+    value_type **map = map_alloc.allocate(capacity);
+    size_type first = (capacity - needed) / 2 + (at_front ? 1 : 0);
+    for (size_type i = 0; i < m_block_count; i++) {
+      map[first + i] = m_map[m_first_block + i];
+    }
+    map_alloc.deallocate(m_map);
+    m_map = map;
+    m_map_capacity = capacity;
+    m_first_block = first;
+  }
+
+  // Returns the slot for a new last element, adding a block if the last one
+  // is full.
+  value_type *prepare_back() {
+    size_type pos = m_offset + m_size;
+    if (pos == m_block_count * block_size) {
+      reserve_map_slot(false);
+      m_map[m_first_block + m_block_count] = allocate_block();
+      m_block_count++;
+    }
+    m_size++;
+    return &m_map[m_first_block + (pos >> block_shift)]
+                 [pos & (block_size - 1)];
+  }
+
+  // Returns the slot for a new first element, adding a block if the first
+  // one is full.
+  value_type *prepare_front() {
+    if (m_offset == 0) {
+      reserve_map_slot(true);
+      m_first_block--;
+      m_map[m_first_block] = allocate_block();
+      m_block_count++;
+      m_offset = block_size;
+    }
+    m_offset--;
+    m_size++;
+    return &m_map[m_first_block][m_offset];
+  }
+};
+}  // namespace open_stl
+
+#endif  // OPEN_STL_DEQUE_H_
@@ -0,0 +1,289 @@
+#ifndef OPEN_STL_DYNAMIC_BITSET_H_
+#define OPEN_STL_DYNAMIC_BITSET_H_
+
+#include <OpenSTL/internal/bit_ops.h>
+#include <OpenSTL/utility.h>
+#include <OpenSTL/vector.h>
+
+#include <cstddef>
+#include <stdexcept>
+
+namespace open_stl {
+/*
+    A sequence of bits whose length is chosen at run time, packed 64 to a
+   word.
+
+    Every bulk operation works on whole words. count() is one popcount per
+   word; find_first() and find_next() skip zero words and locate the bit
+   with a count-trailing-zeros instruction, so walking the set bits of a
+   sparse bitset costs time proportional to the set bits and the words, not
+   the bits. &, |, ^ and andnot combine two bitsets of the same size with
+   SSE2 where available, 128 bits per instruction.
+
+    Bits past size() in the last word are always zero, which keeps count(),
+   all() and the comparisons exact without masking.
+*/
+class dynamic_bitset {
+ public:
+  using size_type = std::size_t;
+  using reference = internal::bit_reference;
+  using const_reference = bool;
+
+  // Returned by find_first() and find_next() when no bit is set.
+  static constexpr size_type npos = static_cast<size_type>(-1);
+
+  // Default constructor; the bitset is empty.
+  dynamic_bitset() : m_words(), m_size(0) {}
+
+  // Constructor creating `size` bits set to `value`
+  explicit dynamic_bitset(size_type size, bool value = false)
+      : m_words(internal::word_count(size),
+                value ? ~internal::bit_word(0) : internal::bit_word(0)),
+        m_size(size) {
+    clear_unused_bits();
+  }
+
+  // Returns the number of bits
+  size_type size() const { return m_size; }
+
+  // Checks whether the bitset holds no bits
+  bool empty() const { return m_size == 0; }
+
+  // Returns the words holding the bits; bit i is bit i % 64 of word i / 64.
+  const internal::bit_word *data() const { return m_words.data(); }
+
+  // Returns the number of words
+  size_type word_count() const { return m_words.size(); }
+
+  // Returns a proxy for bit `index`
+  reference operator[](size_type index) {
+    return reference(m_words.data() + index / internal::bits_per_word,
+                     internal::bit_mask(index));
+  }
+
+  // Returns bit `index`
+  const_reference operator[](size_type index) const {
+    return (m_words[index / internal::bits_per_word] &
+            internal::bit_mask(index)) != 0;
+  }
+
+  // Returns bit `index`; throws std::out_of_range if `index` is not less
+  // than size().
+  bool test(size_type index) const {
+    if (index >= m_size) {
+      throw std::out_of_range(
+          "Error: Index out of range in dynamic_bitset. Please ensure the "
+          "index is less than size().");
+    }
+    return (*this)[index];
+  }
+
+  // Sets bit `index` to `value`.
+  dynamic_bitset &set(size_type index, bool value = true) {
+    (*this)[index] = value;
+    return *this;
+  }
+
+  // Sets every bit.
+  dynamic_bitset &set() {
+    for (internal::bit_word &word : m_words) {
+      word = ~internal::bit_word(0);
+    }
+    clear_unused_bits();
+    return *this;
+  }
+
+  // Clears bit `index`.
+  dynamic_bitset &reset(size_type index) { return set(index, false); }
+
+  // Clears every bit.
+  dynamic_bitset &reset() {
+    for (internal::bit_word &word : m_words) {
+      word = 0;
+    }
+    return *this;
+  }
+
+  // Inverts bit `index`.
+  dynamic_bitset &flip(size_type index) {
+    (*this)[index].flip();
+    return *this;
+  }
+
+  // Inverts every bit.
+  dynamic_bitset &flip() {
+    for (internal::bit_word &word : m_words) {
+      word = ~word;
+    }
+    clear_unused_bits();
+    return *this;
+  }
+
+  // Returns the number of set bits.
+  size_type count() const {
+    return internal::popcount_words(m_words.data(), m_words.size());
+  }
+
+  // Checks whether any bit is set.
+  bool any() const {
+    for (internal::bit_word word : m_words) {
+      if (word != 0) return true;
+    }
+    return false;
+  }
+
+  // Checks whether no bit is set.
+  bool none() const { return !any(); }
+
+  // Checks whether every bit is set; true for an empty bitset.
+  bool all() const { return count() == m_size; }
+
+  // Returns the index of the first set bit, or npos.
+  size_type find_first() const {
+    return internal::find_set_bit(m_words.data(), m_size, 0, npos);
+  }
+
+  // Returns the index of the first set bit after `index`, or npos.
+  size_type find_next(size_type index) const {
+    if (index >= m_size) return npos;
+    return internal::find_set_bit(m_words.data(), m_size, index + 1, npos);
+  }
+
+  // Changes the number of bits; new bits are set to `value`.
+  void resize(size_type size, bool value = false) {
+    size_type old_size = m_size;
+    m_words.resize(internal::word_count(size));
+    m_size = size;
+    if (size < old_size) {
+      clear_unused_bits();
+    } else if (value) {
+      // Fill the rest of the old last word, then whole words; the words
+      // added by the resize start out zero.
+      size_type word = old_size / internal::bits_per_word;
+      if (old_size % internal::bits_per_word != 0) {
+        m_words[word++] |= ~(internal::bit_mask(old_size) - 1);
+      }
+      for (; word < m_words.size(); word++) {
+        m_words[word] = ~internal::bit_word(0);
+      }
+      clear_unused_bits();
+    }
+  }
+
+  // Appends a bit.
+  void push_back(bool value) {
+    if (m_size % internal::bits_per_word == 0) m_words.push_back(0);
+    m_size++;
+    if (value) (*this)[m_size - 1] = true;
+  }
+
+  // Removes every bit.
+  void clear() {
+    m_words.clear();
+    m_size = 0;
+  }
+
+  // Keeps the bits set in both bitsets; throws std::invalid_argument if the
+  // sizes differ.
+  dynamic_bitset &operator&=(const dynamic_bitset &right) {
+    return combine<internal::bit_and>(right);
+  }
+
+  // Sets the bits set in either bitset; throws std::invalid_argument if the
+  // sizes differ.
+  dynamic_bitset &operator|=(const dynamic_bitset &right) {
+    return combine<internal::bit_or>(right);
+  }
+
+  // Keeps the bits set in exactly one bitset; throws std::invalid_argument
+  // if the sizes differ.
+  dynamic_bitset &operator^=(const dynamic_bitset &right) {
+    return combine<internal::bit_xor>(right);
+  }
+
+  // Clears the bits set in `right`, computing this & ~right without
+  // building ~right; throws std::invalid_argument if the sizes differ.
+  dynamic_bitset &andnot(const dynamic_bitset &right) {
+    return combine<internal::bit_andnot>(right);
+  }
+
+  // Returns a copy with every bit inverted.
+  dynamic_bitset operator~() const {
+    dynamic_bitset result = *this;
+    result.flip();
+    return result;
+  }
+
+  // Swaps the contents of two bitsets.
+  void swap(dynamic_bitset &right) {
+    open_stl::swap(m_words, right.m_words);
+    open_stl::swap(m_size, right.m_size);
+  }
+
+  // Checks if this bitset holds the same bits as another bitset.
+  bool operator==(const dynamic_bitset &right) const {
+    return m_size == right.m_size && m_words == right.m_words;
+  }
+
+  // Checks if this bitset differs from another bitset.
+  bool operator!=(const dynamic_bitset &right) const {
+    return !(*this == right);
+  }
+
+ private:
+  vector<internal::bit_word> m_words;
+  size_type m_size;
+
+  void clear_unused_bits() {
+    if (!m_words.empty()) {
+      m_words.back() &= internal::last_word_mask(m_size);
+    }
+  }
+
+  template <typename Op>
+  dynamic_bitset &combine(const dynamic_bitset &right) {
+    if (m_size != right.m_size) {
+      throw std::invalid_argument(
+          "Error: dynamic_bitset sizes differ. Bitwise operations need two "
+          "bitsets of the same size.");
+    }
+    internal::transform_words<Op>(m_words.data(), m_words.data(),
+                                  right.m_words.data(), m_words.size());
+    return *this;
+  }
+};
+
+// Returns the bits set in both bitsets.
+inline dynamic_bitset operator&(const dynamic_bitset &lhs,
+                                const dynamic_bitset &rhs) {
+  dynamic_bitset result = lhs;
+  result &= rhs;
+  return result;
+}
+
+// Returns the bits set in either bitset.
+inline dynamic_bitset operator|(const dynamic_bitset &lhs,
+                                const dynamic_bitset &rhs) {
+  dynamic_bitset result = lhs;
+  result |= rhs;
+  return result;
+}
+
+// Returns the bits set in exactly one bitset.
+inline dynamic_bitset operator^(const dynamic_bitset &lhs,
+                                const dynamic_bitset &rhs) {
+  dynamic_bitset result = lhs;
+  result ^= rhs;
+  return result;
+}
+
+// Returns the bits set in `lhs` but not in `rhs`.
+inline dynamic_bitset andnot(const dynamic_bitset &lhs,
+                             const dynamic_bitset &rhs) {
+  dynamic_bitset result = lhs;
+  result.andnot(rhs);
+  return result;
+}
+}  // namespace open_stl
+
+#endif  // OPEN_STL_DYNAMIC_BITSET_H_
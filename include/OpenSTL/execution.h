@@ -0,0 +1,61 @@
+#ifndef OPEN_STL_EXECUTION_H_
+#define OPEN_STL_EXECUTION_H_
+
+#include <OpenSTL/type_traits.h>
+
+namespace open_stl {
+namespace execution {
+
+/*
+    Execution policy types used to select an algorithm overload.
+
+    Policies:
+        - sequenced_policy: Run the algorithm on the calling thread.
+        - parallel_policy: Allow the algorithm to split its range into blocks
+   and process them on several threads. Element access functions must be safe
+   to call concurrently on distinct elements.
+
+    The policy objects `seq` and `par` are passed as the first argument of an
+   algorithm, mirroring the standard library.
+*/
+struct sequenced_policy {};
+struct parallel_policy {};
+
+inline constexpr sequenced_policy seq{};
+inline constexpr parallel_policy par{};
+
+/*
+    Template struct to determine if a type is an execution policy.
+
+    Template Parameters:
+        - T: The type to be checked.
+
+    Members:
+        - value: True if T is one of the policy types above, false otherwise.
+
+    Algorithms use this trait to keep their policy overloads from competing
+   with the iterator-only overloads of the same arity.
+*/
+template <typename T>
+struct is_execution_policy {
+  static constexpr bool value = false;
+};
+
+template <>
+struct is_execution_policy<sequenced_policy> {
+  static constexpr bool value = true;
+};
+
+template <>
+struct is_execution_policy<parallel_policy> {
+  static constexpr bool value = true;
+};
+
+template <typename T>
+inline constexpr bool is_execution_policy_v =
+    is_execution_policy<remove_cvref_t<T>>::value;
+
+}  // namespace execution
+}  // namespace open_stl
+
+#endif  // OPEN_STL_EXECUTION_H_
@@ -0,0 +1,126 @@
+#ifndef OPEN_STL_EYTZINGER_INDEX_H_
+#define OPEN_STL_EYTZINGER_INDEX_H_
+
+#include <OpenSTL/functional.h>
+#include <OpenSTL/internal/prefetch.h>
+#include <OpenSTL/vector.h>
+
+#include <bit>
+#include <cstddef>
+
+namespace open_stl {
+/*
+    A read-only search index over a sorted vector, stored in Eytzinger order.
+
+    Template Parameters:
+        - T: The type of the indexed values.
+        - Compare: The ordering the input vector is sorted by.
+
+    The sorted values are re-laid out in breadth-first order of an implicit
+   binary search tree: the root sits at position 1 and the children of
+   position k sit at 2k and 2k + 1. A search walks from the root with a
+   branchless step `k = 2k + comp(node, value)`. Because the top levels of the
+   tree are packed at the front of the array they stay in cache, and the
+   descendants several levels below the current node share one cache line,
+   which is prefetched while the current comparison runs.
+
+    Searches return positions in the original sorted vector, so the index can
+   sit in front of any payload stored in the same order.
+*/
+template <typename T, typename Compare = less<T>>
+class eytzinger_index {
+ public:
+  using value_type = T;
+  using size_type = std::size_t;
+  using const_reference = const T &;
+
+  // Default constructor; the index is empty.
+  eytzinger_index() : m_data(1), m_rank(1), m_size(0), m_comp() {}
+
+  // Builds the index from a vector sorted by `comp`.
+  explicit eytzinger_index(const vector<T> &sorted, Compare comp = Compare())
+      : m_data(sorted.size() + 1),
+        m_rank(sorted.size() + 1),
+        m_size(sorted.size()),
+        m_comp(comp) {
+    build(sorted, 0, 1);
+  }
+
+  // Returns the number of indexed values.
+  size_type size() const { return m_size; }
+
+  // Checks whether the index is empty.
+  bool empty() const { return m_size == 0; }
+
+  // Returns the position in the sorted input of the first value not ordered
+  // before `value`, or size() if there is none.
+  size_type lower_bound(const T &value) const {
+    size_type k = search(value, [this](const T &node, const T &key) {
+      return m_comp(node, key);
+    });
+    return k == 0 ? m_size : m_rank[k];
+  }
+
+  // Returns the position in the sorted input of the first value ordered
+  // after `value`, or size() if there is none.
+  size_type upper_bound(const T &value) const {
+    size_type k = search(value, [this](const T &node, const T &key) {
+      return !m_comp(key, node);
+    });
+    return k == 0 ? m_size : m_rank[k];
+  }
+
+  // Checks whether a value equivalent to `value` is indexed.
+  bool contains(const T &value) const {
+    size_type k = search(value, [this](const T &node, const T &key) {
+      return m_comp(node, key);
+    });
+    return k != 0 && !m_comp(value, m_data[k]);
+  }
+
+ private:
+  // Values in Eytzinger order; slot 0 is unused so the root is at 1.
+  vector<T> m_data;
+  // Position in the sorted input of the value in each slot.
+  vector<size_type> m_rank;
+  size_type m_size;
+  Compare m_comp;
+
+  // Number of values sharing one cache line, i.e. how many slots apart the
+  // first descendants log2(block) levels below a node are.
+  static constexpr size_type prefetch_block =
+      sizeof(T) >= internal::cache_line_size
+          ? 1
+          : internal::cache_line_size / sizeof(T);
+
+  // Fills the subtree rooted at slot k with an in-order walk of the sorted
+  // input starting at position i, and returns the next unused position.
+  size_type build(const vector<T> &sorted, size_type i, size_type k) {
+    if (k > m_size) return i;
+    i = build(sorted, i, 2 * k);
+    m_data[k] = sorted[i];
+    m_rank[k] = i;
+    return build(sorted, i + 1, 2 * k + 1);
+  }
+
+  // Descends while `go_right(node, value)` holds for the node visited and
+  // returns the slot of the last node where it did not, or 0 if it held at
+  // every node. The descent always runs to a leaf, so the loop has no
+  // data-dependent exit.
+  template <typename GoRight>
+  size_type search(const T &value, GoRight go_right) const {
+    const T *data = m_data.data();
+    size_type k = 1;
+    while (k <= m_size) {
+      size_type ahead = k * prefetch_block;
+      internal::prefetch(data + (ahead <= m_size ? ahead : 0));
+      k = 2 * k + go_right(data[k], value);
+    }
+    // The path taken is encoded in the bits of k; the trailing ones are the
+    // right turns made after the last left turn, which is the answer.
+    return k >> (std::countr_one(k) + 1);
+  }
+};
+}  // namespace open_stl
+
+#endif  // OPEN_STL_EYTZINGER_INDEX_H_
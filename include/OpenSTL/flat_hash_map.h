@@ -0,0 +1,359 @@
+#ifndef OPEN_STL_FLAT_HASH_MAP_H_
+#define OPEN_STL_FLAT_HASH_MAP_H_
+
+#include <OpenSTL/functional.h>
+#include <OpenSTL/hash.h>
+#include <OpenSTL/internal/raw_hash_table.h>
+#include <OpenSTL/memory.h>
+#include <OpenSTL/utility.h>
+
+#include <cstddef>
+#include <initializer_list>
+#include <stdexcept>
+
+namespace open_stl {
+namespace internal {
+// Slot description for flat_hash_map: a key-value pair keyed by `first`.
+template <typename Key, typename T>
+struct map_slot_policy {
+  using key_type = Key;
+  using slot_type = pair<Key, T>;
+  static const Key &key(const slot_type &slot) { return slot.first; }
+};
+}  // namespace internal
+
+/*
+    An unordered map that stores its key-value pairs inline in one flat
+   array.
+
+    Template Parameters:
+        - Key: The type of the keys.
+        - T: The type of the mapped values.
+        - Hash: The hash function object.
+        - KeyEqual: The key equality function object.
+        - Allocator: The allocator for the key-value pairs.
+
+    Elements live directly in the table rather than in separate nodes, so a
+   lookup touches one metadata group and one slot. See raw_hash_table for the
+   probing and deletion scheme.
+
+    Differences from std::unordered_map:
+        - value_type is pair<Key, T>; keys must not be modified through an
+   iterator.
+        - Inserting or erasing may move other elements, which invalidates all
+   iterators, pointers and references.
+        - erase(iterator) returns nothing; use erase_if to erase while
+   scanning.
+
+    When both Hash and KeyEqual declare `is_transparent`, the lookup
+   functions also accept any type the two function objects accept, so keys
+   can be looked up without building a Key first.
+*/
+template <typename Key, typename T, typename Hash = hash<Key>,
+          typename KeyEqual = equal_to<Key>,
+          typename Allocator = allocator<pair<Key, T>>>
+class flat_hash_map {
+  using table_type =
+      internal::raw_hash_table<internal::map_slot_policy<Key, T>, Hash,
+                               KeyEqual, Allocator>;
+
+  static constexpr bool transparent =
+      internal::is_transparent_v<Hash> && internal::is_transparent_v<KeyEqual>;
+
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = pair<Key, T>;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+  using allocator_type = Allocator;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using iterator = internal::hash_table_iterator<value_type>;
+  using const_iterator = internal::hash_table_iterator<const value_type>;
+
+  // Default constructor
+  flat_hash_map() : m_table() {}
+
+  // Constructor taking the hash and equality function objects
+  explicit flat_hash_map(size_type count, const Hash &hash = Hash(),
+                         const KeyEqual &eq = KeyEqual())
+      : m_table(hash, eq) {
+    m_table.reserve(count);
+  }
+
+  // Constructor taking an std::initializer_list; later duplicates of a key
+  // are ignored.
+  flat_hash_map(std::initializer_list<value_type> values) : m_table() {
+    m_table.reserve(values.size());
+    for (const_reference value : values) {
+      insert(value);
+    }
+  }
+
+  // Returns an iterator to the first element
+  iterator begin() {
+    return iterator(m_table.ctrl(), m_table.slots(),
+                    m_table.ctrl() + m_table.capacity());
+  }
+
+  // Returns a const iterator to the first element
+  const_iterator begin() const {
+    return const_iterator(m_table.ctrl(), m_table.slots(),
+                          m_table.ctrl() + m_table.capacity());
+  }
+
+  // Returns a const iterator to the first element
+  const_iterator cbegin() const { return begin(); }
+
+  // Returns an iterator past the last element
+  iterator end() { return iterator_at(m_table.capacity()); }
+
+  // Returns a const iterator past the last element
+  const_iterator end() const { return iterator_at(m_table.capacity()); }
+
+  // Returns a const iterator past the last element
+  const_iterator cend() const { return end(); }
+
+  // Checks whether the map is empty
+  bool empty() const { return m_table.size() == 0; }
+
+  // Returns the number of elements
+  size_type size() const { return m_table.size(); }
+
+  // Returns the number of slots in the table
+  size_type capacity() const { return m_table.capacity(); }
+
+  // Returns the ratio of elements to slots
+  float load_factor() const {
+    return capacity() == 0 ? 0.0f : float(size()) / float(capacity());
+  }
+
+  // Removes every element, keeping the allocated slots
+  void clear() { m_table.clear(); }
+
+  // Grows the table so `count` elements fit without rehashing
+  void reserve(size_type count) { m_table.reserve(count); }
+
+  // Inserts a copy of `value` unless its key is present. Returns an iterator
+  // to the element with that key and whether the insertion happened.
+  pair<iterator, bool> insert(const_reference value) {
+    pair<size_type, bool> slot = m_table.find_or_prepare_insert(value.first);
+    if (slot.second) m_table.slots()[slot.first] = value;
+    return pair<iterator, bool>(iterator_at(slot.first), slot.second);
+  }
+
+  // Inserts `value` by moving it unless its key is present.
+  pair<iterator, bool> insert(value_type &&value) {
+    pair<size_type, bool> slot = m_table.find_or_prepare_insert(value.first);
+    if (slot.second) m_table.slots()[slot.first] = move(value);
+    return pair<iterator, bool>(iterator_at(slot.first), slot.second);
+  }
+
+  // Inserts every element of a range whose key is not yet present.
+  template <typename InputIterator>
+  void insert(InputIterator first, InputIterator last) {
+    for (; first != last; ++first) {
+      insert(*first);
+    }
+  }
+
+  // Constructs an element in place unless its key is present.
+  template <typename... Args>
+  pair<iterator, bool> emplace(Args &&...args) {
+    return insert(value_type(open_stl::forward<Args>(args)...));
+  }
+
+  // Inserts `value` under `key`, or assigns it if the key is present.
+  pair<iterator, bool> insert_or_assign(const key_type &key,
+                                        const mapped_type &value) {
+    pair<size_type, bool> slot = m_table.find_or_prepare_insert(key);
+    value_type &element = m_table.slots()[slot.first];
+    if (slot.second) element.first = key;
+    element.second = value;
+    return pair<iterator, bool>(iterator_at(slot.first), slot.second);
+  }
+
+  // Returns the value mapped to `key`, inserting a value-initialized one if
+  // the key is absent.
+  mapped_type &operator[](const key_type &key) {
+    pair<size_type, bool> slot = m_table.find_or_prepare_insert(key);
+    value_type &element = m_table.slots()[slot.first];
+    if (slot.second) element = value_type(key, mapped_type());
+    return element.second;
+  }
+
+  // Returns the value mapped to `key`; throws std::out_of_range if absent.
+  mapped_type &at(const key_type &key) { return at_index(m_table.find(key)); }
+
+  // Returns the value mapped to `key`; throws std::out_of_range if absent.
+  const mapped_type &at(const key_type &key) const {
+    return at_index(m_table.find(key));
+  }
+
+  // Heterogeneous overload of at(), enabled for transparent Hash and
+  // KeyEqual.
+  template <typename K>
+    requires transparent
+  mapped_type &at(const K &key) {
+    return at_index(m_table.find(key));
+  }
+
+  // Heterogeneous overload of at(), enabled for transparent Hash and
+  // KeyEqual.
+  template <typename K>
+    requires transparent
+  const mapped_type &at(const K &key) const {
+    return at_index(m_table.find(key));
+  }
+
+  // Returns an iterator to the element with `key`, or end().
+  iterator find(const key_type &key) { return find_index(m_table.find(key)); }
+
+  // Returns a const iterator to the element with `key`, or end().
+  const_iterator find(const key_type &key) const {
+    return find_index(m_table.find(key));
+  }
+
+  // Heterogeneous overload of find(), enabled for transparent Hash and
+  // KeyEqual.
+  template <typename K>
+    requires transparent
+  iterator find(const K &key) {
+    return find_index(m_table.find(key));
+  }
+
+  // Heterogeneous overload of find(), enabled for transparent Hash and
+  // KeyEqual.
+  template <typename K>
+    requires transparent
+  const_iterator find(const K &key) const {
+    return find_index(m_table.find(key));
+  }
+
+  // Checks whether an element with `key` is present.
+  bool contains(const key_type &key) const {
+    return m_table.find(key) != table_type::npos;
+  }
+
+  // Heterogeneous overload of contains(), enabled for transparent Hash and
+  // KeyEqual.
+  template <typename K>
+    requires transparent
+  bool contains(const K &key) const {
+    return m_table.find(key) != table_type::npos;
+  }
+
+  // Returns the number of elements with `key`, which is 0 or 1.
+  size_type count(const key_type &key) const { return contains(key) ? 1 : 0; }
+
+  // Heterogeneous overload of count(), enabled for transparent Hash and
+  // KeyEqual.
+  template <typename K>
+    requires transparent
+  size_type count(const K &key) const {
+    return contains(key) ? 1 : 0;
+  }
+
+  // Hints the processor to load the memory a lookup of `key` will touch.
+  // Issuing this for a batch of keys before looking them up overlaps their
+  // cache misses.
+  void prefetch(const key_type &key) const { m_table.prefetch(key); }
+
+  // Removes the element with `key`, returning how many were removed.
+  size_type erase(const key_type &key) { return m_table.erase(key); }
+
+  // Heterogeneous overload of erase(), enabled for transparent Hash and
+  // KeyEqual.
+  template <typename K>
+    requires transparent
+  size_type erase(const K &key) {
+    return m_table.erase(key);
+  }
+
+  // Removes the element at `position`. Elements after it in the same probe
+  // run may move into its slot.
+  void erase(iterator position) { erase(const_iterator(position)); }
+
+  // Removes the element at `position`. Elements after it in the same probe
+  // run may move into its slot.
+  void erase(const_iterator position) {
+    m_table.erase_at(&*position - m_table.slots());
+  }
+
+  // Swaps the contents of two maps.
+  void swap(flat_hash_map &right) { m_table.swap(right.m_table); }
+
+  // Returns the hash function object.
+  hasher hash_function() const { return m_table.hash_function(); }
+
+  // Returns the key equality function object.
+  key_equal key_eq() const { return m_table.key_eq(); }
+
+  // Checks if this map holds the same key-value pairs as another map.
+  bool operator==(const flat_hash_map &right) const {
+    if (size() != right.size()) return false;
+    for (const_reference element : *this) {
+      const_iterator it = right.find(element.first);
+      if (it == right.end() || !(it->second == element.second)) return false;
+    }
+    return true;
+  }
+
+  // Checks if this map differs from another map.
+  bool operator!=(const flat_hash_map &right) const {
+    return !(*this == right);
+  }
+
+  // Removes every element satisfying `pred` and returns how many were
+  // removed.
+  template <typename Predicate>
+  friend size_type erase_if(flat_hash_map &map, Predicate pred) {
+    return map.m_table.erase_if(pred);
+  }
+
+ private:
+  table_type m_table;
+
+  iterator iterator_at(size_type index) {
+    const internal::ctrl_t *end = m_table.ctrl() + m_table.capacity();
+    return iterator(m_table.ctrl() + index, m_table.slots() + index, end);
+  }
+
+  const_iterator iterator_at(size_type index) const {
+    const internal::ctrl_t *end = m_table.ctrl() + m_table.capacity();
+    return const_iterator(m_table.ctrl() + index, m_table.slots() + index,
+                          end);
+  }
+
+  iterator find_index(size_type index) {
+    return index == table_type::npos ? end() : iterator_at(index);
+  }
+
+  const_iterator find_index(size_type index) const {
+    return index == table_type::npos ? end() : iterator_at(index);
+  }
+
+  mapped_type &at_index(size_type index) {
+    check_found(index);
+    return m_table.slots()[index].second;
+  }
+
+  const mapped_type &at_index(size_type index) const {
+    check_found(index);
+    return m_table.slots()[index].second;
+  }
+
+  static void check_found(size_type index) {
+    if (index == table_type::npos) {
+      throw std::out_of_range(
+          "Error: flat_hash_map key not found. Please ensure the key is "
+          "present before calling at().");
+    }
+  }
+};
+}  // namespace open_stl
+
+#endif  // OPEN_STL_FLAT_HASH_MAP_H_
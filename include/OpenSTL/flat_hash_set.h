@@ -0,0 +1,245 @@
+#ifndef OPEN_STL_FLAT_HASH_SET_H_
+#define OPEN_STL_FLAT_HASH_SET_H_
+
+#include <OpenSTL/functional.h>
+#include <OpenSTL/hash.h>
+#include <OpenSTL/internal/raw_hash_table.h>
+#include <OpenSTL/memory.h>
+#include <OpenSTL/utility.h>
+
+#include <cstddef>
+#include <initializer_list>
+
+namespace open_stl {
+namespace internal {
+// Slot description for flat_hash_set: the slot is the key.
+template <typename Key>
+struct set_slot_policy {
+  using key_type = Key;
+  using slot_type = Key;
+  static const Key &key(const slot_type &slot) { return slot; }
+};
+}  // namespace internal
+
+/*
+    An unordered set that stores its keys inline in one flat array.
+
+    Template Parameters:
+        - Key: The type of the keys.
+        - Hash: The hash function object.
+        - KeyEqual: The key equality function object.
+        - Allocator: The allocator for the keys.
+
+    The set shares its table with flat_hash_map, see raw_hash_table for the
+   probing and deletion scheme. Inserting or erasing may move other keys,
+   which invalidates all iterators, pointers and references. Heterogeneous
+   lookup is enabled when both Hash and KeyEqual declare `is_transparent`.
+*/
+template <typename Key, typename Hash = hash<Key>,
+          typename KeyEqual = equal_to<Key>,
+          typename Allocator = allocator<Key>>
+class flat_hash_set {
+  using table_type =
+      internal::raw_hash_table<internal::set_slot_policy<Key>, Hash, KeyEqual,
+                               Allocator>;
+
+  static constexpr bool transparent =
+      internal::is_transparent_v<Hash> && internal::is_transparent_v<KeyEqual>;
+
+ public:
+  using key_type = Key;
+  using value_type = Key;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+  using allocator_type = Allocator;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  // Keys are never modifiable through an iterator.
+  using iterator = internal::hash_table_iterator<const value_type>;
+  using const_iterator = iterator;
+
+  // Default constructor
+  flat_hash_set() : m_table() {}
+
+  // Constructor taking the hash and equality function objects
+  explicit flat_hash_set(size_type count, const Hash &hash = Hash(),
+                         const KeyEqual &eq = KeyEqual())
+      : m_table(hash, eq) {
+    m_table.reserve(count);
+  }
+
+  // Constructor taking an std::initializer_list
+  flat_hash_set(std::initializer_list<value_type> values) : m_table() {
+    m_table.reserve(values.size());
+    for (const_reference value : values) {
+      insert(value);
+    }
+  }
+
+  // Returns an iterator to the first key
+  iterator begin() const {
+    return iterator(m_table.ctrl(), m_table.slots(),
+                    m_table.ctrl() + m_table.capacity());
+  }
+
+  // Returns an iterator to the first key
+  const_iterator cbegin() const { return begin(); }
+
+  // Returns an iterator past the last key
+  iterator end() const { return iterator_at(m_table.capacity()); }
+
+  // Returns an iterator past the last key
+  const_iterator cend() const { return end(); }
+
+  // Checks whether the set is empty
+  bool empty() const { return m_table.size() == 0; }
+
+  // Returns the number of keys
+  size_type size() const { return m_table.size(); }
+
+  // Returns the number of slots in the table
+  size_type capacity() const { return m_table.capacity(); }
+
+  // Returns the ratio of keys to slots
+  float load_factor() const {
+    return capacity() == 0 ? 0.0f : float(size()) / float(capacity());
+  }
+
+  // Removes every key, keeping the allocated slots
+  void clear() { m_table.clear(); }
+
+  // Grows the table so `count` keys fit without rehashing
+  void reserve(size_type count) { m_table.reserve(count); }
+
+  // Inserts a copy of `value` unless it is present. Returns an iterator to
+  // the key and whether the insertion happened.
+  pair<iterator, bool> insert(const_reference value) {
+    pair<size_type, bool> slot = m_table.find_or_prepare_insert(value);
+    if (slot.second) m_table.slots()[slot.first] = value;
+    return pair<iterator, bool>(iterator_at(slot.first), slot.second);
+  }
+
+  // Inserts `value` by moving it unless it is present.
+  pair<iterator, bool> insert(value_type &&value) {
+    pair<size_type, bool> slot = m_table.find_or_prepare_insert(value);
+    if (slot.second) m_table.slots()[slot.first] = move(value);
+    return pair<iterator, bool>(iterator_at(slot.first), slot.second);
+  }
+
+  // Inserts every key of a range that is not yet present.
+  template <typename InputIterator>
+  void insert(InputIterator first, InputIterator last) {
+    for (; first != last; ++first) {
+      insert(*first);
+    }
+  }
+
+  // Constructs a key in place unless it is present.
+  template <typename... Args>
+  pair<iterator, bool> emplace(Args &&...args) {
+    return insert(value_type(open_stl::forward<Args>(args)...));
+  }
+
+  // Returns an iterator to `key`, or end().
+  iterator find(const key_type &key) const {
+    return find_index(m_table.find(key));
+  }
+
+  // Heterogeneous overload of find(), enabled for transparent Hash and
+  // KeyEqual.
+  template <typename K>
+    requires transparent
+  iterator find(const K &key) const {
+    return find_index(m_table.find(key));
+  }
+
+  // Checks whether `key` is present.
+  bool contains(const key_type &key) const {
+    return m_table.find(key) != table_type::npos;
+  }
+
+  // Heterogeneous overload of contains(), enabled for transparent Hash and
+  // KeyEqual.
+  template <typename K>
+    requires transparent
+  bool contains(const K &key) const {
+    return m_table.find(key) != table_type::npos;
+  }
+
+  // Returns the number of keys equal to `key`, which is 0 or 1.
+  size_type count(const key_type &key) const { return contains(key) ? 1 : 0; }
+
+  // Heterogeneous overload of count(), enabled for transparent Hash and
+  // KeyEqual.
+  template <typename K>
+    requires transparent
+  size_type count(const K &key) const {
+    return contains(key) ? 1 : 0;
+  }
+
+  // Hints the processor to load the memory a lookup of `key` will touch.
+  void prefetch(const key_type &key) const { m_table.prefetch(key); }
+
+  // Removes `key`, returning how many keys were removed.
+  size_type erase(const key_type &key) { return m_table.erase(key); }
+
+  // Heterogeneous overload of erase(), enabled for transparent Hash and
+  // KeyEqual.
+  template <typename K>
+    requires transparent
+  size_type erase(const K &key) {
+    return m_table.erase(key);
+  }
+
+  // Removes the key at `position`. Keys after it in the same probe run may
+  // move into its slot.
+  void erase(const_iterator position) {
+    m_table.erase_at(&*position - m_table.slots());
+  }
+
+  // Swaps the contents of two sets.
+  void swap(flat_hash_set &right) { m_table.swap(right.m_table); }
+
+  // Returns the hash function object.
+  hasher hash_function() const { return m_table.hash_function(); }
+
+  // Returns the key equality function object.
+  key_equal key_eq() const { return m_table.key_eq(); }
+
+  // Checks if this set holds the same keys as another set.
+  bool operator==(const flat_hash_set &right) const {
+    if (size() != right.size()) return false;
+    for (const_reference key : *this) {
+      if (!right.contains(key)) return false;
+    }
+    return true;
+  }
+
+  // Checks if this set differs from another set.
+  bool operator!=(const flat_hash_set &right) const {
+    return !(*this == right);
+  }
+
+  // Removes every key satisfying `pred` and returns how many were removed.
+  template <typename Predicate>
+  friend size_type erase_if(flat_hash_set &set, Predicate pred) {
+    return set.m_table.erase_if(pred);
+  }
+
+ private:
+  table_type m_table;
+
+  iterator iterator_at(size_type index) const {
+    const internal::ctrl_t *end = m_table.ctrl() + m_table.capacity();
+    return iterator(m_table.ctrl() + index, m_table.slots() + index, end);
+  }
+
+  iterator find_index(size_type index) const {
+    return index == table_type::npos ? end() : iterator_at(index);
+  }
+};
+}  // namespace open_stl
+
+#endif  // OPEN_STL_FLAT_HASH_SET_H_
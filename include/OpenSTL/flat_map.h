@@ -0,0 +1,597 @@
+#ifndef OPEN_STL_FLAT_MAP_H_
+#define OPEN_STL_FLAT_MAP_H_
+
+#include <OpenSTL/algorithm.h>
+#include <OpenSTL/functional.h>
+#include <OpenSTL/internal/iterator.h>
+#include <OpenSTL/utility.h>
+#include <OpenSTL/vector.h>
+
+#include <cstddef>
+#include <initializer_list>
+#include <stdexcept>
+
+namespace open_stl {
+namespace internal {
+
+// Inserts `value` at index `position` of a vector, shifting the tail right
+// by one.
+template <typename Vector, typename Value>
+void vector_insert_at(Vector &values, std::size_t position, Value &&value) {
+  values.push_back(open_stl::forward<Value>(value));
+  std::size_t last = values.size() - 1;
+  if (position == last) return;
+  typename Vector::value_type inserted = move(values[last]);
+  for (std::size_t i = last; i > position; i--) {
+    values[i] = move(values[i - 1]);
+  }
+  values[position] = move(inserted);
+}
+
+/*
+    Random access iterator over a flat_map, walking its key and value
+   vectors in step.
+
+    Template Parameters:
+        - Key: The key type.
+        - Mapped: The mapped type, const-qualified for const iterators.
+
+    Dereferencing yields a pair of references rather than a reference to a
+   stored pair, because keys and values live in separate arrays.
+*/
+template <typename Key, typename Mapped>
+class flat_map_iterator {
+ public:
+  using iterator_category = random_access_iterator_tag;
+  using value_type = pair<Key, typename remove_cv<Mapped>::type>;
+  using difference_type = std::ptrdiff_t;
+  using reference = pair<const Key &, Mapped &>;
+
+  // Holds a dereferenced pair so that `it->second` works.
+  struct pointer {
+    reference ref;
+    const reference *operator->() const { return &ref; }
+  };
+
+  flat_map_iterator() : m_key(nullptr), m_value(nullptr) {}
+
+  flat_map_iterator(const Key *key, Mapped *value)
+      : m_key(key), m_value(value) {}
+
+  // Converts an iterator to a const iterator.
+  template <typename Other>
+  flat_map_iterator(const flat_map_iterator<Key, Other> &other)
+      : m_key(other.m_key), m_value(other.m_value) {}
+
+  reference operator*() const { return reference(*m_key, *m_value); }
+  pointer operator->() const { return pointer{**this}; }
+  reference operator[](difference_type off) const { return *(*this + off); }
+
+  // Returns the key the iterator points to.
+  const Key &key() const { return *m_key; }
+
+  // Returns the value the iterator points to.
+  Mapped &value() const { return *m_value; }
+
+  flat_map_iterator &operator++() {
+    ++m_key;
+    ++m_value;
+    return *this;
+  }
+
+  flat_map_iterator operator++(int) {
+    flat_map_iterator it = *this;
+    ++(*this);
+    return it;
+  }
+
+  flat_map_iterator &operator--() {
+    --m_key;
+    --m_value;
+    return *this;
+  }
+
+  flat_map_iterator operator--(int) {
+    flat_map_iterator it = *this;
+    --(*this);
+    return it;
+  }
+
+  flat_map_iterator &operator+=(difference_type off) {
+    m_key += off;
+    m_value += off;
+    return *this;
+  }
+
+  flat_map_iterator &operator-=(difference_type off) { return *this += -off; }
+
+  flat_map_iterator operator+(difference_type off) const {
+    flat_map_iterator it = *this;
+    return it += off;
+  }
+
+  flat_map_iterator operator-(difference_type off) const {
+    flat_map_iterator it = *this;
+    return it -= off;
+  }
+
+  difference_type operator-(const flat_map_iterator &right) const {
+    return m_key - right.m_key;
+  }
+
+  bool operator==(const flat_map_iterator &right) const {
+    return m_key == right.m_key;
+  }
+  bool operator!=(const flat_map_iterator &right) const {
+    return m_key != right.m_key;
+  }
+  bool operator<(const flat_map_iterator &right) const {
+    return m_key < right.m_key;
+  }
+  bool operator>(const flat_map_iterator &right) const {
+    return m_key > right.m_key;
+  }
+  bool operator<=(const flat_map_iterator &right) const {
+    return m_key <= right.m_key;
+  }
+  bool operator>=(const flat_map_iterator &right) const {
+    return m_key >= right.m_key;
+  }
+
+ private:
+  template <typename K, typename M>
+  friend class flat_map_iterator;
+
+  const Key *m_key;
+  Mapped *m_value;
+};
+
+}  // namespace internal
+
+/*
+    An ordered map stored as two sorted vectors, one of keys and one of
+   mapped values.
+
+    Template Parameters:
+        - Key: The type of the keys.
+        - T: The type of the mapped values.
+        - Compare: The ordering of the keys.
+
+    Lookups binary search the key vector, which is densely packed and never
+   touches the values, and iteration is a linear scan of both vectors. For
+   read-mostly tables of up to a few thousand entries this is much faster
+   than a node-based tree. Inserting or erasing a single element shifts the
+   tail of both vectors, so it costs O(n); build large maps with the bulk
+   constructors or insert_range instead.
+
+    Inserting or erasing invalidates all iterators. Dereferencing an
+   iterator yields a pair<const Key &, T &> rather than a reference to a
+   stored pair. When Compare declares `is_transparent`, the lookup functions
+   also accept any type comparable with the keys.
+*/
+template <typename Key, typename T, typename Compare = less<Key>>
+class flat_map {
+  static constexpr bool transparent = internal::is_transparent_v<Compare>;
+
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = pair<Key, T>;
+  using key_compare = Compare;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference = pair<const Key &, T &>;
+  using const_reference = pair<const Key &, const T &>;
+  using iterator = internal::flat_map_iterator<Key, T>;
+  using const_iterator = internal::flat_map_iterator<Key, const T>;
+  using key_container_type = vector<Key>;
+  using mapped_container_type = vector<T>;
+
+  // Default constructor
+  flat_map() : m_keys(), m_values(), m_comp() {}
+
+  // Constructor taking the key ordering
+  explicit flat_map(const Compare &comp) : m_keys(), m_values(), m_comp(comp) {}
+
+  // Constructor adopting a key vector and a value vector of the same size.
+  // The pairs are sorted by key; of equivalent keys the first one is kept.
+  flat_map(key_container_type keys, mapped_container_type values,
+           const Compare &comp = Compare())
+      : m_keys(move(keys)), m_values(move(values)), m_comp(comp) {
+    check_sizes();
+    sort_unique();
+  }
+
+  // Constructor adopting a key vector that is already sorted and free of
+  // duplicates, together with the matching values.
+  flat_map(sorted_unique_t, key_container_type keys,
+           mapped_container_type values, const Compare &comp = Compare())
+      : m_keys(move(keys)), m_values(move(values)), m_comp(comp) {
+    check_sizes();
+  }
+
+  // Constructor taking a range of pairs in any order; of equivalent keys the
+  // first one is kept.
+  template <typename InputIterator>
+  flat_map(InputIterator first, InputIterator last,
+           const Compare &comp = Compare())
+      : m_keys(), m_values(), m_comp(comp) {
+    append(first, last);
+    sort_unique();
+  }
+
+  // Constructor taking a range of pairs that is already sorted by key and
+  // free of duplicates.
+  template <typename InputIterator>
+  flat_map(sorted_unique_t, InputIterator first, InputIterator last,
+           const Compare &comp = Compare())
+      : m_keys(), m_values(), m_comp(comp) {
+    append(first, last);
+  }
+
+  // Constructor taking an std::initializer_list of pairs in any order.
+  flat_map(std::initializer_list<value_type> values,
+           const Compare &comp = Compare())
+      : flat_map(values.begin(), values.end(), comp) {}
+
+  // Returns an iterator to the first element
+  iterator begin() { return iterator(m_keys.data(), m_values.data()); }
+
+  // Returns a const iterator to the first element
+  const_iterator begin() const {
+    return const_iterator(m_keys.data(), m_values.data());
+  }
+
+  // Returns a const iterator to the first element
+  const_iterator cbegin() const { return begin(); }
+
+  // Returns an iterator past the last element
+  iterator end() { return begin() + size(); }
+
+  // Returns a const iterator past the last element
+  const_iterator end() const { return begin() + size(); }
+
+  // Returns a const iterator past the last element
+  const_iterator cend() const { return end(); }
+
+  // Checks whether the map is empty
+  bool empty() const { return m_keys.empty(); }
+
+  // Returns the number of elements
+  size_type size() const { return m_keys.size(); }
+
+  // Returns the sorted keys
+  const key_container_type &keys() const { return m_keys; }
+
+  // Returns the mapped values, in the order of their keys
+  const mapped_container_type &values() const { return m_values; }
+
+  // Returns the key ordering
+  key_compare key_comp() const { return m_comp; }
+
+  // Reserves room for `count` elements in both vectors
+  void reserve(size_type count) {
+    m_keys.reserve(count);
+    m_values.reserve(count);
+  }
+
+  // Removes every element
+  void clear() {
+    m_keys.clear();
+    m_values.clear();
+  }
+
+  // Inserts `value` unless its key is present. Returns an iterator to the
+  // element with that key and whether the insertion happened.
+  pair<iterator, bool> insert(const value_type &value) {
+    return emplace_key(value.first, value.second);
+  }
+
+  // Constructs a pair from `args` and inserts it unless its key is present.
+  template <typename... Args>
+  pair<iterator, bool> emplace(Args &&...args) {
+    value_type value(open_stl::forward<Args>(args)...);
+    return emplace_key(move(value.first), move(value.second));
+  }
+
+  // Inserts `value` under `key`, or assigns it if the key is present.
+  pair<iterator, bool> insert_or_assign(const key_type &key,
+                                        const mapped_type &value) {
+    size_type position = lower_index(key);
+    if (position < size() && !m_comp(key, m_keys[position])) {
+      m_values[position] = value;
+      return pair<iterator, bool>(begin() + position, false);
+    }
+    internal::vector_insert_at(m_keys, position, key);
+    internal::vector_insert_at(m_values, position, value);
+    return pair<iterator, bool>(begin() + position, true);
+  }
+
+  /*
+      Inserts every pair of a range whose key is not yet present.
+
+      The batch is sorted and deduplicated on its own, then merged into the
+     map from the back, so inserting m pairs into a map of n costs
+     O(m log m + n) instead of the O(n * m) of inserting them one by one.
+  */
+  template <typename InputIterator>
+  void insert_range(InputIterator first, InputIterator last) {
+    flat_map batch(first, last, m_comp);
+    merge(batch);
+  }
+
+  // Inserts every pair of a range that is already sorted by key and free of
+  // duplicates, in O(n + m).
+  template <typename InputIterator>
+  void insert_range(sorted_unique_t, InputIterator first,
+                    InputIterator last) {
+    flat_map batch(sorted_unique, first, last, m_comp);
+    merge(batch);
+  }
+
+  // Returns the value mapped to `key`, inserting a value-initialized one if
+  // the key is absent.
+  mapped_type &operator[](const key_type &key) {
+    return emplace_key(key, mapped_type()).first.value();
+  }
+
+  // Returns the value mapped to `key`; throws std::out_of_range if absent.
+  mapped_type &at(const key_type &key) { return m_values[at_index(key)]; }
+
+  // Returns the value mapped to `key`; throws std::out_of_range if absent.
+  const mapped_type &at(const key_type &key) const {
+    return m_values[at_index(key)];
+  }
+
+  // Returns an iterator to the element with `key`, or end().
+  iterator find(const key_type &key) { return begin() + find_index(key); }
+
+  // Returns a const iterator to the element with `key`, or end().
+  const_iterator find(const key_type &key) const {
+    return begin() + find_index(key);
+  }
+
+  // Heterogeneous overload of find(), enabled for a transparent Compare.
+  template <typename K>
+    requires transparent
+  iterator find(const K &key) {
+    return begin() + find_index(key);
+  }
+
+  // Heterogeneous overload of find(), enabled for a transparent Compare.
+  template <typename K>
+    requires transparent
+  const_iterator find(const K &key) const {
+    return begin() + find_index(key);
+  }
+
+  // Checks whether an element with `key` is present.
+  bool contains(const key_type &key) const { return find_index(key) != size(); }
+
+  // Heterogeneous overload of contains(), enabled for a transparent Compare.
+  template <typename K>
+    requires transparent
+  bool contains(const K &key) const {
+    return find_index(key) != size();
+  }
+
+  // Returns the number of elements with `key`, which is 0 or 1.
+  size_type count(const key_type &key) const { return contains(key) ? 1 : 0; }
+
+  // Returns an iterator to the first element whose key is not ordered
+  // before `key`.
+  iterator lower_bound(const key_type &key) {
+    return begin() + lower_index(key);
+  }
+
+  // Returns a const iterator to the first element whose key is not ordered
+  // before `key`.
+  const_iterator lower_bound(const key_type &key) const {
+    return begin() + lower_index(key);
+  }
+
+  // Returns an iterator to the first element whose key is ordered after
+  // `key`.
+  iterator upper_bound(const key_type &key) {
+    return begin() + upper_index(key);
+  }
+
+  // Returns a const iterator to the first element whose key is ordered after
+  // `key`.
+  const_iterator upper_bound(const key_type &key) const {
+    return begin() + upper_index(key);
+  }
+
+  // Removes the element with `key`, returning how many were removed.
+  size_type erase(const key_type &key) {
+    size_type position = find_index(key);
+    if (position == size()) return 0;
+    erase_index(position);
+    return 1;
+  }
+
+  // Removes the element at `position` and returns an iterator to the element
+  // after it.
+  iterator erase(const_iterator position) {
+    size_type index = position - cbegin();
+    erase_index(index);
+    return begin() + index;
+  }
+
+  // Swaps the contents of two maps.
+  void swap(flat_map &right) {
+    open_stl::swap(m_keys, right.m_keys);
+    open_stl::swap(m_values, right.m_values);
+    open_stl::swap(m_comp, right.m_comp);
+  }
+
+  // Checks if this map holds the same key-value pairs as another map.
+  bool operator==(const flat_map &right) const {
+    return m_keys == right.m_keys && m_values == right.m_values;
+  }
+
+  // Checks if this map differs from another map.
+  bool operator!=(const flat_map &right) const { return !(*this == right); }
+
+ private:
+  key_container_type m_keys;
+  mapped_container_type m_values;
+  Compare m_comp;
+
+  void check_sizes() const {
+    if (m_keys.size() != m_values.size()) {
+      throw std::invalid_argument(
+          "Error: flat_map key and value vectors differ in size. Please pass "
+          "one value per key.");
+    }
+  }
+
+  template <typename InputIterator>
+  void append(InputIterator first, InputIterator last) {
+    for (; first != last; ++first) {
+      m_keys.push_back((*first).first);
+      m_values.push_back((*first).second);
+    }
+  }
+
+  // Sorts the pairs by key and drops all but the first of every run of
+  // equivalent keys. Only an index permutation is sorted, so keys and values
+  // are each moved once, and input that is already sorted is detected in a
+  // single pass and left alone.
+  void sort_unique() {
+    size_type n = m_keys.size();
+    size_type sorted = 1;
+    while (sorted < n && m_comp(m_keys[sorted - 1], m_keys[sorted])) sorted++;
+    if (sorted >= n) return;
+
+    const Key *keys = m_keys.data();
+    Compare comp = m_comp;
+    vector<size_type> order(n);
+    for (size_type i = 0; i < n; i++) {
+      order[i] = i;
+    }
+    // Ties are broken by position so the first of equivalent keys survives.
+    open_stl::sort(order.begin(), order.end(),
+                   [keys, comp](size_type lhs, size_type rhs) {
+                     return comp(keys[lhs], keys[rhs]) ||
+                            (!comp(keys[rhs], keys[lhs]) && lhs < rhs);
+                   });
+    size_type *order_end =
+        open_stl::unique(order.begin(), order.end(),
+                         [keys, comp](size_type lhs, size_type rhs) {
+                           return !comp(keys[lhs], keys[rhs]);
+                         });
+
+    key_container_type sorted_keys;
+    mapped_container_type sorted_values;
+    sorted_keys.reserve(order_end - order.begin());
+    sorted_values.reserve(order_end - order.begin());
+    for (size_type *it = order.begin(); it != order_end; ++it) {
+      sorted_keys.push_back(move(m_keys[*it]));
+      sorted_values.push_back(move(m_values[*it]));
+    }
+    m_keys = move(sorted_keys);
+    m_values = move(sorted_values);
+  }
+
+  /*
+      Moves the elements of `batch` whose keys are not present into this
+     map.
+
+      A first pass counts the keys both maps share, which fixes the merged
+     size. Both vectors are grown once and the merge then runs from the back,
+     filling the new tail, so every element moves at most once and no scratch
+     buffer is needed.
+  */
+  void merge(flat_map &batch) {
+    size_type n = size();
+    size_type m = batch.size();
+    if (m == 0) return;
+    size_type shared = 0;
+    for (size_type i = 0, j = 0; i < n && j < m;) {
+      if (m_comp(m_keys[i], batch.m_keys[j])) {
+        i++;
+      } else if (m_comp(batch.m_keys[j], m_keys[i])) {
+        j++;
+      } else {
+        shared++;
+        i++;
+        j++;
+      }
+    }
+    size_type out = n + m - shared;
+    m_keys.resize(out);
+    m_values.resize(out);
+    size_type i = n;
+    size_type j = m;
+    // Once out == i, every batch key left is a duplicate and the first i
+    // elements are already in place; going on would move them onto
+    // themselves.
+    while (j > 0 && out != i) {
+      if (i > 0 && m_comp(batch.m_keys[j - 1], m_keys[i - 1])) {
+        --i;
+        --out;
+        m_keys[out] = move(m_keys[i]);
+        m_values[out] = move(m_values[i]);
+      } else if (i > 0 && !m_comp(m_keys[i - 1], batch.m_keys[j - 1])) {
+        --j;  // The key is present; the existing value wins.
+      } else {
+        --j;
+        --out;
+        m_keys[out] = move(batch.m_keys[j]);
+        m_values[out] = move(batch.m_values[j]);
+      }
+    }
+  }
+
+  template <typename K, typename V>
+  pair<iterator, bool> emplace_key(K &&key, V &&value) {
+    size_type position = lower_index(key);
+    if (position < size() && !m_comp(key, m_keys[position])) {
+      return pair<iterator, bool>(begin() + position, false);
+    }
+    internal::vector_insert_at(m_keys, position, open_stl::forward<K>(key));
+    internal::vector_insert_at(m_values, position,
+                               open_stl::forward<V>(value));
+    return pair<iterator, bool>(begin() + position, true);
+  }
+
+  void erase_index(size_type position) {
+    m_keys.erase(m_keys.begin() + position);
+    m_values.erase(m_values.begin() + position);
+  }
+
+  template <typename K>
+  size_type lower_index(const K &key) const {
+    return open_stl::lower_bound(m_keys.begin(), m_keys.end(), key, m_comp) -
+           m_keys.begin();
+  }
+
+  template <typename K>
+  size_type upper_index(const K &key) const {
+    return open_stl::upper_bound(m_keys.begin(), m_keys.end(), key, m_comp) -
+           m_keys.begin();
+  }
+
+  // Returns the index of `key`, or size() if it is absent.
+  template <typename K>
+  size_type find_index(const K &key) const {
+    size_type position = lower_index(key);
+    if (position < size() && !m_comp(key, m_keys[position])) return position;
+    return size();
+  }
+
+  template <typename K>
+  size_type at_index(const K &key) const {
+    size_type position = find_index(key);
+    if (position == size()) {
+      throw std::out_of_range(
+          "Error: flat_map key not found. Please ensure the key is present "
+          "before calling at().");
+    }
+    return position;
+  }
+};
+}  // namespace open_stl
+
+#endif  // OPEN_STL_FLAT_MAP_H_
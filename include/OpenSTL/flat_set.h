@@ -0,0 +1,292 @@
+#ifndef OPEN_STL_FLAT_SET_H_
+#define OPEN_STL_FLAT_SET_H_
+
+#include <OpenSTL/algorithm.h>
+#include <OpenSTL/flat_map.h>
+#include <OpenSTL/functional.h>
+#include <OpenSTL/utility.h>
+#include <OpenSTL/vector.h>
+
+#include <cstddef>
+#include <initializer_list>
+
+namespace open_stl {
+/*
+    An ordered set stored as one sorted vector of keys.
+
+    Template Parameters:
+        - Key: The type of the keys.
+        - Compare: The ordering of the keys.
+
+    Lookups binary search the vector and iteration is a linear scan, which
+   for read-mostly sets of up to a few thousand keys beats any node-based
+   tree. Inserting or erasing a single key shifts the tail of the vector, so
+   it costs O(n); build large sets with the bulk constructors or
+   insert_range instead. Inserting or erasing invalidates all iterators.
+   When Compare declares `is_transparent`, the lookup functions also accept
+   any type comparable with the keys.
+*/
+template <typename Key, typename Compare = less<Key>>
+class flat_set {
+  static constexpr bool transparent = internal::is_transparent_v<Compare>;
+
+ public:
+  using key_type = Key;
+  using value_type = Key;
+  using key_compare = Compare;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference = const Key &;
+  using const_reference = const Key &;
+  // Keys are never modifiable through an iterator.
+  using iterator = const Key *;
+  using const_iterator = const Key *;
+  using container_type = vector<Key>;
+
+  // Default constructor
+  flat_set() : m_keys(), m_comp() {}
+
+  // Constructor taking the key ordering
+  explicit flat_set(const Compare &comp) : m_keys(), m_comp(comp) {}
+
+  // Constructor adopting a vector of keys in any order; duplicates are
+  // dropped.
+  explicit flat_set(container_type keys, const Compare &comp = Compare())
+      : m_keys(move(keys)), m_comp(comp) {
+    sort_unique();
+  }
+
+  // Constructor adopting a vector that is already sorted and free of
+  // duplicates.
+  flat_set(sorted_unique_t, container_type keys,
+           const Compare &comp = Compare())
+      : m_keys(move(keys)), m_comp(comp) {}
+
+  // Constructor taking a range of keys in any order.
+  template <typename InputIterator>
+  flat_set(InputIterator first, InputIterator last,
+           const Compare &comp = Compare())
+      : m_keys(), m_comp(comp) {
+    for (; first != last; ++first) {
+      m_keys.push_back(*first);
+    }
+    sort_unique();
+  }
+
+  // Constructor taking a range of keys that is already sorted and free of
+  // duplicates.
+  template <typename InputIterator>
+  flat_set(sorted_unique_t, InputIterator first, InputIterator last,
+           const Compare &comp = Compare())
+      : m_keys(), m_comp(comp) {
+    for (; first != last; ++first) {
+      m_keys.push_back(*first);
+    }
+  }
+
+  // Constructor taking an std::initializer_list of keys in any order.
+  flat_set(std::initializer_list<value_type> values,
+           const Compare &comp = Compare())
+      : flat_set(values.begin(), values.end(), comp) {}
+
+  // Returns an iterator to the first key
+  iterator begin() const { return m_keys.begin(); }
+
+  // Returns an iterator to the first key
+  const_iterator cbegin() const { return begin(); }
+
+  // Returns an iterator past the last key
+  iterator end() const { return m_keys.end(); }
+
+  // Returns an iterator past the last key
+  const_iterator cend() const { return end(); }
+
+  // Checks whether the set is empty
+  bool empty() const { return m_keys.empty(); }
+
+  // Returns the number of keys
+  size_type size() const { return m_keys.size(); }
+
+  // Returns the sorted keys
+  const container_type &keys() const { return m_keys; }
+
+  // Returns the key ordering
+  key_compare key_comp() const { return m_comp; }
+
+  // Reserves room for `count` keys
+  void reserve(size_type count) { m_keys.reserve(count); }
+
+  // Removes every key
+  void clear() { m_keys.clear(); }
+
+  // Inserts `value` unless it is present. Returns an iterator to the key and
+  // whether the insertion happened.
+  pair<iterator, bool> insert(const value_type &value) {
+    size_type position = lower_index(value);
+    if (position < size() && !m_comp(value, m_keys[position])) {
+      return pair<iterator, bool>(begin() + position, false);
+    }
+    internal::vector_insert_at(m_keys, position, value);
+    return pair<iterator, bool>(begin() + position, true);
+  }
+
+  // Constructs a key from `args` and inserts it unless it is present.
+  template <typename... Args>
+  pair<iterator, bool> emplace(Args &&...args) {
+    return insert(value_type(open_stl::forward<Args>(args)...));
+  }
+
+  /*
+      Inserts every key of a range that is not yet present.
+
+      The batch is sorted and deduplicated on its own, then merged into the
+     set from the back, so inserting m keys into a set of n costs
+     O(m log m + n) instead of the O(n * m) of inserting them one by one.
+  */
+  template <typename InputIterator>
+  void insert_range(InputIterator first, InputIterator last) {
+    flat_set batch(first, last, m_comp);
+    merge(batch);
+  }
+
+  // Inserts every key of a range that is already sorted and free of
+  // duplicates, in O(n + m).
+  template <typename InputIterator>
+  void insert_range(sorted_unique_t, InputIterator first,
+                    InputIterator last) {
+    flat_set batch(sorted_unique, first, last, m_comp);
+    merge(batch);
+  }
+
+  // Returns an iterator to `key`, or end().
+  iterator find(const key_type &key) const { return begin() + find_index(key); }
+
+  // Heterogeneous overload of find(), enabled for a transparent Compare.
+  template <typename K>
+    requires transparent
+  iterator find(const K &key) const {
+    return begin() + find_index(key);
+  }
+
+  // Checks whether `key` is present.
+  bool contains(const key_type &key) const { return find_index(key) != size(); }
+
+  // Heterogeneous overload of contains(), enabled for a transparent Compare.
+  template <typename K>
+    requires transparent
+  bool contains(const K &key) const {
+    return find_index(key) != size();
+  }
+
+  // Returns the number of keys equal to `key`, which is 0 or 1.
+  size_type count(const key_type &key) const { return contains(key) ? 1 : 0; }
+
+  // Returns an iterator to the first key not ordered before `key`.
+  iterator lower_bound(const key_type &key) const {
+    return begin() + lower_index(key);
+  }
+
+  // Returns an iterator to the first key ordered after `key`.
+  iterator upper_bound(const key_type &key) const {
+    return open_stl::upper_bound(begin(), end(), key, m_comp);
+  }
+
+  // Removes `key`, returning how many keys were removed.
+  size_type erase(const key_type &key) {
+    size_type position = find_index(key);
+    if (position == size()) return 0;
+    m_keys.erase(m_keys.begin() + position);
+    return 1;
+  }
+
+  // Removes the key at `position` and returns an iterator to the key after
+  // it.
+  iterator erase(const_iterator position) {
+    return m_keys.erase(position);
+  }
+
+  // Swaps the contents of two sets.
+  void swap(flat_set &right) {
+    open_stl::swap(m_keys, right.m_keys);
+    open_stl::swap(m_comp, right.m_comp);
+  }
+
+  // Checks if this set holds the same keys as another set.
+  bool operator==(const flat_set &right) const {
+    return m_keys == right.m_keys;
+  }
+
+  // Checks if this set differs from another set.
+  bool operator!=(const flat_set &right) const { return !(*this == right); }
+
+ private:
+  container_type m_keys;
+  Compare m_comp;
+
+  // Sorts the keys and drops duplicates, unless they are already strictly
+  // increasing.
+  void sort_unique() {
+    size_type n = m_keys.size();
+    size_type sorted = 1;
+    while (sorted < n && m_comp(m_keys[sorted - 1], m_keys[sorted])) sorted++;
+    if (sorted >= n) return;
+    Compare comp = m_comp;
+    open_stl::sort(m_keys.begin(), m_keys.end(), comp);
+    Key *keys_end = open_stl::unique(
+        m_keys.begin(), m_keys.end(),
+        [comp](const Key &lhs, const Key &rhs) { return !comp(lhs, rhs); });
+    m_keys.erase(keys_end, m_keys.end());
+  }
+
+  // Moves the keys of `batch` that are not present into this set, merging
+  // from the back as flat_map::insert_range does.
+  void merge(flat_set &batch) {
+    size_type n = size();
+    size_type m = batch.size();
+    if (m == 0) return;
+    size_type shared = 0;
+    for (size_type i = 0, j = 0; i < n && j < m;) {
+      if (m_comp(m_keys[i], batch.m_keys[j])) {
+        i++;
+      } else if (m_comp(batch.m_keys[j], m_keys[i])) {
+        j++;
+      } else {
+        shared++;
+        i++;
+        j++;
+      }
+    }
+    size_type out = n + m - shared;
+    m_keys.resize(out);
+    size_type i = n;
+    size_type j = m;
+    // Once out == i, every batch key left is a duplicate and the first i
+    // elements are already in place; going on would move them onto
+    // themselves.
+    while (j > 0 && out != i) {
+      if (i > 0 && m_comp(batch.m_keys[j - 1], m_keys[i - 1])) {
+        m_keys[--out] = move(m_keys[--i]);
+      } else if (i > 0 && !m_comp(m_keys[i - 1], batch.m_keys[j - 1])) {
+        --j;
+      } else {
+        m_keys[--out] = move(batch.m_keys[--j]);
+      }
+    }
+  }
+
+  template <typename K>
+  size_type lower_index(const K &key) const {
+    return open_stl::lower_bound(begin(), end(), key, m_comp) - begin();
+  }
+
+  // Returns the index of `key`, or size() if it is absent.
+  template <typename K>
+  size_type find_index(const K &key) const {
+    size_type position = lower_index(key);
+    if (position < size() && !m_comp(key, m_keys[position])) return position;
+    return size();
+  }
+};
+}  // namespace open_stl
+
+#endif  // OPEN_STL_FLAT_SET_H_
@@ -0,0 +1,164 @@
+#ifndef OPEN_STL_FUNCTIONAL_H_
+#define OPEN_STL_FUNCTIONAL_H_
+
+namespace open_stl {
+/*
+    Function object for performing addition.
+
+    Template Parameters:
+        - T: The type of the operands.
+
+    This function object returns the sum of its two arguments. It is the
+   default reduction operation used by the numeric algorithms.
+*/
+template <typename T = void>
+struct plus {
+  constexpr T operator()(const T &lhs, const T &rhs) const { return lhs + rhs; }
+};
+
+/*
+    Specialization of plus that deduces the operand types.
+
+    This specialization forwards both operands to the built-in addition
+   operator, so mixed types are added without converting them first.
+*/
+template <>
+struct plus<void> {
+  template <typename T, typename U>
+  constexpr auto operator()(const T &lhs, const U &rhs) const {
+    return lhs + rhs;
+  }
+};
+
+/*
+    Function object for performing multiplication.
+
+    Template Parameters:
+        - T: The type of the operands.
+
+    This function object returns the product of its two arguments. It is the
+   default transformation used by transform_reduce over two ranges.
+*/
+template <typename T = void>
+struct multiplies {
+  constexpr T operator()(const T &lhs, const T &rhs) const { return lhs * rhs; }
+};
+
+/*
+    Specialization of multiplies that deduces the operand types.
+
+    This specialization forwards both operands to the built-in multiplication
+   operator, so mixed types are multiplied without converting them first.
+*/
+template <>
+struct multiplies<void> {
+  template <typename T, typename U>
+  constexpr auto operator()(const T &lhs, const U &rhs) const {
+    return lhs * rhs;
+  }
+};
+
+/*
+    Function object for performing a less-than comparison.
+
+    Template Parameters:
+        - T: The type of the operands.
+
+    This function object returns true if its first argument is less than its
+   second. It is the default ordering used by the searching and sorting
+   algorithms.
+*/
+template <typename T = void>
+struct less {
+  constexpr bool operator()(const T &lhs, const T &rhs) const {
+    return lhs < rhs;
+  }
+};
+
+/*
+    Specialization of less that deduces the operand types.
+
+    This specialization compares operands of different types without
+   converting them first. It declares `is_transparent`, which lets containers
+   look up keys by any type comparable with the stored key.
+*/
+template <>
+struct less<void> {
+  using is_transparent = void;
+
+  template <typename T, typename U>
+  constexpr bool operator()(const T &lhs, const U &rhs) const {
+    return lhs < rhs;
+  }
+};
+
+/*
+    Function object for performing a greater-than comparison.
+
+    Template Parameters:
+        - T: The type of the operands.
+
+    Ordering a heap with it puts the smallest element on top, which turns
+   priority_queue into a min-priority queue.
+*/
+template <typename T = void>
+struct greater {
+  constexpr bool operator()(const T &lhs, const T &rhs) const {
+    return lhs > rhs;
+  }
+};
+
+// Specialization of greater that deduces the operand types.
+template <>
+struct greater<void> {
+  using is_transparent = void;
+
+  template <typename T, typename U>
+  constexpr bool operator()(const T &lhs, const U &rhs) const {
+    return lhs > rhs;
+  }
+};
+
+/*
+    Function object for performing an equality comparison.
+
+    Template Parameters:
+        - T: The type of the operands.
+
+    This function object returns true if its arguments compare equal. It is
+   the default key comparison of the hash containers.
+*/
+template <typename T = void>
+struct equal_to {
+  constexpr bool operator()(const T &lhs, const T &rhs) const {
+    return lhs == rhs;
+  }
+};
+
+/*
+    Specialization of equal_to that deduces the operand types.
+
+    Like less<void>, it declares `is_transparent` so hash containers can look
+   up keys by any type comparable with the stored key.
+*/
+template <>
+struct equal_to<void> {
+  using is_transparent = void;
+
+  template <typename T, typename U>
+  constexpr bool operator()(const T &lhs, const U &rhs) const {
+    return lhs == rhs;
+  }
+};
+
+namespace internal {
+// True if a function object declares `is_transparent`, allowing containers
+// to look up keys by types other than the key type.
+template <typename T>
+inline constexpr bool is_transparent_v =
+    requires { typename T::is_transparent; };
+}  // namespace internal
+
+}  // namespace open_stl
+
+#endif  // OPEN_STL_FUNCTIONAL_H_
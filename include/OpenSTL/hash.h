@@ -0,0 +1,405 @@
+#ifndef OPEN_STL_HASH_H_
+#define OPEN_STL_HASH_H_
+
+#include <OpenSTL/array.h>
+#include <OpenSTL/string.h>
+#include <OpenSTL/string_view.h>
+#include <OpenSTL/type_traits.h>
+#include <OpenSTL/vector.h>
+
+#if defined(_MSC_VER) && defined(_M_X64) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <random>
+
+namespace open_stl {
+namespace internal {
+
+// Odd 64-bit constants with balanced bits, from wyhash.
+inline constexpr std::uint64_t hash_secret[4] = {
+    0x2d358dccaa6c78a5ull, 0x8bb84b93962eacc9ull, 0x4b33a62ed433d4a3ull,
+    0x4d5a2da51de1aa47ull};
+
+// Computes the full 128-bit product of two 64-bit values.
+inline void mul128(std::uint64_t lhs, std::uint64_t rhs, std::uint64_t &low,
+                   std::uint64_t &high) {
+#if defined(__SIZEOF_INT128__)
+  // __extension__ keeps -Wpedantic quiet about the non-standard type.
+  __extension__ typedef unsigned __int128 uint128;
+  uint128 product = static_cast<uint128>(lhs) * rhs;
+  low = static_cast<std::uint64_t>(product);
+  high = static_cast<std::uint64_t>(product >> 64);
+#elif defined(_MSC_VER) && defined(_M_X64) && !defined(__clang__)
+  low = _umul128(lhs, rhs, &high);
+#else
+  std::uint64_t lhs_high = lhs >> 32;
+  std::uint64_t lhs_low = lhs & 0xffffffffull;
+  std::uint64_t rhs_high = rhs >> 32;
+  std::uint64_t rhs_low = rhs & 0xffffffffull;
+  std::uint64_t high_low = lhs_high * rhs_low;
+  std::uint64_t low_high = lhs_low * rhs_high;
+  std::uint64_t low_low = lhs_low * rhs_low;
+  std::uint64_t cross =
+      (low_low >> 32) + (high_low & 0xffffffffull) + low_high;
+  high = lhs_high * rhs_high + (high_low >> 32) + (cross >> 32);
+  low = (cross << 32) | (low_low & 0xffffffffull);
+#endif
+}
+
+// Multiplies two 64-bit values into 128 bits and returns the low half xor
+// the high half. Every output bit depends on every input bit, which makes
+// this the core mixing step of all the hashes below.
+inline std::uint64_t mum(std::uint64_t lhs, std::uint64_t rhs) {
+  std::uint64_t low;
+  std::uint64_t high;
+  mul128(lhs, rhs, low, high);
+  return low ^ high;
+}
+
+// Hashes one 64-bit word with a single wide multiply.
+inline std::uint64_t mix64(std::uint64_t value, std::uint64_t seed) {
+  return mum(value ^ seed ^ hash_secret[0], hash_secret[1]);
+}
+
+// Returns 64 mixed bits of hash for `key`, whatever the width of
+// std::size_t. The result of `hash` is used as is only when it declares
+// `is_avalanching` and already has 64 bits; otherwise it goes through
+// mix64, which also spreads a 32-bit result over the high half. For the
+// filters, which index with one half of the hash and derive fingerprints
+// or bit masks from the other.
+template <typename Hash, typename Key>
+std::uint64_t hash64(const Hash &hash, const Key &key) {
+  std::uint64_t value = static_cast<std::uint64_t>(hash(key));
+  if constexpr (sizeof(std::size_t) >= sizeof(std::uint64_t) &&
+                requires { typename Hash::is_avalanching; }) {
+    return value;
+  } else {
+    return mix64(value, 0);
+  }
+}
+
+inline std::uint64_t read64(const unsigned char *bytes) {
+  std::uint64_t value;
+  std::memcpy(&value, bytes, sizeof(value));
+  return value;
+}
+
+inline std::uint64_t read32(const unsigned char *bytes) {
+  std::uint32_t value;
+  std::memcpy(&value, bytes, sizeof(value));
+  return value;
+}
+
+// True for the element types whose ranges are hashed as raw bytes.
+template <typename T>
+inline constexpr bool is_byte_v =
+    is_same<T, char>::value || is_same<T, signed char>::value ||
+    is_same<T, unsigned char>::value || is_same<T, char8_t>::value ||
+    is_same<T, std::byte>::value;
+
+// Shared by the integer specializations of hash.
+template <typename T>
+struct integer_hash {
+  using is_avalanching = void;
+
+  std::size_t operator()(T value, std::uint64_t seed = 0) const {
+    return static_cast<std::size_t>(
+        mix64(static_cast<std::uint64_t>(value), seed));
+  }
+};
+
+}  // namespace internal
+
+/*
+    Hashes a range of bytes.
+
+    Parameters:
+        - data: The first byte.
+        - length: The number of bytes.
+        - seed: Selects one of 2^64 unrelated hash functions.
+
+    Returns:
+        - A 64-bit hash of the bytes.
+
+    This is wyhash (final version 4.2): inputs of up to 16 bytes are read
+   with a couple of overlapping loads and mixed once; longer inputs are
+   consumed 48 bytes per iteration by three independent multiply chains,
+   which keeps the multiplier busy and runs at memory bandwidth. It is
+   fast and well distributed but not cryptographic: with a fixed, public
+   seed an attacker can craft colliding keys, so containers fed untrusted
+   keys should use seeded_hash.
+*/
+inline std::uint64_t hash_bytes(const void *data, std::size_t length,
+                                std::uint64_t seed = 0) {
+  using internal::hash_secret;
+  using internal::mum;
+  using internal::read32;
+  using internal::read64;
+  const unsigned char *bytes = static_cast<const unsigned char *>(data);
+  seed ^= mum(seed ^ hash_secret[0], hash_secret[1]);
+  std::uint64_t a;
+  std::uint64_t b;
+  if (length <= 16) {
+    if (length >= 4) {
+      // Two pairs of overlapping 4-byte loads cover every length in [4, 16].
+      std::size_t middle = (length >> 3) << 2;
+      a = (read32(bytes) << 32) | read32(bytes + middle);
+      b = (read32(bytes + length - 4) << 32) |
+          read32(bytes + length - 4 - middle);
+    } else if (length > 0) {
+      a = (std::uint64_t(bytes[0]) << 16) |
+          (std::uint64_t(bytes[length >> 1]) << 8) | bytes[length - 1];
+      b = 0;
+    } else {
+      a = 0;
+      b = 0;
+    }
+  } else {
+    std::size_t remaining = length;
+    if (remaining >= 48) {
+      std::uint64_t seed1 = seed;
+      std::uint64_t seed2 = seed;
+      do {
+        seed = mum(read64(bytes) ^ hash_secret[1], read64(bytes + 8) ^ seed);
+        seed1 = mum(read64(bytes + 16) ^ hash_secret[2],
+                    read64(bytes + 24) ^ seed1);
+        seed2 = mum(read64(bytes + 32) ^ hash_secret[3],
+                    read64(bytes + 40) ^ seed2);
+        bytes += 48;
+        remaining -= 48;
+      } while (remaining >= 48);
+      seed ^= seed1 ^ seed2;
+    }
+    while (remaining > 16) {
+      seed = mum(read64(bytes) ^ hash_secret[1], read64(bytes + 8) ^ seed);
+      bytes += 16;
+      remaining -= 16;
+    }
+    // The last 16 bytes of the input, overlapping what was already mixed.
+    a = read64(bytes + remaining - 16);
+    b = read64(bytes + remaining - 8);
+  }
+  a ^= hash_secret[1];
+  b ^= seed;
+  internal::mul128(a, b, a, b);
+  return mum(a ^ hash_secret[0] ^ length, b ^ hash_secret[1]);
+}
+
+/*
+    Function object that hashes a value.
+
+    Template Parameters:
+        - T: The type of the value.
+
+    Specializations cover the integer, floating-point and pointer types and
+   contiguous byte containers (vector and array of char, signed char,
+   unsigned char, char8_t or std::byte). Every specialization:
+        - returns a hash whose bits are all well mixed, and says so by
+   declaring `is_avalanching`, so the hash containers use it as is;
+        - accepts an optional 64-bit seed as a second argument, which is what
+   seeded_hash calls.
+
+    Types without a specialization fall back to std::hash<T>, whose result
+   is mixed once more since standard library hashes are often the identity.
+*/
+template <typename T>
+struct hash {
+  using is_avalanching = void;
+
+  std::size_t operator()(const T &value, std::uint64_t seed = 0) const {
+    return static_cast<std::size_t>(
+        internal::mix64(std::hash<T>()(value), seed));
+  }
+};
+
+template <>
+struct hash<bool> : internal::integer_hash<bool> {};
+template <>
+struct hash<char> : internal::integer_hash<char> {};
+template <>
+struct hash<signed char> : internal::integer_hash<signed char> {};
+template <>
+struct hash<unsigned char> : internal::integer_hash<unsigned char> {};
+template <>
+struct hash<char8_t> : internal::integer_hash<char8_t> {};
+template <>
+struct hash<char16_t> : internal::integer_hash<char16_t> {};
+template <>
+struct hash<char32_t> : internal::integer_hash<char32_t> {};
+template <>
+struct hash<wchar_t> : internal::integer_hash<wchar_t> {};
+template <>
+struct hash<short> : internal::integer_hash<short> {};
+template <>
+struct hash<unsigned short> : internal::integer_hash<unsigned short> {};
+template <>
+struct hash<int> : internal::integer_hash<int> {};
+template <>
+struct hash<unsigned int> : internal::integer_hash<unsigned int> {};
+template <>
+struct hash<long> : internal::integer_hash<long> {};
+template <>
+struct hash<unsigned long> : internal::integer_hash<unsigned long> {};
+template <>
+struct hash<long long> : internal::integer_hash<long long> {};
+template <>
+struct hash<unsigned long long>
+    : internal::integer_hash<unsigned long long> {};
+
+// Hashes a float by its bits; 0.0f and -0.0f compare equal, so both hash as
+// 0.0f.
+template <>
+struct hash<float> {
+  using is_avalanching = void;
+
+  std::size_t operator()(float value, std::uint64_t seed = 0) const {
+    if (value == 0.0f) value = 0.0f;
+    std::uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return static_cast<std::size_t>(internal::mix64(bits, seed));
+  }
+};
+
+// Hashes a double by its bits; 0.0 and -0.0 compare equal, so both hash as
+// 0.0.
+template <>
+struct hash<double> {
+  using is_avalanching = void;
+
+  std::size_t operator()(double value, std::uint64_t seed = 0) const {
+    if (value == 0.0) value = 0.0;
+    std::uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return static_cast<std::size_t>(internal::mix64(bits, seed));
+  }
+};
+
+// Hashes a long double through double. Its object representation may
+// contain padding bytes, so the bits cannot be hashed directly; values that
+// compare equal still round to the same double.
+template <>
+struct hash<long double> {
+  using is_avalanching = void;
+
+  std::size_t operator()(long double value, std::uint64_t seed = 0) const {
+    return hash<double>()(static_cast<double>(value), seed);
+  }
+};
+
+// Hashes a pointer by its address.
+template <typename T>
+struct hash<T *> {
+  using is_avalanching = void;
+
+  std::size_t operator()(T *value, std::uint64_t seed = 0) const {
+    return static_cast<std::size_t>(internal::mix64(
+        static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(value)),
+        seed));
+  }
+};
+
+// Hashes the bytes of a vector of byte-sized elements.
+template <typename T, typename Allocator>
+  requires internal::is_byte_v<T>
+struct hash<vector<T, Allocator>> {
+  using is_avalanching = void;
+
+  std::size_t operator()(const vector<T, Allocator> &value,
+                         std::uint64_t seed = 0) const {
+    return static_cast<std::size_t>(
+        hash_bytes(value.data(), value.size(), seed));
+  }
+};
+
+// Hashes the bytes of an array of byte-sized elements.
+template <typename T, std::size_t N>
+  requires internal::is_byte_v<T>
+struct hash<array<T, N>> {
+  using is_avalanching = void;
+
+  std::size_t operator()(const array<T, N> &value,
+                         std::uint64_t seed = 0) const {
+    return static_cast<std::size_t>(hash_bytes(value.data(), N, seed));
+  }
+};
+
+// Hashes the characters of a string.
+template <typename CharT, typename Allocator>
+struct hash<basic_string<CharT, Allocator>> {
+  using is_avalanching = void;
+
+  std::size_t operator()(const basic_string<CharT, Allocator> &value,
+                         std::uint64_t seed = 0) const {
+    return static_cast<std::size_t>(
+        hash_bytes(value.data(), value.size() * sizeof(CharT), seed));
+  }
+};
+
+// Hashes the characters of a string_view, agreeing with hash<basic_string>.
+template <typename CharT>
+struct hash<basic_string_view<CharT>> {
+  using is_avalanching = void;
+
+  std::size_t operator()(basic_string_view<CharT> value,
+                         std::uint64_t seed = 0) const {
+    return static_cast<std::size_t>(
+        hash_bytes(value.data(), value.size() * sizeof(CharT), seed));
+  }
+};
+
+/*
+    Returns a seed drawn from std::random_device once per process.
+
+    Seeding hash tables with it makes their layout unpredictable from the
+   outside, so keys cannot be chosen ahead of time to collide.
+*/
+inline std::uint64_t process_hash_seed() {
+  static const std::uint64_t seed = [] {
+    std::random_device device;
+    std::uint64_t high = device();
+    std::uint64_t low = device();
+    return (high << 32) ^ low;
+  }();
+  return seed;
+}
+
+/*
+    Function object that hashes a value with a per-instance seed.
+
+    Template Parameters:
+        - T: The type of the value.
+
+    A default-constructed seeded_hash uses process_hash_seed(). Use it as the
+   Hash parameter of a hash container whose keys come from untrusted input,
+   to resist hash-flooding attacks. The hash is as fast as hash<T>, but
+   varies from run to run, so never persist it.
+*/
+template <typename T>
+struct seeded_hash {
+  using is_avalanching = void;
+
+  // Constructor using the per-process random seed
+  seeded_hash() : m_seed(process_hash_seed()) {}
+
+  // Constructor taking an explicit seed
+  explicit seeded_hash(std::uint64_t seed) : m_seed(seed) {}
+
+  std::size_t operator()(const T &value) const {
+    return hash<T>()(value, m_seed);
+  }
+
+  // Returns the seed
+  std::uint64_t seed() const { return m_seed; }
+
+ private:
+  std::uint64_t m_seed;
+};
+
+}  // namespace open_stl
+
+#endif  // OPEN_STL_HASH_H_
@@ -0,0 +1,532 @@
+#ifndef OPEN_STL_HIVE_H_
+#define OPEN_STL_HIVE_H_
+
+#include <OpenSTL/internal/iterator.h>
+#include <OpenSTL/memory.h>
+#include <OpenSTL/utility.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <type_traits>
+
+namespace open_stl {
+template <typename T, typename Allocator>
+class hive;
+
+namespace internal {
+
+// Marks the end of a group's list of free skipblocks.
+inline constexpr std::uint16_t hive_no_block = 0xffff;
+
+/*
+    A block of hive elements with its skipfield.
+
+    Slots [0, last) have held an element; some of them are erased. The
+   erased slots form maximal runs called skipblocks, and the skipfield
+   records them with the low-complexity jump-counting pattern: the first and
+   the last node of a skipblock hold its length, every live slot holds 0.
+   Interior nodes keep a stale length, but never 0, so a slot is live
+   exactly when its skipfield entry is 0.
+   Iterating forward from a live slot is then `++i; i += skipfield[i]`, and
+   backward `--i; i -= skipfield[i]`, with no branch on how many slots were
+   erased. skipfield[last] and beyond are 0, so the run to the right of the
+   last slot in use is never mistaken for a skipblock.
+
+    The skipblocks of a group are also kept in a doubly linked free list,
+   indexed by their first slot, so an insertion finds a free slot in O(1).
+*/
+template <typename T>
+struct hive_group {
+  T *elements;
+  // capacity + 1 entries; the extra one stays 0.
+  std::uint16_t *skipfield;
+  // Free list links, valid at the first slot of every skipblock.
+  std::uint16_t *next_free;
+  std::uint16_t *prev_free;
+  hive_group *next;
+  hive_group *prev;
+  // Neighbours in the hive's list of groups that have free skipblocks.
+  hive_group *next_erased;
+  hive_group *prev_erased;
+  std::uint16_t capacity;
+  std::uint16_t last;
+  std::uint16_t size;
+  std::uint16_t free_head;
+};
+
+/*
+    Bidirectional iterator over a hive.
+
+    Template Parameters:
+        - T: The element type.
+        - Const: Whether the iterator gives const access.
+*/
+template <typename T, bool Const>
+class hive_iterator {
+ public:
+  using iterator_category = bidirectional_iterator_tag;
+  using value_type = T;
+  using difference_type = std::ptrdiff_t;
+  using pointer = std::conditional_t<Const, const T *, T *>;
+  using reference = std::conditional_t<Const, const T &, T &>;
+
+  hive_iterator() : m_group(nullptr), m_index(0) {}
+  hive_iterator(hive_group<T> *group, std::size_t index)
+      : m_group(group), m_index(index) {}
+
+  // Converts an iterator to a const iterator.
+  template <bool OtherConst>
+    requires(Const && !OtherConst)
+  hive_iterator(const hive_iterator<T, OtherConst> &other)
+      : m_group(other.m_group), m_index(other.m_index) {}
+
+  reference operator*() const { return m_group->elements[m_index]; }
+  pointer operator->() const { return &**this; }
+
+  hive_iterator &operator++() {
+    std::uint16_t *skipfield = m_group->skipfield;
+    ++m_index;
+    m_index += skipfield[m_index];
+    if (m_index == m_group->last && m_group->next != nullptr) {
+      m_group = m_group->next;
+      m_index = m_group->skipfield[0];
+    }
+    return *this;
+  }
+
+  hive_iterator operator++(int) {
+    hive_iterator it = *this;
+    ++*this;
+    return it;
+  }
+
+  hive_iterator &operator--() {
+    std::ptrdiff_t index = std::ptrdiff_t(m_index) - 1;
+    if (index >= 0) index -= m_group->skipfield[index];
+    if (index < 0) {
+      m_group = m_group->prev;
+      index = std::ptrdiff_t(m_group->last) - 1;
+      index -= m_group->skipfield[index];
+    }
+    m_index = std::size_t(index);
+    return *this;
+  }
+
+  hive_iterator operator--(int) {
+    hive_iterator it = *this;
+    --*this;
+    return it;
+  }
+
+  bool operator==(const hive_iterator &right) const {
+    return m_group == right.m_group && m_index == right.m_index;
+  }
+  bool operator!=(const hive_iterator &right) const {
+    return !(*this == right);
+  }
+
+ private:
+  template <typename U, typename Allocator>
+  friend class open_stl::hive;
+  template <typename U, bool OtherConst>
+  friend class hive_iterator;
+
+  hive_group<T> *m_group;
+  std::size_t m_index;
+};
+
+}  // namespace internal
+
+/*
+    An unordered container with stable element addresses and O(1) insert
+   and erase, after the colony/hive design of plf::colony and std::hive.
+
+    Template Parameters:
+        - T: The type of the elements.
+        - Allocator: The allocator; it is rebound for the group bookkeeping.
+
+    Elements live in groups of slots that never move, so pointers and
+   iterators to an element stay valid until that element is erased. Erasing
+   only marks the slot in the group's jump-counting skipfield (see
+   hive_group) and links it into a free list; insertion reuses a freed slot
+   when there is one and otherwise appends to the last group. Iteration
+   jumps over any run of erased slots in a single step, so it stays close to
+   the speed of walking an array. A group whose elements are all erased is
+   released.
+
+    Group capacities start at 8 slots and double up to 8192. The order of
+   elements is unspecified: new elements may fill gaps anywhere.
+*/
+template <typename T, typename Allocator = allocator<T>>
+class hive {
+  using group = internal::hive_group<T>;
+
+ public:
+  using value_type = T;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference = T &;
+  using const_reference = const T &;
+  using pointer = T *;
+  using const_pointer = const T *;
+  using iterator = internal::hive_iterator<T, false>;
+  using const_iterator = internal::hive_iterator<T, true>;
+
+  // Default constructor
+  hive()
+      : m_first(nullptr),
+        m_last(nullptr),
+        m_erased(nullptr),
+        m_size(0),
+        m_capacity(0),
+        m_next_capacity(min_group_capacity) {}
+
+  // Constructor taking an std::initializer_list
+  hive(std::initializer_list<value_type> values) : hive() {
+    for (const_reference value : values) {
+      insert(value);
+    }
+  }
+
+  // Copy constructor; the copy holds the elements without gaps.
+  hive(const hive &right) : hive() {
+    for (const_reference value : right) {
+      insert(value);
+    }
+  }
+
+  // Move constructor
+  hive(hive &&right)
+      : m_first(right.m_first),
+        m_last(right.m_last),
+        m_erased(right.m_erased),
+        m_size(right.m_size),
+        m_capacity(right.m_capacity),
+        m_next_capacity(right.m_next_capacity) {
+    right.m_first = nullptr;
+    right.m_last = nullptr;
+    right.m_erased = nullptr;
+    right.m_size = 0;
+    right.m_capacity = 0;
+    right.m_next_capacity = min_group_capacity;
+  }
+
+  // Copy and move assignment operator
+  hive &operator=(hive right) {
+    swap(right);
+    return *this;
+  }
+
+  // Destructor
+  ~hive() { clear(); }
+
+  // Returns the number of elements
+  size_type size() const { return m_size; }
+
+  // Checks whether the hive is empty
+  bool empty() const { return m_size == 0; }
+
+  // Returns the number of slots in all groups, used or not
+  size_type capacity() const { return m_capacity; }
+
+  // Returns an iterator to the first element
+  iterator begin() {
+    if (m_first == nullptr) return end();
+    return iterator(m_first, m_first->skipfield[0]);
+  }
+
+  // Returns a const iterator to the first element
+  const_iterator begin() const { return const_cast<hive *>(this)->begin(); }
+
+  // Returns a const iterator to the first element
+  const_iterator cbegin() const { return begin(); }
+
+  // Returns an iterator past the last element
+  iterator end() {
+    return iterator(m_last, m_last == nullptr ? 0 : m_last->last);
+  }
+
+  // Returns a const iterator past the last element
+  const_iterator end() const { return const_cast<hive *>(this)->end(); }
+
+  // Returns a const iterator past the last element
+  const_iterator cend() const { return end(); }
+
+  // Inserts a copy of `value` and returns an iterator to it.
+  iterator insert(const_reference value) {
+    iterator it = allocate_slot();
+    *it = value;
+    return it;
+  }
+
+  // Inserts `value` by moving it and returns an iterator to it.
+  iterator insert(value_type &&value) {
+    iterator it = allocate_slot();
+    *it = move(value);
+    return it;
+  }
+
+  // Constructs an element from `args` and returns an iterator to it.
+  template <typename... Args>
+  iterator emplace(Args &&...args) {
+    iterator it = allocate_slot();
+    *it = value_type(open_stl::forward<Args>(args)...);
+    return it;
+  }
+
+  /*
+      Erases the element at `position`.
+
+      Returns:
+          - An iterator to the element after it.
+
+      Runs in O(1): the slot joins the skipblocks on either side, if any,
+     and the group's free list is adjusted accordingly.
+  */
+  iterator erase(const_iterator position) {
+    group *g = position.m_group;
+    std::size_t index = position.m_index;
+    g->elements[index] = value_type();
+    g->size--;
+    m_size--;
+    if (g->size == 0) {
+      group *next = g->next;
+      release_group(g);
+      return next == nullptr ? end() : iterator(next, next->skipfield[0]);
+    }
+    // Step past the element while its slot still reads as live; after the
+    // merge the slot may sit inside a skipblock.
+    iterator next(g, index);
+    ++next;
+    mark_erased(g, index);
+    return next;
+  }
+
+  // Returns an iterator to the element at `element`, or end() if it does
+  // not point to an element of this hive. Runs in O(number of groups).
+  iterator get_iterator(const_pointer element) {
+    for (group *g = m_first; g != nullptr; g = g->next) {
+      if (element >= g->elements && element < g->elements + g->last) {
+        std::size_t index = element - g->elements;
+        if (g->skipfield[index] == 0) return iterator(g, index);
+        return end();
+      }
+    }
+    return end();
+  }
+
+  // Erases every element and releases all groups.
+  void clear() {
+    while (m_first != nullptr) {
+      group *next = m_first->next;
+      deallocate_group(m_first);
+      m_first = next;
+    }
+    m_last = nullptr;
+    m_erased = nullptr;
+    m_size = 0;
+    m_capacity = 0;
+    m_next_capacity = min_group_capacity;
+  }
+
+  // Swaps the contents of two hives.
+  void swap(hive &right) {
+    open_stl::swap(m_first, right.m_first);
+    open_stl::swap(m_last, right.m_last);
+    open_stl::swap(m_erased, right.m_erased);
+    open_stl::swap(m_size, right.m_size);
+    open_stl::swap(m_capacity, right.m_capacity);
+    open_stl::swap(m_next_capacity, right.m_next_capacity);
+  }
+
+ private:
+  static constexpr std::uint16_t min_group_capacity = 8;
+  static constexpr std::uint16_t max_group_capacity = 8192;
+
+  using group_allocator = typename Allocator::template rebind<group>::other;
+  using skip_allocator =
+      typename Allocator::template rebind<std::uint16_t>::other;
+
+  group *m_first;
+  group *m_last;
+  // Groups with at least one skipblock, linked through next_erased.
+  group *m_erased;
+  size_type m_size;
+  size_type m_capacity;
+  std::uint16_t m_next_capacity;
+
+  // Returns an iterator to a slot for a new element: the first slot of a
+  // skipblock if any group has one, else the next slot of the last group,
+  // else slot 0 of a new group.
+  iterator allocate_slot() {
+    group *g = m_erased;
+    std::size_t index;
+    if (g != nullptr) {
+      index = g->free_head;
+      std::uint16_t length = g->skipfield[index];
+      g->skipfield[index] = 0;
+      if (length == 1) {
+        unlink_free(g, index);
+      } else {
+        // The skipblock now starts one slot later.
+        g->skipfield[index + 1] = length - 1;
+        g->skipfield[index + length - 1] = length - 1;
+        move_free(g, index, index + 1);
+      }
+    } else {
+      if (m_last == nullptr || m_last->last == m_last->capacity) {
+        append_group();
+      }
+      g = m_last;
+      index = g->last++;
+    }
+    g->size++;
+    m_size++;
+    return iterator(g, index);
+  }
+
+  // Records slot `index` of `g` as erased, merging it with the skipblocks
+  // next to it.
+  void mark_erased(group *g, std::size_t index) {
+    std::uint16_t *skipfield = g->skipfield;
+    std::uint16_t left = index == 0 ? 0 : skipfield[index - 1];
+    std::uint16_t right = skipfield[index + 1];
+    if (left == 0 && right == 0) {
+      skipfield[index] = 1;
+      push_free(g, index);
+    } else if (right == 0) {
+      std::uint16_t length = left + 1;
+      skipfield[index - left] = length;
+      skipfield[index] = length;
+    } else if (left == 0) {
+      std::uint16_t length = right + 1;
+      skipfield[index] = length;
+      skipfield[index + right] = length;
+      move_free(g, index + 1, index);
+    } else {
+      std::uint16_t length = left + 1 + right;
+      skipfield[index - left] = length;
+      skipfield[index] = length;
+      skipfield[index + right] = length;
+      unlink_free(g, index + 1);
+    }
+  }
+
+  // Adds the skipblock starting at `node` to the free list of `g`.
+  void push_free(group *g, std::size_t node) {
+    if (g->free_head == internal::hive_no_block) link_erased(g);
+    g->next_free[node] = g->free_head;
+    g->prev_free[node] = internal::hive_no_block;
+    if (g->free_head != internal::hive_no_block) {
+      g->prev_free[g->free_head] = std::uint16_t(node);
+    }
+    g->free_head = std::uint16_t(node);
+  }
+
+  // Removes the skipblock starting at `node` from the free list of `g`.
+  void unlink_free(group *g, std::size_t node) {
+    std::uint16_t next = g->next_free[node];
+    std::uint16_t prev = g->prev_free[node];
+    if (next != internal::hive_no_block) g->prev_free[next] = prev;
+    if (prev != internal::hive_no_block) {
+      g->next_free[prev] = next;
+    } else {
+      g->free_head = next;
+    }
+    if (g->free_head == internal::hive_no_block) unlink_erased(g);
+  }
+
+  // Moves the free list entry of a skipblock whose first slot changed from
+  // `from` to `to`.
+  void move_free(group *g, std::size_t from, std::size_t to) {
+    std::uint16_t next = g->next_free[from];
+    std::uint16_t prev = g->prev_free[from];
+    g->next_free[to] = next;
+    g->prev_free[to] = prev;
+    if (next != internal::hive_no_block) g->prev_free[next] = std::uint16_t(to);
+    if (prev != internal::hive_no_block) {
+      g->next_free[prev] = std::uint16_t(to);
+    } else {
+      g->free_head = std::uint16_t(to);
+    }
+  }
+
+  void link_erased(group *g) {
+    g->prev_erased = nullptr;
+    g->next_erased = m_erased;
+    if (m_erased != nullptr) m_erased->prev_erased = g;
+    m_erased = g;
+  }
+
+  void unlink_erased(group *g) {
+    if (g->next_erased != nullptr) g->next_erased->prev_erased = g->prev_erased;
+    if (g->prev_erased != nullptr) {
+      g->prev_erased->next_erased = g->next_erased;
+    } else {
+      m_erased = g->next_erased;
+    }
+  }
+
+  void append_group() {
+    std::uint16_t capacity = m_next_capacity;
+    if (m_next_capacity < max_group_capacity) m_next_capacity *= 2;
+    Allocator alloc;
+    skip_allocator skip_alloc;
+    group_allocator group_alloc;
+    group *g = group_alloc.allocate(1);
+    g->elements = alloc.allocate(capacity);
+    g->skipfield = skip_alloc.allocate(std::size_t(capacity) + 1);
+    g->next_free = skip_alloc.allocate(capacity);
+    g->prev_free = skip_alloc.allocate(capacity);
+    for (std::size_t i = 0; i <= capacity; i++) {
+      g->skipfield[i] = 0;
+    }
+    g->next = nullptr;
+    g->prev = m_last;
+    g->next_erased = nullptr;
+    g->prev_erased = nullptr;
+    g->capacity = capacity;
+    g->last = 0;
+    g->size = 0;
+    g->free_head = internal::hive_no_block;
+    if (m_last != nullptr) {
+      m_last->next = g;
+    } else {
+      m_first = g;
+    }
+    m_last = g;
+    m_capacity += capacity;
+  }
+
+  // Unlinks and frees a group that holds no elements.
+  void release_group(group *g) {
+    if (g->free_head != internal::hive_no_block) unlink_erased(g);
+    if (g->prev != nullptr) {
+      g->prev->next = g->next;
+    } else {
+      m_first = g->next;
+    }
+    if (g->next != nullptr) {
+      g->next->prev = g->prev;
+    } else {
+      m_last = g->prev;
+    }
+    m_capacity -= g->capacity;
+    deallocate_group(g);
+  }
+
+  static void deallocate_group(group *g) {
+    Allocator alloc;
+    skip_allocator skip_alloc;
+    group_allocator group_alloc;
+    alloc.deallocate(g->elements);
+    skip_alloc.deallocate(g->skipfield);
+    skip_alloc.deallocate(g->next_free);
+    skip_alloc.deallocate(g->prev_free);
+    group_alloc.deallocate(g);
+  }
+};
+}  // namespace open_stl
+
+#endif  // OPEN_STL_HIVE_H_
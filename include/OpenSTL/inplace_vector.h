@@ -0,0 +1,419 @@
+#ifndef OPEN_STL_INPLACE_VECTOR_H_
+#define OPEN_STL_INPLACE_VECTOR_H_
+
+#include <OpenSTL/internal/reverse_iterator.h>
+#include <OpenSTL/utility.h>
+
+#include <cstddef>
+#include <initializer_list>
+#include <new>
+#include <stdexcept>
+
+namespace open_stl {
+/*
+    A vector with a fixed capacity whose elements live inside the object.
+
+    Template Parameters:
+        - T: The type of the elements.
+        - N: The capacity.
+
+    Like array, the storage is part of the object, so an inplace_vector on
+   the stack or inside another object never touches the heap. Unlike array,
+   the storage starts out uninitialized: elements are constructed with
+   placement new as they are added and destroyed as they are removed, so it
+   has a size, and T needs no default constructor.
+
+    Growing past N is an error. The functions that grow the vector the way
+   vector does (push_back, emplace_back, insert, resize, the constructors)
+   throw std::bad_alloc, as the storage is exhausted; try_push_back and
+   try_emplace_back instead return nullptr and leave the vector unchanged,
+   for hot paths that handle overflow themselves; and the unchecked_
+   variants assume the caller checked.
+
+    Insertion and erasure invalidate iterators at and after the position,
+   but never those before it, since the elements never move to new storage.
+*/
+template <typename T, std::size_t N>
+class inplace_vector {
+ public:
+  using value_type = T;
+  using iterator = T *;
+  using pointer = T *;
+  using reference = T &;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using const_reference = const T &;
+  using const_pointer = const T *;
+  using const_iterator = const T *;
+  using const_reverse_iterator = internal::reverse_iterator<const_iterator>;
+  using reverse_iterator = internal::reverse_iterator<iterator>;
+
+  // Default constructor
+  inplace_vector() : m_size(0) {}
+
+  // Constructor with size argument; throws std::bad_alloc if count > N
+  explicit inplace_vector(size_type count) : m_size(0) { resize(count); }
+
+  // Constructor with size and value arguments
+  inplace_vector(size_type count, const_reference value) : m_size(0) {
+    resize(count, value);
+  }
+
+  // Constructor taking an std::initializer_list
+  inplace_vector(std::initializer_list<T> values) : m_size(0) {
+    if (values.size() > N) throw std::bad_alloc();
+    for (const_reference value : values) {
+      unchecked_emplace_back(value);
+    }
+  }
+
+  // Copy constructor
+  inplace_vector(const inplace_vector &right) : m_size(0) {
+    for (size_type i = 0; i < right.m_size; i++) {
+      unchecked_emplace_back(right[i]);
+    }
+  }
+
+  // Move constructor; the elements are moved one by one and `right` keeps
+  // its size.
+  inplace_vector(inplace_vector &&right) : m_size(0) {
+    for (size_type i = 0; i < right.m_size; i++) {
+      unchecked_emplace_back(open_stl::move(right[i]));
+    }
+  }
+
+  // Destructor
+  ~inplace_vector() { clear(); }
+
+  // Assigns the contents of another inplace_vector to this one.
+  inplace_vector &operator=(const inplace_vector &right) {
+    if (this == &right) return *this;
+    assign_from(right);
+    return *this;
+  }
+
+  // Assigns the contents of another inplace_vector using move semantics.
+  inplace_vector &operator=(inplace_vector &&right) {
+    if (this == &right) return *this;
+    assign_from(open_stl::move(right));
+    return *this;
+  }
+
+  // Return a reference to the element at the specified position.
+  reference at(size_type off) {
+    if (off >= m_size) throw_out_of_range();
+    return data()[off];
+  }
+
+  // Return a const reference to the element at the specified position
+  const_reference at(size_type off) const {
+    if (off >= m_size) throw_out_of_range();
+    return data()[off];
+  }
+
+  // Returns a reference to the element at the specified position
+  reference operator[](size_type position) { return data()[position]; }
+
+  // Returns a const reference to the element at the specified position
+  const_reference operator[](size_type position) const {
+    return data()[position];
+  }
+
+  // Returns a reference to the first element
+  reference front() { return data()[0]; }
+
+  // Returns a const reference to the first element
+  const_reference front() const { return data()[0]; }
+
+  // Returns a reference to the last element
+  reference back() { return data()[m_size - 1]; }
+
+  // Returns a const reference to the last element
+  const_reference back() const { return data()[m_size - 1]; }
+
+  // Returns a pointer to the first element
+  pointer data() { return std::launder(reinterpret_cast<T *>(m_storage)); }
+
+  // Returns a const pointer to the first element
+  const_pointer data() const {
+    return std::launder(reinterpret_cast<const T *>(m_storage));
+  }
+
+  // Returns an iterator to the first element
+  iterator begin() { return data(); }
+
+  // Returns a const iterator to the first element
+  const_iterator begin() const { return data(); }
+
+  // Returns a const iterator to the first element
+  const_iterator cbegin() const { return data(); }
+
+  // Returns an iterator past the last element
+  iterator end() { return data() + m_size; }
+
+  // Returns a const iterator past the last element
+  const_iterator end() const { return data() + m_size; }
+
+  // Returns a const iterator past the last element
+  const_iterator cend() const { return data() + m_size; }
+
+  // Returns a reverse iterator to the last element
+  reverse_iterator rbegin() { return reverse_iterator(end() - 1); }
+
+  // Returns a const reverse iterator to the last element
+  const_reverse_iterator rbegin() const {
+    return const_reverse_iterator(end() - 1);
+  }
+
+  // Returns a reverse iterator before the first element
+  reverse_iterator rend() { return reverse_iterator(begin() - 1); }
+
+  // Returns a const reverse iterator before the first element
+  const_reverse_iterator rend() const {
+    return const_reverse_iterator(begin() - 1);
+  }
+
+  // Returns the number of elements
+  size_type size() const { return m_size; }
+
+  // Returns the capacity, N
+  static constexpr size_type capacity() { return N; }
+
+  // Returns the maximum number of elements, N
+  static constexpr size_type max_size() { return N; }
+
+  // Checks whether the vector is empty
+  bool empty() const { return m_size == 0; }
+
+  // Checks whether the vector holds N elements
+  bool full() const { return m_size == N; }
+
+  // Destroys all elements, making the vector empty.
+  void clear() {
+    while (m_size > 0) {
+      pop_back();
+    }
+  }
+
+  // Changes the size to `count`, appending value-initialized elements or
+  // destroying trailing ones. Throws std::bad_alloc if count > N.
+  void resize(size_type count) {
+    if (count > N) throw std::bad_alloc();
+    while (m_size > count) {
+      pop_back();
+    }
+    while (m_size < count) {
+      unchecked_emplace_back();
+    }
+  }
+
+  // Changes the size to `count`, appending copies of `value`.
+  void resize(size_type count, const_reference value) {
+    if (count > N) throw std::bad_alloc();
+    while (m_size > count) {
+      pop_back();
+    }
+    while (m_size < count) {
+      unchecked_emplace_back(value);
+    }
+  }
+
+  // Adds a copy of `value` at the end; throws std::bad_alloc if full.
+  void push_back(const_reference value) { emplace_back(value); }
+
+  // Moves `value` to the end; throws std::bad_alloc if full.
+  void push_back(value_type &&value) {
+    emplace_back(open_stl::move(value));
+  }
+
+  // Constructs an element at the end from `args` and returns it; throws
+  // std::bad_alloc if full.
+  template <typename... Args>
+  reference emplace_back(Args &&...args) {
+    if (m_size == N) throw std::bad_alloc();
+    return unchecked_emplace_back(open_stl::forward<Args>(args)...);
+  }
+
+  // Adds a copy of `value` at the end. Returns a pointer to it, or nullptr
+  // if the vector is full, in which case nothing is copied.
+  pointer try_push_back(const_reference value) {
+    return try_emplace_back(value);
+  }
+
+  // Moves `value` to the end. Returns a pointer to it, or nullptr, leaving
+  // `value` untouched, if the vector is full.
+  pointer try_push_back(value_type &&value) {
+    return try_emplace_back(open_stl::move(value));
+  }
+
+  // Constructs an element at the end from `args`. Returns a pointer to it,
+  // or nullptr if the vector is full, in which case nothing is constructed.
+  template <typename... Args>
+  pointer try_emplace_back(Args &&...args) {
+    if (m_size == N) return nullptr;
+    return &unchecked_emplace_back(open_stl::forward<Args>(args)...);
+  }
+
+  // Adds a copy of `value` at the end; the vector must not be full.
+  reference unchecked_push_back(const_reference value) {
+    return unchecked_emplace_back(value);
+  }
+
+  // Moves `value` to the end; the vector must not be full.
+  reference unchecked_push_back(value_type &&value) {
+    return unchecked_emplace_back(open_stl::move(value));
+  }
+
+  // Constructs an element at the end from `args`; the vector must not be
+  // full.
+  template <typename... Args>
+  reference unchecked_emplace_back(Args &&...args) {
+    T *element = ::new (static_cast<void *>(data() + m_size))
+        T(open_stl::forward<Args>(args)...);
+    m_size++;
+    return *element;
+  }
+
+  // Destroys the last element.
+  void pop_back() {
+    m_size--;
+    data()[m_size].~T();
+  }
+
+  // Constructs an element from `args` before `position` and returns an
+  // iterator to it; throws std::bad_alloc if full.
+  template <typename... Args>
+  iterator emplace(const_iterator position, Args &&...args) {
+    size_type index = position - begin();
+    emplace_back(open_stl::forward<Args>(args)...);
+    // Rotate the new element into place.
+    for (size_type i = m_size - 1; i > index; i--) {
+      open_stl::swap(data()[i], data()[i - 1]);
+    }
+    return begin() + index;
+  }
+
+  // Inserts a copy of `value` before `position`.
+  iterator insert(const_iterator position, const_reference value) {
+    return emplace(position, value);
+  }
+
+  // Inserts `value` before `position` by moving it.
+  iterator insert(const_iterator position, value_type &&value) {
+    return emplace(position, open_stl::move(value));
+  }
+
+  // Inserts `count` copies of `value` before `position`; throws
+  // std::bad_alloc, inserting nothing, if they do not fit.
+  iterator insert(const_iterator position, size_type count,
+                  const_reference value) {
+    size_type index = position - begin();
+    if (count > N - m_size) throw std::bad_alloc();
+    size_type old_size = m_size;
+    for (size_type i = 0; i < count; i++) {
+      unchecked_emplace_back(value);
+    }
+    // Reverse the tail and the new block separately, then together, to
+    // move the block in front of the tail.
+    reverse(index, old_size);
+    reverse(old_size, m_size);
+    reverse(index, m_size);
+    return begin() + index;
+  }
+
+  // Erases the element at `position` and returns an iterator to the element
+  // that followed it.
+  iterator erase(const_iterator position) {
+    return erase(position, position + 1);
+  }
+
+  // Erases the elements in [first, last) and returns an iterator to the
+  // element that followed them.
+  iterator erase(const_iterator first, const_iterator last) {
+    size_type index = first - begin();
+    size_type count = last - first;
+    if (count == 0) return begin() + index;
+    for (size_type i = index; i + count < m_size; i++) {
+      data()[i] = open_stl::move(data()[i + count]);
+    }
+    for (size_type i = 0; i < count; i++) {
+      pop_back();
+    }
+    return begin() + index;
+  }
+
+  // Swaps the contents of two vectors element by element.
+  void swap(inplace_vector &right) {
+    inplace_vector temp(open_stl::move(right));
+    right = open_stl::move(*this);
+    *this = open_stl::move(temp);
+  }
+
+  // Checks if this vector equal to another vector.
+  bool operator==(const inplace_vector &right) const {
+    if (m_size != right.m_size) return false;
+    for (size_type i = 0; i < m_size; i++) {
+      if (!(data()[i] == right[i])) return false;
+    }
+    return true;
+  }
+
+  // Checks if this vector is not equal to another vector.
+  bool operator!=(const inplace_vector &right) const {
+    return !(*this == right);
+  }
+
+  // Checks if this vector is lexicographically less than another vector.
+  bool operator<(const inplace_vector &right) const {
+    for (size_type i = 0; i < m_size && i < right.m_size; i++) {
+      if (data()[i] < right[i]) return true;
+      if (right[i] < data()[i]) return false;
+    }
+    return m_size < right.m_size;
+  }
+
+ private:
+  // Raw storage for N elements; a zero-capacity vector still needs a
+  // well-formed array.
+  alignas(T) unsigned char m_storage[(N > 0 ? N : 1) * sizeof(T)];
+  size_type m_size;
+
+  // Copies or moves the elements of `right` over ours, assigning to the
+  // elements both have and constructing or destroying the rest.
+  template <typename Vector>
+  void assign_from(Vector &&right) {
+    size_type common = m_size < right.m_size ? m_size : right.m_size;
+    for (size_type i = 0; i < common; i++) {
+      data()[i] = open_stl::forward<Vector>(right).element(i);
+    }
+    while (m_size > right.m_size) {
+      pop_back();
+    }
+    while (m_size < right.m_size) {
+      unchecked_emplace_back(open_stl::forward<Vector>(right).element(m_size));
+    }
+  }
+
+  // Returns an element as an lvalue or, for a vector being moved from, an
+  // rvalue.
+  const_reference element(size_type index) const & { return data()[index]; }
+  value_type &&element(size_type index) && {
+    return open_stl::move(data()[index]);
+  }
+
+  // Reverses the elements in [first, last).
+  void reverse(size_type first, size_type last) {
+    while (first + 1 < last) {
+      open_stl::swap(data()[first++], data()[--last]);
+    }
+  }
+
+  [[noreturn]] static void throw_out_of_range() {
+    throw std::out_of_range(
+        "Error: inplace_vector index out of range. Please ensure the index is "
+        "within the valid range.");
+  }
+};
+}  // namespace open_stl
+
+#endif  // OPEN_STL_INPLACE_VECTOR_H_
@@ -0,0 +1,310 @@
+#ifndef OPEN_STL_INTERNAL_BIT_OPS_H_
+#define OPEN_STL_INTERNAL_BIT_OPS_H_
+
+#include <OpenSTL/internal/config.h>
+#include <OpenSTL/internal/iterator.h>
+#include <OpenSTL/type_traits.h>
+
+#ifdef OPEN_STL_HAS_SSE2
+#include <emmintrin.h>
+#endif
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace open_stl {
+namespace internal {
+
+// The unit of storage of packed bit containers.
+using bit_word = std::uint64_t;
+
+inline constexpr std::size_t bits_per_word = 64;
+
+// Returns the number of words holding `bits` bits.
+constexpr std::size_t word_count(std::size_t bits) {
+  return (bits + bits_per_word - 1) / bits_per_word;
+}
+
+// Returns the mask of bit `index` within its word.
+constexpr bit_word bit_mask(std::size_t index) {
+  return bit_word(1) << (index % bits_per_word);
+}
+
+// Returns the mask of the bits of the last word that are in use when a
+// container holds `bits` bits; all ones when the last word is full.
+constexpr bit_word last_word_mask(std::size_t bits) {
+  return bits % bits_per_word == 0 ? ~bit_word(0)
+                                   : bit_mask(bits) - bit_word(1);
+}
+
+/*
+    Proxy returned by the subscript operators of packed bit containers.
+
+    It converts to bool and assigns through to the single bit it refers to,
+   standing in for the bool& a packed container cannot hand out.
+*/
+class bit_reference {
+ public:
+  bit_reference(bit_word *word, bit_word mask) : m_word(word), m_mask(mask) {}
+
+  operator bool() const { return (*m_word & m_mask) != 0; }
+
+  bit_reference &operator=(bool value) {
+    if (value) {
+      *m_word |= m_mask;
+    } else {
+      *m_word &= ~m_mask;
+    }
+    return *this;
+  }
+
+  // Assigns the value of the bit another proxy refers to.
+  bit_reference &operator=(const bit_reference &right) {
+    return *this = bool(right);
+  }
+
+  // Inverts the bit.
+  void flip() { *m_word ^= m_mask; }
+
+ private:
+  bit_word *m_word;
+  bit_word m_mask;
+};
+
+/*
+    Random access iterator over packed bits.
+
+    Template Parameters:
+        - Word: bit_word, or const bit_word for const iterators.
+*/
+template <typename Word>
+class bit_iterator {
+  static constexpr bool is_const = !is_same<Word, bit_word>::value;
+
+ public:
+  using iterator_category = random_access_iterator_tag;
+  using value_type = bool;
+  using difference_type = std::ptrdiff_t;
+  // Single bits have no address.
+  using pointer = void;
+  using reference = std::conditional_t<is_const, bool, bit_reference>;
+
+  bit_iterator() : m_words(nullptr), m_index(0) {}
+  bit_iterator(Word *words, std::size_t index)
+      : m_words(words), m_index(index) {}
+
+  // Converts an iterator to a const iterator.
+  template <typename Other>
+  bit_iterator(const bit_iterator<Other> &other)
+      : m_words(other.m_words), m_index(other.m_index) {}
+
+  reference operator*() const {
+    if constexpr (is_const) {
+      return (m_words[m_index / bits_per_word] & bit_mask(m_index)) != 0;
+    } else {
+      return bit_reference(m_words + m_index / bits_per_word,
+                           bit_mask(m_index));
+    }
+  }
+
+  reference operator[](difference_type off) const { return *(*this + off); }
+
+  bit_iterator &operator++() {
+    ++m_index;
+    return *this;
+  }
+
+  bit_iterator operator++(int) {
+    bit_iterator it = *this;
+    ++m_index;
+    return it;
+  }
+
+  bit_iterator &operator--() {
+    --m_index;
+    return *this;
+  }
+
+  bit_iterator operator--(int) {
+    bit_iterator it = *this;
+    --m_index;
+    return it;
+  }
+
+  bit_iterator &operator+=(difference_type off) {
+    m_index += off;
+    return *this;
+  }
+
+  bit_iterator &operator-=(difference_type off) {
+    m_index -= off;
+    return *this;
+  }
+
+  bit_iterator operator+(difference_type off) const {
+    return bit_iterator(m_words, m_index + off);
+  }
+
+  bit_iterator operator-(difference_type off) const {
+    return bit_iterator(m_words, m_index - off);
+  }
+
+  difference_type operator-(const bit_iterator &right) const {
+    return difference_type(m_index) - difference_type(right.m_index);
+  }
+
+  bool operator==(const bit_iterator &right) const {
+    return m_index == right.m_index;
+  }
+  bool operator!=(const bit_iterator &right) const {
+    return m_index != right.m_index;
+  }
+  bool operator<(const bit_iterator &right) const {
+    return m_index < right.m_index;
+  }
+
+ private:
+  template <typename Other>
+  friend class bit_iterator;
+
+  Word *m_words;
+  std::size_t m_index;
+};
+
+// Counts the set bits of `count` words. std::popcount compiles to the
+// popcnt instruction when the target has it; four independent sums keep
+// several of them in flight.
+inline std::size_t popcount_words(const bit_word *words, std::size_t count) {
+  std::size_t sum0 = 0;
+  std::size_t sum1 = 0;
+  std::size_t sum2 = 0;
+  std::size_t sum3 = 0;
+  std::size_t i = 0;
+  std::size_t bulk = count - count % 4;
+  for (; i < bulk; i += 4) {
+    sum0 += std::popcount(words[i]);
+    sum1 += std::popcount(words[i + 1]);
+    sum2 += std::popcount(words[i + 2]);
+    sum3 += std::popcount(words[i + 3]);
+  }
+  for (; i < count; i++) {
+    sum0 += std::popcount(words[i]);
+  }
+  return sum0 + sum1 + sum2 + sum3;
+}
+
+/*
+    Returns the index of the first set bit at or after `from`, or `npos`.
+
+    Parameters:
+        - words, bits: The bit array and its length in bits.
+        - from: The first index to look at.
+        - npos: The value returned when no bit is set.
+
+    Whole zero words are skipped, and the bit within the first non-zero word
+   is found with a single count-trailing-zeros instruction.
+*/
+inline std::size_t find_set_bit(const bit_word *words, std::size_t bits,
+                                std::size_t from, std::size_t npos) {
+  if (from >= bits) return npos;
+  std::size_t word = from / bits_per_word;
+  std::size_t count = word_count(bits);
+  bit_word current = words[word] & (~bit_word(0) << (from % bits_per_word));
+  while (current == 0) {
+    if (++word == count) return npos;
+    current = words[word];
+  }
+  std::size_t index = word * bits_per_word + std::countr_zero(current);
+  return index < bits ? index : npos;
+}
+
+// Word-wise operations for transform_words(). Each applies to a pair of
+// words and, where available, to a pair of 128-bit SSE2 registers.
+struct bit_and {
+  static bit_word apply(bit_word lhs, bit_word rhs) { return lhs & rhs; }
+#ifdef OPEN_STL_HAS_SSE2
+  static __m128i apply(__m128i lhs, __m128i rhs) {
+    return _mm_and_si128(lhs, rhs);
+  }
+#endif
+};
+
+struct bit_or {
+  static bit_word apply(bit_word lhs, bit_word rhs) { return lhs | rhs; }
+#ifdef OPEN_STL_HAS_SSE2
+  static __m128i apply(__m128i lhs, __m128i rhs) {
+    return _mm_or_si128(lhs, rhs);
+  }
+#endif
+};
+
+struct bit_xor {
+  static bit_word apply(bit_word lhs, bit_word rhs) { return lhs ^ rhs; }
+#ifdef OPEN_STL_HAS_SSE2
+  static __m128i apply(__m128i lhs, __m128i rhs) {
+    return _mm_xor_si128(lhs, rhs);
+  }
+#endif
+};
+
+// lhs & ~rhs: the bits of lhs that are not in rhs.
+struct bit_andnot {
+  static bit_word apply(bit_word lhs, bit_word rhs) { return lhs & ~rhs; }
+#ifdef OPEN_STL_HAS_SSE2
+  static __m128i apply(__m128i lhs, __m128i rhs) {
+    return _mm_andnot_si128(rhs, lhs);
+  }
+#endif
+};
+
+/*
+    Computes destination[i] = Op::apply(lhs[i], rhs[i]) for `count` words.
+
+    Template Parameters:
+        - Op: bit_and, bit_or, bit_xor or bit_andnot.
+
+    On SSE2 targets the bulk of the words is processed two at a time in
+   128-bit registers, four registers per iteration; the remainder falls back
+   to 64-bit words. `destination` may alias either operand.
+*/
+template <typename Op>
+void transform_words(bit_word *destination, const bit_word *lhs,
+                     const bit_word *rhs, std::size_t count) {
+  std::size_t i = 0;
+#ifdef OPEN_STL_HAS_SSE2
+  for (; i + 8 <= count; i += 8) {
+    __m128i l0 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(lhs + i));
+    __m128i l1 =
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(lhs + i + 2));
+    __m128i l2 =
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(lhs + i + 4));
+    __m128i l3 =
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(lhs + i + 6));
+    __m128i r0 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(rhs + i));
+    __m128i r1 =
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(rhs + i + 2));
+    __m128i r2 =
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(rhs + i + 4));
+    __m128i r3 =
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(rhs + i + 6));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(destination + i),
+                     Op::apply(l0, r0));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(destination + i + 2),
+                     Op::apply(l1, r1));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(destination + i + 4),
+                     Op::apply(l2, r2));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(destination + i + 6),
+                     Op::apply(l3, r3));
+  }
+#endif
+  for (; i < count; i++) {
+    destination[i] = Op::apply(lhs[i], rhs[i]);
+  }
+}
+
+}  // namespace internal
+}  // namespace open_stl
+
+#endif  // OPEN_STL_INTERNAL_BIT_OPS_H_
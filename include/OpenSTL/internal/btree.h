@@ -0,0 +1,738 @@
+#ifndef OPEN_STL_INTERNAL_BTREE_H_
+#define OPEN_STL_INTERNAL_BTREE_H_
+
+#include <OpenSTL/internal/prefetch.h>
+#include <OpenSTL/type_traits.h>
+#include <OpenSTL/utility.h>
+#include <OpenSTL/vector.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace open_stl {
+namespace internal {
+
+// Keys per B+tree node: as many as fill four cache lines, but at least 8 so
+// large keys still give a useful fanout.
+template <typename Key>
+inline constexpr std::size_t btree_node_slots =
+    4 * cache_line_size / sizeof(Key) < 8 ? 8
+                                          : 4 * cache_line_size / sizeof(Key);
+
+/*
+    Returns the number of leading keys of a sorted node for which `pred`
+   holds.
+
+    A branchless binary search: every step halves the range with a
+   conditional move instead of a branch, so the loop runs exactly
+   log2(count) times and never mispredicts. The whole node spans only a few
+   cache lines, which are loaded by the first comparisons.
+*/
+template <typename Key, typename Predicate>
+std::size_t node_partition_point(const Key *keys, std::size_t count,
+                                 Predicate pred) {
+  if (count == 0) return 0;
+  const Key *base = keys;
+  std::size_t n = count;
+  while (n > 1) {
+    std::size_t half = n / 2;
+    base = pred(base[half]) ? base + half : base;
+    n -= half;
+  }
+  return (base - keys) + pred(*base);
+}
+
+// Common header of leaf and inner nodes.
+struct btree_node {
+  bool leaf;
+  std::uint16_t count;
+};
+
+// The keys of a leaf. As the first base after the header they sit at the
+// same offset as the keys of an inner node.
+template <typename Key, std::size_t N>
+struct btree_leaf_keys {
+  Key keys[N];
+};
+
+// The mapped values of a leaf; empty for sets.
+template <typename Mapped, std::size_t N>
+struct btree_leaf_values {
+  Mapped values[N];
+};
+
+template <std::size_t N>
+struct btree_leaf_values<void, N> {};
+
+/*
+    A leaf of a B+tree: up to N sorted keys, their values, and links to the
+   neighbouring leaves.
+
+    Keys and values are kept in separate arrays so a search only touches
+   the keys, and the keys come first so they directly follow the header.
+*/
+template <typename Key, typename Mapped, std::size_t N>
+struct btree_leaf : btree_node,
+                    btree_leaf_keys<Key, N>,
+                    btree_leaf_values<Mapped, N> {
+  using key_type = Key;
+  using mapped_type = Mapped;
+
+  btree_leaf *prev;
+  btree_leaf *next;
+};
+
+// An inner node: up to N separator keys and N + 1 children. Every key of
+// children[i] is ordered before keys[i], and no key of children[i + 1] is.
+template <typename Key, std::size_t N>
+struct btree_inner : btree_node {
+  Key keys[N];
+  btree_node *children[N + 1];
+};
+
+// A position in a B+tree: a leaf and a slot within it.
+template <typename Leaf>
+struct btree_slot {
+  Leaf *leaf;
+  std::size_t index;
+};
+
+// Moves a slot to the next element, following the leaf links.
+template <typename Leaf>
+void btree_increment(Leaf *&leaf, std::size_t &index) {
+  if (++index == leaf->count && leaf->next != nullptr) {
+    leaf = leaf->next;
+    index = 0;
+  }
+}
+
+// Moves a slot to the previous element, following the leaf links.
+template <typename Leaf>
+void btree_decrement(Leaf *&leaf, std::size_t &index) {
+  if (index == 0) {
+    leaf = leaf->prev;
+    index = leaf->count;
+  }
+  --index;
+}
+
+/*
+    The B+tree shared by btree_map and btree_set.
+
+    Template Parameters:
+        - Key: The key type.
+        - Mapped: The mapped type, or void for a set.
+        - Compare: The ordering of the keys.
+        - Allocator: Rebound to allocate the nodes.
+
+    All elements live in the leaves, which are chained in key order; inner
+   nodes hold only separator keys and child pointers. Every node holds
+   btree_node_slots<Key> keys, a few cache lines, so a lookup touches one
+   short run of lines per level and the tree is only a handful of levels
+   deep even for hundreds of millions of keys. A red-black tree spends three
+   pointers and one cache miss per element per level instead.
+
+    Insertion splits full nodes on the way back up; erasure borrows from or
+   merges with a sibling when a node drops below half full. bulk_load()
+   builds the tree bottom-up from sorted input in O(n).
+*/
+template <typename Key, typename Mapped, typename Compare, typename Allocator>
+class btree {
+ public:
+  static constexpr bool is_map = !is_same<Mapped, void>::value;
+  static constexpr std::size_t node_slots = btree_node_slots<Key>;
+
+  using size_type = std::size_t;
+  using leaf_type = btree_leaf<Key, Mapped, node_slots>;
+  using inner_type = btree_inner<Key, node_slots>;
+  using slot = btree_slot<leaf_type>;
+
+  explicit btree(const Compare &comp = Compare())
+      : m_root(nullptr),
+        m_first(nullptr),
+        m_last(nullptr),
+        m_size(0),
+        m_comp(comp) {}
+
+  btree(const btree &right) : btree(right.m_comp) {
+    slot source{right.m_first, 0};
+    bulk_load(right.m_size, [&source](leaf_type *leaf, size_type index) {
+      leaf->keys[index] = source.leaf->keys[source.index];
+      if constexpr (is_map) {
+        leaf->values[index] = source.leaf->values[source.index];
+      }
+      btree_increment(source.leaf, source.index);
+    });
+  }
+
+  btree(btree &&right)
+      : m_root(right.m_root),
+        m_first(right.m_first),
+        m_last(right.m_last),
+        m_size(right.m_size),
+        m_comp(right.m_comp) {
+    right.m_root = nullptr;
+    right.m_first = nullptr;
+    right.m_last = nullptr;
+    right.m_size = 0;
+  }
+
+  ~btree() { clear(); }
+
+  btree &operator=(btree right) {
+    swap(right);
+    return *this;
+  }
+
+  void swap(btree &right) {
+    open_stl::swap(m_root, right.m_root);
+    open_stl::swap(m_first, right.m_first);
+    open_stl::swap(m_last, right.m_last);
+    open_stl::swap(m_size, right.m_size);
+    open_stl::swap(m_comp, right.m_comp);
+  }
+
+  size_type size() const { return m_size; }
+  const Compare &key_comp() const { return m_comp; }
+
+  slot begin_slot() const { return slot{m_first, 0}; }
+  slot end_slot() const {
+    return slot{m_last, m_last == nullptr ? size_type(0) : m_last->count};
+  }
+
+  // Returns the first slot whose key is not ordered before `key`.
+  template <typename K>
+  slot lower_bound(const K &key) const {
+    return search([this, &key](const Key &element) {
+      return m_comp(element, key);
+    });
+  }
+
+  // Returns the first slot whose key is ordered after `key`.
+  template <typename K>
+  slot upper_bound(const K &key) const {
+    return search([this, &key](const Key &element) {
+      return !m_comp(key, element);
+    });
+  }
+
+  // Returns the slot holding `key`, or end_slot().
+  template <typename K>
+  slot find(const K &key) const {
+    slot position = lower_bound(key);
+    if (position.leaf == nullptr || position.index == position.leaf->count ||
+        m_comp(key, position.leaf->keys[position.index])) {
+      return end_slot();
+    }
+    return position;
+  }
+
+  /*
+      Inserts `key` unless it is present.
+
+      Parameters:
+          - key: The key to insert.
+          - value: For maps, the arguments the mapped value is built from.
+
+      Returns:
+          - The slot holding the key and whether the insertion happened.
+  */
+  template <typename K, typename... V>
+  pair<slot, bool> emplace(K &&key, V &&...value) {
+    if (m_root == nullptr) {
+      m_root = m_first = m_last = allocate_leaf();
+    }
+    path_entry path[max_depth];
+    size_type depth = 0;
+    leaf_type *leaf = descend(key, path, depth);
+    size_type index = leaf_lower_bound(leaf, key);
+    if (index < leaf->count && !m_comp(key, leaf->keys[index])) {
+      return pair<slot, bool>(slot{leaf, index}, false);
+    }
+    if (leaf->count == node_slots) {
+      leaf_type *right = split_leaf(leaf);
+      Key separator = right->keys[0];
+      if (index > leaf->count) {
+        index -= leaf->count;
+        leaf = right;
+      }
+      insert_into_parent(path, depth, move(separator), right);
+    }
+    shift_right(leaf, index);
+    leaf->keys[index] = Key(open_stl::forward<K>(key));
+    if constexpr (is_map) {
+      leaf->values[index] = Mapped(open_stl::forward<V>(value)...);
+    }
+    leaf->count++;
+    m_size++;
+    return pair<slot, bool>(slot{leaf, index}, true);
+  }
+
+  // Removes `key`, returning how many elements were removed.
+  template <typename K>
+  size_type erase(const K &key) {
+    if (m_root == nullptr) return 0;
+    path_entry path[max_depth];
+    size_type depth = 0;
+    leaf_type *leaf = descend(key, path, depth);
+    size_type index = leaf_lower_bound(leaf, key);
+    if (index == leaf->count || m_comp(key, leaf->keys[index])) return 0;
+    shift_left(leaf, index);
+    m_size--;
+    if (depth == 0) {
+      if (m_size == 0) clear();
+    } else if (leaf->count < min_slots) {
+      rebalance_leaf(leaf, path[depth - 1]);
+      rebalance_inner(path, depth - 1);
+    }
+    return 1;
+  }
+
+  /*
+      Replaces the contents with `count` elements in ascending key order.
+
+      Parameters:
+          - count: The number of elements.
+          - fill: Called as fill(leaf, index) once per element, in order; it
+         stores the next key (and value) at that slot.
+
+      The leaves are filled to three quarters, which leaves room for later
+     inserts without immediate splits, and the inner levels are built on
+     top of them one level at a time.
+  */
+  template <typename Fill>
+  void bulk_load(size_type count, Fill fill) {
+    clear();
+    if (count == 0) return;
+    constexpr size_type fill_slots = node_slots - node_slots / 4;
+    size_type leaves = (count + fill_slots - 1) / fill_slots;
+    vector<btree_node *> level;
+    vector<Key> separators;
+    for (size_type i = 0; i < leaves; i++) {
+      size_type share = count / leaves + (i < count % leaves ? 1 : 0);
+      leaf_type *leaf = allocate_leaf();
+      for (size_type j = 0; j < share; j++) {
+        fill(leaf, j);
+      }
+      leaf->count = std::uint16_t(share);
+      if (m_last != nullptr) {
+        m_last->next = leaf;
+        leaf->prev = m_last;
+        separators.push_back(leaf->keys[0]);
+      } else {
+        m_first = leaf;
+      }
+      m_last = leaf;
+      level.push_back(leaf);
+    }
+    // separators[i] is the smallest key under level[i + 1].
+    while (level.size() > 1) {
+      size_type nodes = (level.size() + fill_slots) / (fill_slots + 1);
+      vector<btree_node *> parents;
+      vector<Key> parent_separators;
+      size_type taken = 0;
+      for (size_type i = 0; i < nodes; i++) {
+        size_type share =
+            level.size() / nodes + (i < level.size() % nodes ? 1 : 0);
+        inner_type *inner = allocate_inner();
+        for (size_type j = 0; j < share; j++) {
+          inner->children[j] = level[taken + j];
+          if (j > 0) inner->keys[j - 1] = move(separators[taken + j - 1]);
+        }
+        inner->count = std::uint16_t(share - 1);
+        if (i > 0) parent_separators.push_back(move(separators[taken - 1]));
+        taken += share;
+        parents.push_back(inner);
+      }
+      level = move(parents);
+      separators = move(parent_separators);
+    }
+    m_root = level[0];
+    m_size = count;
+  }
+
+  // Removes every element and frees all nodes.
+  void clear() {
+    if (m_root != nullptr) free_subtree(m_root);
+    m_root = nullptr;
+    m_first = nullptr;
+    m_last = nullptr;
+    m_size = 0;
+  }
+
+ private:
+  // Nodes below this many keys borrow from or merge with a sibling.
+  static constexpr size_type min_slots = node_slots / 2;
+  // Enough for any tree that fits in memory, since every inner node but
+  // the root has at least min_slots + 1 >= 5 children.
+  static constexpr size_type max_depth = 64;
+
+  using leaf_allocator = typename Allocator::template rebind<leaf_type>::other;
+  using inner_allocator =
+      typename Allocator::template rebind<inner_type>::other;
+
+  // An inner node on the way down and the child that was taken.
+  struct path_entry {
+    inner_type *node;
+    size_type child;
+  };
+
+  btree_node *m_root;
+  leaf_type *m_first;
+  leaf_type *m_last;
+  size_type m_size;
+  Compare m_comp;
+
+  template <typename K>
+  size_type leaf_lower_bound(const leaf_type *leaf, const K &key) const {
+    return node_partition_point(
+        leaf->keys, leaf->count,
+        [this, &key](const Key &element) { return m_comp(element, key); });
+  }
+
+  // Returns the child of `inner` whose range contains `key`.
+  template <typename K>
+  size_type child_index(const inner_type *inner, const K &key) const {
+    return node_partition_point(
+        inner->keys, inner->count,
+        [this, &key](const Key &element) { return !m_comp(key, element); });
+  }
+
+  // Walks from the root to the leaf whose range contains `key`, recording
+  // the inner nodes passed.
+  template <typename K>
+  leaf_type *descend(const K &key, path_entry *path, size_type &depth) const {
+    btree_node *node = m_root;
+    while (!node->leaf) {
+      inner_type *inner = static_cast<inner_type *>(node);
+      size_type child = child_index(inner, key);
+      path[depth++] = path_entry{inner, child};
+      node = inner->children[child];
+      prefetch_node(node);
+    }
+    return static_cast<leaf_type *>(node);
+  }
+
+  template <typename Predicate>
+  slot search(Predicate pred) const {
+    if (m_root == nullptr) return end_slot();
+    btree_node *node = m_root;
+    while (!node->leaf) {
+      const inner_type *inner = static_cast<const inner_type *>(node);
+      node = inner->children[node_partition_point(inner->keys, inner->count,
+                                                  pred)];
+      prefetch_node(node);
+    }
+    leaf_type *leaf = static_cast<leaf_type *>(node);
+    size_type index = node_partition_point(leaf->keys, leaf->count, pred);
+    // A key past the end of a leaf is the first key of the next one.
+    if (index == leaf->count && leaf->next != nullptr) {
+      return slot{leaf->next, 0};
+    }
+    return slot{leaf, index};
+  }
+
+  // Requests every cache line of a node's header and keys at once, so the
+  // later probes of the binary search do not each wait for memory in turn.
+  // Leaves and inner nodes both keep their keys right after the header, so
+  // this works without knowing which kind `node` is.
+  static void prefetch_node(const btree_node *node) {
+    constexpr size_type keys_offset =
+        (sizeof(btree_node) + alignof(Key) - 1) / alignof(Key) * alignof(Key);
+    const char *first = reinterpret_cast<const char *>(node);
+    const char *last = first + keys_offset + sizeof(Key) * node_slots - 1;
+    for (const char *line = first; line < last; line += cache_line_size) {
+      prefetch(line);
+    }
+    prefetch(last);
+  }
+
+  static void move_slot(leaf_type *to, size_type to_index, leaf_type *from,
+                        size_type from_index) {
+    to->keys[to_index] = move(from->keys[from_index]);
+    if constexpr (is_map) {
+      to->values[to_index] = move(from->values[from_index]);
+    }
+  }
+
+  // Opens a gap at `index` of a leaf that is not full.
+  static void shift_right(leaf_type *leaf, size_type index) {
+    for (size_type i = leaf->count; i > index; i--) {
+      move_slot(leaf, i, leaf, i - 1);
+    }
+  }
+
+  // Closes the slot at `index`, releasing what the last slot held.
+  static void shift_left(leaf_type *leaf, size_type index) {
+    for (size_type i = index + 1; i < leaf->count; i++) {
+      move_slot(leaf, i - 1, leaf, i);
+    }
+    leaf->count--;
+    leaf->keys[leaf->count] = Key();
+    if constexpr (is_map) leaf->values[leaf->count] = Mapped();
+  }
+
+  // Moves the upper half of a full leaf into a new leaf linked after it.
+  leaf_type *split_leaf(leaf_type *leaf) {
+    leaf_type *right = allocate_leaf();
+    size_type keep = node_slots / 2;
+    for (size_type i = keep; i < node_slots; i++) {
+      move_slot(right, i - keep, leaf, i);
+    }
+    right->count = std::uint16_t(node_slots - keep);
+    leaf->count = std::uint16_t(keep);
+    right->next = leaf->next;
+    right->prev = leaf;
+    if (leaf->next != nullptr) {
+      leaf->next->prev = right;
+    } else {
+      m_last = right;
+    }
+    leaf->next = right;
+    return right;
+  }
+
+  // Adds `right`, split off the node below path[depth - 1], to its parent,
+  // splitting full inner nodes up to the root.
+  void insert_into_parent(path_entry *path, size_type depth, Key separator,
+                          btree_node *right) {
+    while (depth > 0) {
+      path_entry entry = path[--depth];
+      inner_type *inner = entry.node;
+      size_type index = entry.child;
+      if (inner->count < node_slots) {
+        insert_separator(inner, index, move(separator), right);
+        return;
+      }
+      // Split around the middle key, which moves up a level.
+      inner_type *sibling = allocate_inner();
+      size_type keep = node_slots / 2;
+      if (index < keep) {
+        keep_left(inner, sibling, keep);
+        Key middle = move(inner->keys[keep - 1]);
+        inner->count = std::uint16_t(keep - 1);
+        insert_separator(inner, index, move(separator), right);
+        separator = move(middle);
+      } else if (index > keep) {
+        keep_left(inner, sibling, keep + 1);
+        Key middle = move(inner->keys[keep]);
+        inner->count = std::uint16_t(keep);
+        insert_separator(sibling, index - keep - 1, move(separator), right);
+        separator = move(middle);
+      } else {
+        // The new separator is the middle key itself.
+        keep_left(inner, sibling, keep);
+        sibling->children[0] = right;
+        inner->count = std::uint16_t(keep);
+      }
+      right = sibling;
+    }
+    inner_type *root = allocate_inner();
+    root->keys[0] = move(separator);
+    root->children[0] = m_root;
+    root->children[1] = right;
+    root->count = 1;
+    m_root = root;
+  }
+
+  // Moves keys [keep, count) and children [keep, count] of a full inner node
+  // into `sibling`, whose first child is then children[keep].
+  static void keep_left(inner_type *inner, inner_type *sibling,
+                        size_type keep) {
+    for (size_type i = keep; i < inner->count; i++) {
+      sibling->keys[i - keep] = move(inner->keys[i]);
+      sibling->children[i - keep] = inner->children[i];
+    }
+    sibling->children[inner->count - keep] = inner->children[inner->count];
+    sibling->count = std::uint16_t(inner->count - keep);
+  }
+
+  // Inserts `separator` and the child after it at position `index`.
+  static void insert_separator(inner_type *inner, size_type index,
+                               Key separator, btree_node *child) {
+    for (size_type i = inner->count; i > index; i--) {
+      inner->keys[i] = move(inner->keys[i - 1]);
+      inner->children[i + 1] = inner->children[i];
+    }
+    inner->keys[index] = move(separator);
+    inner->children[index + 1] = child;
+    inner->count++;
+  }
+
+  // Removes keys[index] and children[index + 1] of an inner node.
+  static void remove_separator(inner_type *inner, size_type index) {
+    for (size_type i = index + 1; i < inner->count; i++) {
+      inner->keys[i - 1] = move(inner->keys[i]);
+      inner->children[i] = inner->children[i + 1];
+    }
+    inner->count--;
+    inner->keys[inner->count] = Key();
+  }
+
+  // Refills a leaf that dropped below min_slots from a sibling under the
+  // same parent, or merges the two.
+  void rebalance_leaf(leaf_type *leaf, path_entry entry) {
+    inner_type *parent = entry.node;
+    size_type index = entry.child;
+    leaf_type *left =
+        index > 0 ? static_cast<leaf_type *>(parent->children[index - 1])
+                  : nullptr;
+    leaf_type *right =
+        index < parent->count
+            ? static_cast<leaf_type *>(parent->children[index + 1])
+            : nullptr;
+    if (left != nullptr && left->count > min_slots) {
+      shift_right(leaf, 0);
+      move_slot(leaf, 0, left, left->count - 1);
+      leaf->count++;
+      shift_left(left, left->count - 1);
+      parent->keys[index - 1] = leaf->keys[0];
+    } else if (right != nullptr && right->count > min_slots) {
+      move_slot(leaf, leaf->count, right, 0);
+      leaf->count++;
+      shift_left(right, 0);
+      parent->keys[index] = right->keys[0];
+    } else if (left != nullptr) {
+      merge_leaves(left, leaf);
+      remove_separator(parent, index - 1);
+    } else {
+      merge_leaves(leaf, right);
+      remove_separator(parent, index);
+    }
+  }
+
+  // Moves every element of `right` to the end of `left` and frees `right`.
+  void merge_leaves(leaf_type *left, leaf_type *right) {
+    for (size_type i = 0; i < right->count; i++) {
+      move_slot(left, left->count + i, right, i);
+    }
+    left->count += right->count;
+    left->next = right->next;
+    if (right->next != nullptr) {
+      right->next->prev = left;
+    } else {
+      m_last = left;
+    }
+    deallocate_leaf(right);
+  }
+
+  // Restores the minimum fill of the inner nodes on `path`, from
+  // path[depth] up, after one of their children was merged away.
+  void rebalance_inner(path_entry *path, size_type depth) {
+    while (true) {
+      inner_type *inner = path[depth].node;
+      if (depth == 0) {
+        if (inner->count == 0) {
+          m_root = inner->children[0];
+          deallocate_inner(inner);
+        }
+        return;
+      }
+      if (inner->count >= min_slots) return;
+      path_entry entry = path[--depth];
+      inner_type *parent = entry.node;
+      size_type index = entry.child;
+      inner_type *left =
+          index > 0 ? static_cast<inner_type *>(parent->children[index - 1])
+                    : nullptr;
+      inner_type *right =
+          index < parent->count
+              ? static_cast<inner_type *>(parent->children[index + 1])
+              : nullptr;
+      if (left != nullptr && left->count > min_slots) {
+        // Rotate the last child of `left` through the parent.
+        inner->children[inner->count + 1] = inner->children[inner->count];
+        for (size_type i = inner->count; i > 0; i--) {
+          inner->keys[i] = move(inner->keys[i - 1]);
+          inner->children[i] = inner->children[i - 1];
+        }
+        inner->keys[0] = move(parent->keys[index - 1]);
+        inner->children[0] = left->children[left->count];
+        inner->count++;
+        left->count--;
+        parent->keys[index - 1] = move(left->keys[left->count]);
+        return;
+      }
+      if (right != nullptr && right->count > min_slots) {
+        // Rotate the first child of `right` through the parent.
+        inner->keys[inner->count] = move(parent->keys[index]);
+        inner->children[inner->count + 1] = right->children[0];
+        inner->count++;
+        parent->keys[index] = move(right->keys[0]);
+        for (size_type i = 1; i < right->count; i++) {
+          right->keys[i - 1] = move(right->keys[i]);
+          right->children[i - 1] = right->children[i];
+        }
+        right->children[right->count - 1] = right->children[right->count];
+        right->count--;
+        return;
+      }
+      if (left != nullptr) {
+        merge_inner(left, inner, move(parent->keys[index - 1]));
+        remove_separator(parent, index - 1);
+      } else {
+        merge_inner(inner, right, move(parent->keys[index]));
+        remove_separator(parent, index);
+      }
+    }
+  }
+
+  // Appends `separator` and the contents of `right` to `left`, then frees
+  // `right`.
+  void merge_inner(inner_type *left, inner_type *right, Key separator) {
+    left->keys[left->count] = move(separator);
+    for (size_type i = 0; i < right->count; i++) {
+      left->keys[left->count + 1 + i] = move(right->keys[i]);
+      left->children[left->count + 1 + i] = right->children[i];
+    }
+    left->children[left->count + 1 + right->count] =
+        right->children[right->count];
+    left->count += right->count + 1;
+    deallocate_inner(right);
+  }
+
+  leaf_type *allocate_leaf() {
+    leaf_allocator alloc;
+    leaf_type *leaf = alloc.allocate(1);
+    leaf->leaf = true;
+    leaf->count = 0;
+    leaf->prev = nullptr;
+    leaf->next = nullptr;
+    return leaf;
+  }
+
+  inner_type *allocate_inner() {
+    inner_allocator alloc;
+    inner_type *inner = alloc.allocate(1);
+    inner->leaf = false;
+    inner->count = 0;
+    return inner;
+  }
+
+  static void deallocate_leaf(leaf_type *leaf) {
+    leaf_allocator alloc;
+    alloc.deallocate(leaf);
+  }
+
+  static void deallocate_inner(inner_type *inner) {
+    inner_allocator alloc;
+    alloc.deallocate(inner);
+  }
+
+  static void free_subtree(btree_node *node) {
+    if (node->leaf) {
+      deallocate_leaf(static_cast<leaf_type *>(node));
+      return;
+    }
+    inner_type *inner = static_cast<inner_type *>(node);
+    for (size_type i = 0; i <= inner->count; i++) {
+      free_subtree(inner->children[i]);
+    }
+    deallocate_inner(inner);
+  }
+};
+
+}  // namespace internal
+}  // namespace open_stl
+
+#endif  // OPEN_STL_INTERNAL_BTREE_H_
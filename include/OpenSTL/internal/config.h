@@ -0,0 +1,18 @@
+#ifndef OPEN_STL_INTERNAL_CONFIG_H_
+#define OPEN_STL_INTERNAL_CONFIG_H_
+
+// Defined when the target has SSE2: every x86-64 target, and 32-bit x86
+// targets built for it. GCC and Clang say so with __SSE2__, MSVC with _M_X64
+// or _M_IX86_FP.
+#if defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define OPEN_STL_HAS_SSE2
+#endif
+
+// Defined when the target has AVX2, which GCC, Clang and MSVC all announce
+// with __AVX2__.
+#if defined(__AVX2__)
+#define OPEN_STL_HAS_AVX2
+#endif
+
+#endif  // OPEN_STL_INTERNAL_CONFIG_H_
@@ -1,6 +1,8 @@
 #ifndef OPEN_STL_INTERNAL_ITERATOR_H_
 #define OPEN_STL_INTERNAL_ITERATOR_H_
 
+#include <OpenSTL/type_traits.h>
+
 #include <cstddef>
 
 namespace open_stl {
@@ -67,6 +69,7 @@ struct iterator_traits {
         - T: The type of the elements pointed to by the pointer.
 
     Members:
+        - iterator_category: Always random_access_iterator_tag.
         - value_type: The type of the elements pointed to by the pointer.
         - pointer: Pointer to the type pointed by the iterator.
         - reference: Reference to the type pointed by the iterator.
@@ -78,7 +81,7 @@ struct iterator_traits {
 */
 template <typename T>
 struct iterator_traits<T *> {
-  using category = random_access_iterator_tag;
+  using iterator_category = random_access_iterator_tag;
   using value_type = T;
   using difference_type = std::ptrdiff_t;
   using pointer = T *;
@@ -93,6 +96,7 @@ struct iterator_traits<T *> {
         - T: The type of the elements pointed to by the constant pointer.
 
     Members:
+        - iterator_category: Always random_access_iterator_tag.
         - value_type: The type of the elements pointed to by the constant
    pointer.
         - pointer: Constant pointer to the type pointed by the iterator.
@@ -105,12 +109,95 @@ struct iterator_traits<T *> {
 */
 template <typename T>
 struct iterator_traits<const T *> {
+  using iterator_category = random_access_iterator_tag;
   using value_type = const T;
   using difference_type = std::ptrdiff_t;
   using pointer = const T *;
   using reference = const T &;
 };
 
+/*
+    Template struct to determine if an iterator supports random access.
+
+    Template Parameters:
+        - Iterator: The type of the iterator to be checked.
+
+    Members:
+        - value: True if the iterator is a raw pointer or declares an
+   iterator_category derived from random_access_iterator_tag, false otherwise.
+
+    Algorithms use this to pick an indexed, unrolled implementation (and to
+   allow splitting the range across threads) when the iterator permits it.
+*/
+template <typename Iterator>
+struct is_random_access_iterator {
+  static constexpr bool value = false;
+};
+
+template <typename Iterator>
+  requires requires { typename Iterator::iterator_category; }
+struct is_random_access_iterator<Iterator> {
+  static constexpr bool value =
+      is_base_of<random_access_iterator_tag,
+                 typename Iterator::iterator_category>::value;
+};
+
+template <typename T>
+struct is_random_access_iterator<T *> {
+  static constexpr bool value = true;
+};
+
+/*
+    Counts the increments needed to get from one iterator to another.
+
+    Template Parameters:
+        - Iterator: The type of the iterators.
+
+    Parameters:
+        - first: The beginning of the range.
+        - last: The end of the range.
+
+    Returns:
+        - The number of elements in [first, last). Random-access iterators
+   subtract in constant time; all others are walked one step at a time.
+*/
+template <typename Iterator>
+constexpr std::ptrdiff_t distance(Iterator first, Iterator last) {
+  if constexpr (is_random_access_iterator<Iterator>::value) {
+    return last - first;
+  } else {
+    std::ptrdiff_t count = 0;
+    for (; first != last; ++first) {
+      count++;
+    }
+    return count;
+  }
+}
+
+/*
+    Moves an iterator forward by a number of elements.
+
+    Template Parameters:
+        - Iterator: The type of the iterator.
+
+    Parameters:
+        - it: The iterator to move.
+        - count: The non-negative number of elements to move by.
+
+    Random-access iterators jump in constant time; all others are walked one
+   step at a time.
+*/
+template <typename Iterator>
+constexpr void advance(Iterator &it, std::ptrdiff_t count) {
+  if constexpr (is_random_access_iterator<Iterator>::value) {
+    it += count;
+  } else {
+    for (; count > 0; count--) {
+      ++it;
+    }
+  }
+}
+
 }  // namespace internal
 }  // namespace open_stl
 
@@ -0,0 +1,72 @@
+#ifndef OPEN_STL_INTERNAL_PARALLEL_H_
+#define OPEN_STL_INTERNAL_PARALLEL_H_
+
+#include <OpenSTL/thread_pool.h>
+
+#include <cstddef>
+
+namespace open_stl {
+namespace internal {
+
+// Smallest number of elements worth handing to a separate thread. Below this
+// the cost of starting the thread outweighs the work it saves.
+inline constexpr std::size_t parallel_grain = 1 << 14;
+
+/*
+    Chooses how many blocks a range of `count` elements is split into.
+
+    Parameters:
+        - count: The number of elements in the range.
+
+    Returns:
+        - At least one, and at most one block per hardware thread, with every
+   block holding no fewer than parallel_grain elements.
+*/
+inline std::size_t parallel_block_count(std::size_t count) {
+  std::size_t blocks = count / parallel_grain;
+  std::size_t threads = hardware_threads();
+  if (blocks > threads) blocks = threads;
+  return blocks == 0 ? 1 : blocks;
+}
+
+/*
+    Returns the first index of block `block` when `count` elements are split
+   into `blocks` nearly equal blocks. Block `blocks` starts at `count`.
+*/
+inline std::size_t block_begin(std::size_t block, std::size_t blocks,
+                               std::size_t count) {
+  return count / blocks * block + (block < count % blocks ? block
+                                                          : count % blocks);
+}
+
+/*
+    Runs a function once for every block index on the default thread pool.
+
+    Template Parameters:
+        - Function: A callable taking the block index as std::size_t.
+
+    Parameters:
+        - blocks: The number of blocks to run.
+        - function: The work to perform for each block.
+
+    Throws:
+        - The first exception thrown by any block, after all blocks finished.
+
+    The calling thread takes part, so a single block never touches the pool,
+   and no threads are started per call: the blocks become tasks of
+   default_thread_pool(). The function returns once every block has
+   completed.
+*/
+template <typename Function>
+void parallel_blocks(std::size_t blocks, Function function) {
+  if (blocks <= 1) {
+    if (blocks == 1) function(std::size_t(0));
+    return;
+  }
+  default_thread_pool().parallel_for(0, blocks, function, 1);
+}
+
+}  // namespace internal
+}  // namespace open_stl
+
+#endif  // OPEN_STL_INTERNAL_PARALLEL_H_
@@ -0,0 +1,43 @@
+#ifndef OPEN_STL_INTERNAL_PREFETCH_H_
+#define OPEN_STL_INTERNAL_PREFETCH_H_
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <xmmintrin.h>
+#endif
+
+#include <cstddef>
+
+namespace open_stl {
+namespace internal {
+
+// Size in bytes of a cache line on the targets the library is tuned for.
+inline constexpr std::size_t cache_line_size = 64;
+
+// Number of keys a batched lookup hashes and prefetches before it touches
+// the first of them: enough to overlap the cache misses of the batch.
+inline constexpr std::size_t prefetch_batch_size = 16;
+
+/*
+    Hints the processor to start loading the cache line holding an address.
+
+    Parameters:
+        - address: Any address; it is never dereferenced, so it may point
+   past the end of an allocation.
+
+    The hint has no observable effect on program behavior. On compilers
+   without a prefetch intrinsic it does nothing.
+*/
+inline void prefetch(const void *address) {
+#if defined(__GNUC__) || defined(__clang__)
+  __builtin_prefetch(address);
+#elif defined(_MSC_VER)
+  _mm_prefetch(static_cast<const char *>(address), _MM_HINT_T0);
+#else
+  (void)address;
+#endif
+}
+
+}  // namespace internal
+}  // namespace open_stl
+
+#endif  // OPEN_STL_INTERNAL_PREFETCH_H_
@@ -0,0 +1,525 @@
+#ifndef OPEN_STL_INTERNAL_RAW_HASH_TABLE_H_
+#define OPEN_STL_INTERNAL_RAW_HASH_TABLE_H_
+
+#include <OpenSTL/functional.h>
+#include <OpenSTL/internal/config.h>
+#include <OpenSTL/internal/iterator.h>
+#include <OpenSTL/internal/prefetch.h>
+#include <OpenSTL/utility.h>
+
+#ifdef OPEN_STL_HAS_SSE2
+#include <emmintrin.h>
+#endif
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace open_stl {
+namespace internal {
+
+// One metadata byte per slot. A full slot stores the low 7 bits of its hash
+// (always non-negative); an empty slot stores ctrl_empty, the only value with
+// the sign bit set.
+using ctrl_t = signed char;
+inline constexpr ctrl_t ctrl_empty = -128;
+
+// Number of metadata bytes compared at once.
+inline constexpr std::size_t group_width = 16;
+
+/*
+    A window of group_width metadata bytes, compared with one SIMD
+   instruction where SSE2 is available.
+
+    Every match function returns a bit mask with bit i set when byte i of the
+   window matches.
+*/
+class ctrl_group {
+ public:
+#ifdef OPEN_STL_HAS_SSE2
+  explicit ctrl_group(const ctrl_t *ctrl)
+      : m_ctrl(_mm_loadu_si128(reinterpret_cast<const __m128i *>(ctrl))) {}
+
+  // Returns the bytes holding hash fragment `h2`.
+  std::uint32_t match(ctrl_t h2) const {
+    return static_cast<std::uint32_t>(
+        _mm_movemask_epi8(_mm_cmpeq_epi8(m_ctrl, _mm_set1_epi8(h2))));
+  }
+
+  // Returns the empty bytes. Empty is the only value with the sign bit set,
+  // so the sign mask alone answers the question.
+  std::uint32_t match_empty() const {
+    return static_cast<std::uint32_t>(_mm_movemask_epi8(m_ctrl));
+  }
+
+ private:
+  __m128i m_ctrl;
+#else
+  explicit ctrl_group(const ctrl_t *ctrl) {
+    std::memcpy(m_ctrl, ctrl, group_width);
+  }
+
+  std::uint32_t match(ctrl_t h2) const {
+    std::uint32_t mask = 0;
+    for (std::size_t i = 0; i < group_width; i++) {
+      mask |= std::uint32_t(m_ctrl[i] == h2) << i;
+    }
+    return mask;
+  }
+
+  std::uint32_t match_empty() const {
+    std::uint32_t mask = 0;
+    for (std::size_t i = 0; i < group_width; i++) {
+      mask |= std::uint32_t(m_ctrl[i] < 0) << i;
+    }
+    return mask;
+  }
+
+ private:
+  ctrl_t m_ctrl[group_width];
+#endif
+};
+
+// Scrambles a user hash so that both the slot position (high bits) and the
+// metadata fragment (low 7 bits) depend on every input bit. This keeps the
+// table usable with weak hashes such as the identity hash on integers.
+// Hashes that declare `is_avalanching` are already mixed and skip this.
+inline std::size_t mix_hash(std::size_t hash) {
+  std::uint64_t value = static_cast<std::uint64_t>(hash);
+  value ^= value >> 32;
+  value *= 0x9e3779b97f4a7c15ull;
+  value ^= value >> 29;
+  return static_cast<std::size_t>(value);
+}
+
+/*
+    An open-addressing hash table storing its elements inline, shared by
+   flat_hash_map and flat_hash_set.
+
+    Template Parameters:
+        - Policy: Describes the slot: `slot_type`, `key_type` and a static
+   `key(slot)` returning the key of a slot.
+        - Hash: The hash function object.
+        - KeyEqual: The key equality function object.
+        - Allocator: The allocator for slots; it is rebound to allocate the
+   metadata bytes.
+
+    The table is a power-of-two array of slots plus one metadata byte per
+   slot. A key's hash picks its home slot (high bits) and a 7-bit fragment
+   stored in the metadata (low bits). Lookups compare the fragment against
+   16 metadata bytes at a time and only compare keys on fragment hits, so a
+   miss usually costs a single SIMD compare.
+
+    Keys are placed by linear probing from their home slot, and the table
+   keeps the invariant that every slot between a key's home and the key is
+   full. That lets erase close the gap by shifting later keys of the same
+   run back (backward-shift deletion) instead of leaving tombstones, so
+   lookups never slow down as keys are erased. The metadata array is
+   followed by a copy of its first 15 bytes so a group can be loaded at any
+   position without wrapping.
+*/
+template <typename Policy, typename Hash, typename KeyEqual,
+          typename Allocator>
+class raw_hash_table {
+ public:
+  using key_type = typename Policy::key_type;
+  using slot_type = typename Policy::slot_type;
+  using size_type = std::size_t;
+
+  // Returned by lookups that find nothing.
+  static constexpr size_type npos = static_cast<size_type>(-1);
+
+  explicit raw_hash_table(const Hash &hash = Hash(),
+                          const KeyEqual &eq = KeyEqual())
+      : m_ctrl(nullptr),
+        m_slots(nullptr),
+        m_size(0),
+        m_capacity(0),
+        m_hash(hash),
+        m_eq(eq) {}
+
+  raw_hash_table(const raw_hash_table &right)
+      : m_ctrl(nullptr),
+        m_slots(nullptr),
+        m_size(right.m_size),
+        m_capacity(right.m_capacity),
+        m_hash(right.m_hash),
+        m_eq(right.m_eq) {
+    if (m_capacity == 0) return;
+    allocate(m_capacity);
+    std::memcpy(m_ctrl, right.m_ctrl, m_capacity + group_width - 1);
+    for (size_type i = 0; i < m_capacity; i++) {
+      if (m_ctrl[i] != ctrl_empty) m_slots[i] = right.m_slots[i];
+    }
+  }
+
+  raw_hash_table(raw_hash_table &&right)
+      : m_ctrl(right.m_ctrl),
+        m_slots(right.m_slots),
+        m_size(right.m_size),
+        m_capacity(right.m_capacity),
+        m_hash(right.m_hash),
+        m_eq(right.m_eq) {
+    right.m_ctrl = nullptr;
+    right.m_slots = nullptr;
+    right.m_size = 0;
+    right.m_capacity = 0;
+  }
+
+  ~raw_hash_table() { deallocate(); }
+
+  raw_hash_table &operator=(const raw_hash_table &right) {
+    if (this != &right) {
+      raw_hash_table copy(right);
+      swap(copy);
+    }
+    return *this;
+  }
+
+  raw_hash_table &operator=(raw_hash_table &&right) {
+    if (this != &right) {
+      deallocate();
+      m_ctrl = right.m_ctrl;
+      m_slots = right.m_slots;
+      m_size = right.m_size;
+      m_capacity = right.m_capacity;
+      m_hash = right.m_hash;
+      m_eq = right.m_eq;
+      right.m_ctrl = nullptr;
+      right.m_slots = nullptr;
+      right.m_size = 0;
+      right.m_capacity = 0;
+    }
+    return *this;
+  }
+
+  void swap(raw_hash_table &right) {
+    open_stl::swap(m_ctrl, right.m_ctrl);
+    open_stl::swap(m_slots, right.m_slots);
+    open_stl::swap(m_size, right.m_size);
+    open_stl::swap(m_capacity, right.m_capacity);
+    open_stl::swap(m_hash, right.m_hash);
+    open_stl::swap(m_eq, right.m_eq);
+  }
+
+  size_type size() const { return m_size; }
+  size_type capacity() const { return m_capacity; }
+  const ctrl_t *ctrl() const { return m_ctrl; }
+  slot_type *slots() const { return m_slots; }
+  const Hash &hash_function() const { return m_hash; }
+  const KeyEqual &key_eq() const { return m_eq; }
+
+  // Returns the slot index holding `key`, or npos.
+  template <typename K>
+  size_type find(const K &key) const {
+    if (m_capacity == 0) return npos;
+    pair<size_type, bool> slot = probe(key, hash_of(key));
+    return slot.second ? slot.first : npos;
+  }
+
+  // Hints the processor to load the home group of `key` ahead of a find.
+  template <typename K>
+  void prefetch(const K &key) const {
+    if (m_capacity == 0) return;
+    size_type pos = (hash_of(key) >> 7) & (m_capacity - 1);
+    internal::prefetch(m_ctrl + pos);
+    internal::prefetch(m_slots + pos);
+  }
+
+  /*
+      Finds `key`, or reserves the slot it would be inserted into.
+
+      Returns:
+          - The slot index and whether the slot is new. A new slot is marked
+     full and counted in size(); the caller must assign its contents.
+
+      The table only grows when the key is absent, so finding a key that is
+     present never rehashes, even in a table at its load limit.
+  */
+  template <typename K>
+  pair<size_type, bool> find_or_prepare_insert(const K &key) {
+    size_type hash = hash_of(key);
+    size_type index = npos;
+    if (m_capacity != 0) {
+      pair<size_type, bool> slot = probe(key, hash);
+      if (slot.second) return pair<size_type, bool>(slot.first, false);
+      index = slot.first;
+    }
+    if (m_capacity == 0 || m_size + 1 > max_load(m_capacity)) {
+      resize(m_capacity == 0 ? group_width : m_capacity * 2);
+      index = find_empty(hash);
+    }
+    set_ctrl(index, static_cast<ctrl_t>(hash & 0x7f));
+    m_size++;
+    return pair<size_type, bool>(index, true);
+  }
+
+  /*
+      Removes the element in slot `index` and shifts later elements of the
+     same probe run back into the gap.
+
+      An element may move into the gap only if its home slot is not inside
+     the stretch between the gap and the element, otherwise a lookup starting
+     from its home would no longer reach it. The loop stops at the first
+     empty slot, which ends the run. The slot left empty at the end is reset
+     to a default value so it releases any resources it held.
+  */
+  void erase_at(size_type index) {
+    size_type mask = m_capacity - 1;
+    size_type hole = index;
+    size_type next = index;
+    while (true) {
+      next = (next + 1) & mask;
+      if (m_ctrl[next] == ctrl_empty) break;
+      size_type home = (hash_of(Policy::key(m_slots[next])) >> 7) & mask;
+      if (((next - home) & mask) >= ((next - hole) & mask)) {
+        m_slots[hole] = move(m_slots[next]);
+        set_ctrl(hole, m_ctrl[next]);
+        hole = next;
+      }
+    }
+    set_ctrl(hole, ctrl_empty);
+    m_slots[hole] = slot_type();
+    m_size--;
+  }
+
+  // Removes `key` if present and returns how many elements were removed.
+  template <typename K>
+  size_type erase(const K &key) {
+    size_type index = find(key);
+    if (index == npos) return 0;
+    erase_at(index);
+    return 1;
+  }
+
+  /*
+      Removes every element satisfying `pred` and returns how many were
+     removed.
+
+      The scan starts just after an empty slot, so every probe run is visited
+     front to back in one piece. Backward shifts then only ever move elements
+     that have not been visited yet into the current position, which is
+     checked again before moving on.
+  */
+  template <typename Predicate>
+  size_type erase_if(Predicate pred) {
+    if (m_size == 0) return 0;
+    size_type mask = m_capacity - 1;
+    size_type start = 0;
+    while (m_ctrl[start] != ctrl_empty) start++;
+    size_type removed = 0;
+    for (size_type step = 1; step <= m_capacity; step++) {
+      size_type index = (start + step) & mask;
+      while (m_ctrl[index] != ctrl_empty && pred(m_slots[index])) {
+        erase_at(index);
+        removed++;
+      }
+    }
+    return removed;
+  }
+
+  // Removes every element but keeps the allocated capacity.
+  void clear() {
+    for (size_type i = 0; i < m_capacity; i++) {
+      if (m_ctrl[i] != ctrl_empty) m_slots[i] = slot_type();
+    }
+    if (m_capacity != 0) {
+      std::memset(m_ctrl, ctrl_empty, m_capacity + group_width - 1);
+    }
+    m_size = 0;
+  }
+
+  // Grows the table so that `count` elements fit without a rehash.
+  void reserve(size_type count) {
+    size_type capacity = group_width;
+    while (max_load(capacity) < count) capacity *= 2;
+    if (capacity > m_capacity) resize(capacity);
+  }
+
+  // The table grows once it would be more than 7/8 full.
+  static size_type max_load(size_type capacity) {
+    return capacity - capacity / 8;
+  }
+
+ private:
+  using slot_allocator = Allocator;
+  using ctrl_allocator = typename Allocator::template rebind<ctrl_t>::other;
+
+  ctrl_t *m_ctrl;
+  slot_type *m_slots;
+  size_type m_size;
+  size_type m_capacity;
+  Hash m_hash;
+  KeyEqual m_eq;
+
+  // Returns the mixed hash of a key.
+  template <typename K>
+  size_type hash_of(const K &key) const {
+    if constexpr (requires { typename Hash::is_avalanching; }) {
+      return m_hash(key);
+    } else {
+      return mix_hash(m_hash(key));
+    }
+  }
+
+  // Looks up `key`, whose hash is `hash`, in a table with slots. Returns its
+  // slot and true, or the first empty slot of its probe run and false.
+  template <typename K>
+  pair<size_type, bool> probe(const K &key, size_type hash) const {
+    ctrl_t h2 = static_cast<ctrl_t>(hash & 0x7f);
+    size_type mask = m_capacity - 1;
+    size_type pos = (hash >> 7) & mask;
+    while (true) {
+      ctrl_group group(m_ctrl + pos);
+      for (std::uint32_t match = group.match(h2); match != 0;
+           match &= match - 1) {
+        size_type index = (pos + std::countr_zero(match)) & mask;
+        if (m_eq(Policy::key(m_slots[index]), key)) {
+          return pair<size_type, bool>(index, true);
+        }
+      }
+      std::uint32_t empty = group.match_empty();
+      if (empty != 0) {
+        return pair<size_type, bool>((pos + std::countr_zero(empty)) & mask,
+                                     false);
+      }
+      pos = (pos + group_width) & mask;
+    }
+  }
+
+  // Returns the first empty slot of the probe run of `hash`.
+  size_type find_empty(size_type hash) const {
+    size_type mask = m_capacity - 1;
+    size_type pos = (hash >> 7) & mask;
+    while (true) {
+      std::uint32_t empty = ctrl_group(m_ctrl + pos).match_empty();
+      if (empty != 0) return (pos + std::countr_zero(empty)) & mask;
+      pos = (pos + group_width) & mask;
+    }
+  }
+
+  // Writes a metadata byte, mirroring the first group_width - 1 bytes into
+  // the tail copy.
+  void set_ctrl(size_type index, ctrl_t value) {
+    m_ctrl[index] = value;
+    if (index < group_width - 1) m_ctrl[m_capacity + index] = value;
+  }
+
+  void allocate(size_type capacity) {
+    ctrl_allocator ctrl_alloc;
+    slot_allocator slot_alloc;
+    m_ctrl = ctrl_alloc.allocate(capacity + group_width - 1);
+    m_slots = slot_alloc.allocate(capacity);
+    m_capacity = capacity;
+  }
+
+  void deallocate() {
+    if (m_capacity == 0) return;
+    ctrl_allocator ctrl_alloc;
+    slot_allocator slot_alloc;
+    ctrl_alloc.deallocate(m_ctrl);
+    slot_alloc.deallocate(m_slots);
+    m_ctrl = nullptr;
+    m_slots = nullptr;
+    m_capacity = 0;
+  }
+
+  // Moves every element into a new table of `capacity` slots. Keys are known
+  // to be distinct, so each one goes straight to the first empty slot of its
+  // probe run.
+  void resize(size_type capacity) {
+    ctrl_t *old_ctrl = m_ctrl;
+    slot_type *old_slots = m_slots;
+    size_type old_capacity = m_capacity;
+    allocate(capacity);
+    std::memset(m_ctrl, ctrl_empty, capacity + group_width - 1);
+    for (size_type i = 0; i < old_capacity; i++) {
+      if (old_ctrl[i] == ctrl_empty) continue;
+      size_type hash = hash_of(Policy::key(old_slots[i]));
+      size_type index = find_empty(hash);
+      set_ctrl(index, static_cast<ctrl_t>(hash & 0x7f));
+      m_slots[index] = move(old_slots[i]);
+    }
+    if (old_capacity != 0) {
+      ctrl_allocator ctrl_alloc;
+      slot_allocator slot_alloc;
+      ctrl_alloc.deallocate(old_ctrl);
+      slot_alloc.deallocate(old_slots);
+    }
+  }
+};
+
+/*
+    Forward iterator over the full slots of a raw_hash_table.
+
+    Template Parameters:
+        - Slot: The slot type, const-qualified for const iterators.
+
+    The iterator walks the metadata bytes and stops on every full slot.
+*/
+template <typename Slot>
+class hash_table_iterator {
+ public:
+  using iterator_category = forward_iterator_tag;
+  using value_type = Slot;
+  using difference_type = std::ptrdiff_t;
+  using pointer = Slot *;
+  using reference = Slot &;
+
+  hash_table_iterator() : m_ctrl(nullptr), m_slot(nullptr), m_end(nullptr) {}
+
+  hash_table_iterator(const ctrl_t *ctrl, Slot *slot, const ctrl_t *end)
+      : m_ctrl(ctrl), m_slot(slot), m_end(end) {
+    skip_empty();
+  }
+
+  // Converts an iterator to a const iterator.
+  template <typename Other>
+  hash_table_iterator(const hash_table_iterator<Other> &other)
+      : m_ctrl(other.m_ctrl), m_slot(other.m_slot), m_end(other.m_end) {}
+
+  reference operator*() const { return *m_slot; }
+  pointer operator->() const { return m_slot; }
+
+  hash_table_iterator &operator++() {
+    ++m_ctrl;
+    ++m_slot;
+    skip_empty();
+    return *this;
+  }
+
+  hash_table_iterator operator++(int) {
+    hash_table_iterator it = *this;
+    ++(*this);
+    return it;
+  }
+
+  bool operator==(const hash_table_iterator &right) const {
+    return m_ctrl == right.m_ctrl;
+  }
+
+  bool operator!=(const hash_table_iterator &right) const {
+    return m_ctrl != right.m_ctrl;
+  }
+
+ private:
+  template <typename Other>
+  friend class hash_table_iterator;
+
+  const ctrl_t *m_ctrl;
+  Slot *m_slot;
+  const ctrl_t *m_end;
+
+  void skip_empty() {
+    while (m_ctrl != m_end && *m_ctrl == ctrl_empty) {
+      ++m_ctrl;
+      ++m_slot;
+    }
+  }
+};
+
+}  // namespace internal
+}  // namespace open_stl
+
+#endif  // OPEN_STL_INTERNAL_RAW_HASH_TABLE_H_
@@ -11,6 +11,8 @@ namespace internal {
 template <typename RandomIterator>
 class reverse_iterator {
  public:
+  using iterator_category =
+      typename iterator_traits<RandomIterator>::iterator_category;
   using difference_type =
       typename iterator_traits<RandomIterator>::difference_type;
   using iterator_type = RandomIterator;
@@ -25,7 +27,7 @@ class reverse_iterator {
 
       Initializes a reverse_iterator with the provided iterator.
   */
-  explicit reverse_iterator(const iterator_type &iterator)
+  constexpr explicit reverse_iterator(const iterator_type &iterator)
       : m_iterator(iterator) {}
 
   /*
@@ -34,7 +36,7 @@ class reverse_iterator {
       Returns:
           The underlying iterator.
   */
-  RandomIterator base() const { return m_iterator; }
+  constexpr RandomIterator base() const { return m_iterator; }
 
   /*
       Dereference operator for reverse_iterator.
@@ -42,7 +44,7 @@ class reverse_iterator {
       Returns:
           A reference to the value pointed to by the underlying iterator.
   */
-  reference operator*() const { return *m_iterator; }
+  constexpr reference operator*() const { return *m_iterator; }
 
   /*
   Addition operator for reverse_iterator.
@@ -54,7 +56,8 @@ class reverse_iterator {
       A new reverse_iterator resulting from adding the offset to the underlying
   iterator.
   */
-  reverse_iterator<RandomIterator> operator+(difference_type off) const {
+  constexpr reverse_iterator<RandomIterator> operator+(
+      difference_type off) const {
     return reverse_iterator<RandomIterator>(m_iterator - off);
   }
 
@@ -64,7 +67,7 @@ class reverse_iterator {
       Returns:
           A reference to the incremented reverse_iterator.
   */
-  reverse_iterator<RandomIterator> &operator++() {
+  constexpr reverse_iterator<RandomIterator> &operator++() {
     m_iterator--;
     return *this;
   }
@@ -75,7 +78,7 @@ class reverse_iterator {
       Returns:
           A copy of the reverse_iterator before incrementing.
   */
-  reverse_iterator<RandomIterator> operator++(int) {
+  constexpr reverse_iterator<RandomIterator> operator++(int) {
     reverse_iterator<RandomIterator> it = *this;
     ++(*this);
     return it;
@@ -90,7 +93,7 @@ class reverse_iterator {
       Returns:
           A reference to the incremented reverse_iterator.
   */
-  reverse_iterator<RandomIterator> &operator+=(difference_type off) {
+  constexpr reverse_iterator<RandomIterator> &operator+=(difference_type off) {
     m_iterator = m_iterator - off;
     return *this;
   }
@@ -106,7 +109,8 @@ class reverse_iterator {
      underlying iterator.
   */
 
-  reverse_iterator<RandomIterator> operator-(difference_type off) const {
+  constexpr reverse_iterator<RandomIterator> operator-(
+      difference_type off) const {
     return reverse_iterator<RandomIterator>(m_iterator + off);
   }
 
@@ -116,7 +120,7 @@ class reverse_iterator {
       Returns:
           A reference to the decremented reverse_iterator.
   */
-  reverse_iterator<RandomIterator> &operator--() {
+  constexpr reverse_iterator<RandomIterator> &operator--() {
     m_iterator++;
     return *this;
   }
@@ -127,7 +131,7 @@ class reverse_iterator {
       Returns:
           A copy of the reverse_iterator before decrementing.
   */
-  reverse_iterator<RandomIterator> operator--(int) {
+  constexpr reverse_iterator<RandomIterator> operator--(int) {
     reverse_iterator<RandomIterator> it = *this;
     --(*this);
     return reverse_iterator<RandomIterator>(it);
@@ -142,7 +146,7 @@ class reverse_iterator {
       Returns:
           A reference to the decremented reverse_iterator.
   */
-  reverse_iterator<RandomIterator> &operator-=(difference_type off) {
+  constexpr reverse_iterator<RandomIterator> &operator-=(difference_type off) {
     m_iterator = m_iterator + off;
     return *this;
   }
@@ -153,7 +157,7 @@ class reverse_iterator {
       Returns:
           A pointer to the underlying iterator's value.
   */
-  pointer operator->() const { return &(*m_iterator); }
+  constexpr pointer operator->() const { return &(*m_iterator); }
 
   /*
       Equality comparison operator for reverse_iterator.
@@ -164,7 +168,8 @@ class reverse_iterator {
       Returns:
           True if the iterators are equal, false otherwise.
   */
-  bool operator==(const reverse_iterator<RandomIterator> &right) const {
+  constexpr bool operator==(
+      const reverse_iterator<RandomIterator> &right) const {
     return m_iterator == right.m_iterator;
   }
 
@@ -177,7 +182,8 @@ class reverse_iterator {
       Returns:
           True if the iterators are not equal, false otherwise.
   */
-  bool operator!=(const reverse_iterator<RandomIterator> &right) const {
+  constexpr bool operator!=(
+      const reverse_iterator<RandomIterator> &right) const {
     return m_iterator != right.m_iterator;
   }
 
@@ -191,7 +197,8 @@ class reverse_iterator {
           True if the left iterator is less than the right iterator, false
      otherwise.
   */
-  bool operator<(const reverse_iterator<RandomIterator> &right) const {
+  constexpr bool operator<(
+      const reverse_iterator<RandomIterator> &right) const {
     return m_iterator > right.m_iterator;
   }
 
@@ -205,7 +212,8 @@ class reverse_iterator {
           True if the left iterator is less than or equal to the right iterator,
      false otherwise.
   */
-  bool operator<=(const reverse_iterator<RandomIterator> &right) const {
+  constexpr bool operator<=(
+      const reverse_iterator<RandomIterator> &right) const {
     return m_iterator >= right.m_iterator;
   }
 
@@ -219,7 +227,8 @@ class reverse_iterator {
           True if the left iterator is greater than the right iterator, false
      otherwise.
   */
-  bool operator>(const reverse_iterator<RandomIterator> &right) const {
+  constexpr bool operator>(
+      const reverse_iterator<RandomIterator> &right) const {
     return m_iterator < right.m_iterator;
   }
 
@@ -233,7 +242,8 @@ class reverse_iterator {
           True if the left iterator is greater than or equal to the right
      iterator, false otherwise.
   */
-  bool operator>=(const reverse_iterator<RandomIterator> &right) const {
+  constexpr bool operator>=(
+      const reverse_iterator<RandomIterator> &right) const {
     return m_iterator <= right.m_iterator;
   }
 
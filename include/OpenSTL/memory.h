@@ -17,6 +17,13 @@ class allocator {
   using difference_type = std::ptrdiff_t;
   using const_reference = const T &;
 
+  // Names the allocator type for another element type, so a container can
+  // allocate its bookkeeping arrays from the same family of allocators.
+  template <typename U>
+  struct rebind {
+    using other = allocator<U>;
+  };
+
   pointer address(const_reference val, const void *hint = nullptr) const {
     return &val;
   }
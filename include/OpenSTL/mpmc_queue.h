@@ -0,0 +1,316 @@
+#ifndef OPEN_STL_MPMC_QUEUE_H_
+#define OPEN_STL_MPMC_QUEUE_H_
+
+#include <OpenSTL/internal/prefetch.h>
+#include <OpenSTL/memory.h>
+#include <OpenSTL/utility.h>
+
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <thread>
+
+namespace open_stl {
+namespace internal {
+
+// A slot of mpmc_queue: the element and the sequence number that says whose
+// turn it is to use it.
+template <typename T>
+struct mpmc_cell {
+  std::atomic<std::size_t> sequence{0};
+  T value;
+};
+
+// Waits until `sequence` holds `expected`: spins briefly, since the other
+// side is usually mid-operation, then sleeps on the atomic. `waiters` counts
+// the sleeping threads so that the other side only pays for a wake-up when
+// someone can be asleep.
+inline void wait_for_sequence(const std::atomic<std::size_t> &sequence,
+                              std::size_t expected,
+                              std::atomic<std::size_t> &waiters) {
+  for (int spin = 0; spin < 64; spin++) {
+    if (sequence.load(std::memory_order_acquire) == expected) return;
+  }
+  // Announce the intent to sleep before the last look at the sequence, so a
+  // store made after that look is guaranteed to be followed by a wake-up.
+  waiters.fetch_add(1, std::memory_order_seq_cst);
+  std::size_t current;
+  while ((current = sequence.load(std::memory_order_seq_cst)) != expected) {
+    sequence.wait(current, std::memory_order_seq_cst);
+  }
+  waiters.fetch_sub(1, std::memory_order_relaxed);
+}
+
+}  // namespace internal
+
+/*
+    A bounded lock-free queue for any number of producer and consumer
+   threads.
+
+    Template Parameters:
+        - T: The type of the elements.
+        - Allocator: The allocator for the slots; it is rebound to allocate
+   the slots together with their sequence numbers.
+
+    This is Dmitry Vyukov's bounded MPMC queue. Every slot carries a
+   sequence number: slot i is free for the producer of position p when its
+   sequence is p, and holds the element of position p for a consumer when
+   its sequence is p + 1. A producer claims a position with a single
+   compare-and-swap on the enqueue index and then owns its slot outright, so
+   producers only contend on that one counter (consumers likewise on the
+   dequeue index) and never on each other's slots. The two indices sit on
+   separate cache lines.
+
+    The try_* functions never block: they fail when the queue is full (or
+   empty). push() and pop() instead claim a position unconditionally and
+   wait on that slot's sequence number, spinning briefly and then sleeping,
+   so a waiting thread costs no CPU. The two kinds may be mixed freely.
+
+    The bulk functions claim a run of consecutive positions with one atomic
+   operation, so a batch of n elements costs one contended update instead of
+   n. The capacity is rounded up to a power of two.
+*/
+template <typename T, typename Allocator = allocator<T>>
+class mpmc_queue {
+ public:
+  using value_type = T;
+  using size_type = std::size_t;
+  using allocator_type = Allocator;
+
+  // Constructor taking the minimum capacity
+  explicit mpmc_queue(size_type capacity)
+      : m_enqueue(0),
+        m_dequeue(0),
+        m_waiters(0),
+        m_mask(std::bit_ceil(capacity < 2 ? 2 : capacity) - 1),
+        m_cells(nullptr) {
+    cell_allocator alloc;
+    m_cells = alloc.allocate(m_mask + 1);
+    for (size_type i = 0; i <= m_mask; i++) {
+      m_cells[i].sequence.store(i, std::memory_order_relaxed);
+    }
+  }
+
+  mpmc_queue(const mpmc_queue &) = delete;
+  mpmc_queue &operator=(const mpmc_queue &) = delete;
+
+  // Destructor
+  ~mpmc_queue() {
+    cell_allocator alloc;
+    alloc.deallocate(m_cells);
+  }
+
+  // Returns the maximum number of elements
+  size_type capacity() const { return m_mask + 1; }
+
+  // Returns the number of elements at some instant during the call. While
+  // blocked push() or pop() calls are pending the value is clamped to
+  // [0, capacity()].
+  size_type size() const {
+    size_type dequeue = m_dequeue.load(std::memory_order_acquire);
+    size_type enqueue = m_enqueue.load(std::memory_order_acquire);
+    if (enqueue <= dequeue) return 0;
+    return enqueue - dequeue > m_mask ? m_mask + 1 : enqueue - dequeue;
+  }
+
+  // Checks whether the queue was empty at some instant during the call.
+  bool empty() const { return size() == 0; }
+
+  // Appends a copy of `value`. Returns false if the queue is full.
+  bool try_push(const value_type &value) { return try_push_n(&value, 1) == 1; }
+
+  // Appends `value` by moving it. Returns false, leaving `value` untouched,
+  // if the queue is full.
+  bool try_push(value_type &&value) {
+    size_type position;
+    if (claim(m_enqueue, 0, 1, position) == 0) return false;
+    publish(position, move(value));
+    return true;
+  }
+
+  // Constructs an element from `args` and appends it. Returns false if the
+  // queue is full, in which case nothing is constructed.
+  template <typename... Args>
+  bool try_emplace(Args &&...args) {
+    size_type position;
+    if (claim(m_enqueue, 0, 1, position) == 0) return false;
+    publish(position, value_type(open_stl::forward<Args>(args)...));
+    return true;
+  }
+
+  /*
+      Appends up to `count` values from `source` as one run.
+
+      Returns:
+          - The number of values appended: the longest prefix of the batch
+     for which consecutive slots were free.
+  */
+  size_type try_push_n(const value_type *source, size_type count) {
+    size_type position;
+    size_type claimed = claim(m_enqueue, 0, count, position);
+    for (size_type i = 0; i < claimed; i++) {
+      publish(position + i, source[i]);
+    }
+    return claimed;
+  }
+
+  // Appends a copy of `value`, waiting for a free slot if the queue is full.
+  void push(const value_type &value) {
+    size_type position = m_enqueue.fetch_add(1, std::memory_order_relaxed);
+    wait(position, position);
+    publish(position, value);
+  }
+
+  // Appends `value` by moving it, waiting for a free slot if the queue is
+  // full.
+  void push(value_type &&value) {
+    size_type position = m_enqueue.fetch_add(1, std::memory_order_relaxed);
+    wait(position, position);
+    publish(position, move(value));
+  }
+
+  // Appends all `count` values from `source` as one run, waiting for free
+  // slots as needed.
+  void push_n(const value_type *source, size_type count) {
+    size_type position = m_enqueue.fetch_add(count, std::memory_order_relaxed);
+    for (size_type i = 0; i < count; i++) {
+      wait(position + i, position + i);
+      publish(position + i, source[i]);
+    }
+  }
+
+  // Moves the first element into `value`. Returns false, leaving `value`
+  // untouched, if the queue is empty.
+  bool try_pop(value_type &value) { return try_pop_n(&value, 1) == 1; }
+
+  /*
+      Moves up to `count` elements from the front into `destination`.
+
+      Returns:
+          - The number of elements removed: the longest run of consecutive
+     positions whose elements were already published.
+  */
+  size_type try_pop_n(value_type *destination, size_type count) {
+    size_type position;
+    size_type claimed = claim(m_dequeue, 1, count, position);
+    for (size_type i = 0; i < claimed; i++) {
+      destination[i] = consume(position + i);
+    }
+    return claimed;
+  }
+
+  // Removes and returns the first element, waiting for one if the queue is
+  // empty.
+  value_type pop() {
+    size_type position = m_dequeue.fetch_add(1, std::memory_order_relaxed);
+    wait(position, position + 1);
+    return consume(position);
+  }
+
+  // Moves `count` elements into `destination`, waiting for each to be
+  // published.
+  void pop_n(value_type *destination, size_type count) {
+    size_type position = m_dequeue.fetch_add(count, std::memory_order_relaxed);
+    for (size_type i = 0; i < count; i++) {
+      wait(position + i, position + i + 1);
+      destination[i] = consume(position + i);
+    }
+  }
+
+ private:
+  using cell_type = internal::mpmc_cell<T>;
+  using cell_allocator =
+      typename Allocator::template rebind<cell_type>::other;
+
+  alignas(internal::cache_line_size) std::atomic<size_type> m_enqueue;
+  alignas(internal::cache_line_size) std::atomic<size_type> m_dequeue;
+  // The number of blocked push() and pop() calls asleep on a slot.
+  alignas(internal::cache_line_size) std::atomic<size_type> m_waiters;
+  alignas(internal::cache_line_size) size_type m_mask;
+  cell_type *m_cells;
+
+  cell_type &cell(size_type position) { return m_cells[position & m_mask]; }
+
+  // Waits until the slot of `position` holds the sequence `expected`.
+  void wait(size_type position, size_type expected) {
+    internal::wait_for_sequence(cell(position).sequence, expected, m_waiters);
+  }
+
+  // Wakes the threads sleeping on `slot` after its sequence was stored. The
+  // fence orders that store before the look at m_waiters, so a non-blocking
+  // caller with no sleeper anywhere makes no system call.
+  void wake(cell_type &slot) {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (m_waiters.load(std::memory_order_relaxed) != 0) {
+      slot.sequence.notify_all();
+    }
+  }
+
+  /*
+      Claims up to `count` consecutive positions from `index` without
+     waiting.
+
+      Parameters:
+          - index: m_enqueue or m_dequeue.
+          - lag: 0 for producers, which need a slot whose sequence equals the
+     position, and 1 for consumers, which need position + 1.
+          - count: The most positions to claim.
+          - position: Receives the first claimed position.
+
+      Returns:
+          - The number of positions claimed, 0 if the first one is not ready
+     or `count` is 0.
+  */
+  size_type claim(std::atomic<size_type> &index, size_type lag,
+                  size_type count, size_type &position) {
+    if (count == 0) return 0;
+    position = index.load(std::memory_order_relaxed);
+    while (true) {
+      size_type ready = 0;
+      while (ready < count && ready <= m_mask) {
+        size_type sequence =
+            cell(position + ready).sequence.load(std::memory_order_acquire);
+        if (sequence != position + ready + lag) break;
+        ready++;
+      }
+      if (ready == 0) {
+        // The slot belongs to an earlier round, so the queue is full (or
+        // empty), unless the index moved on while it was read.
+        size_type sequence =
+            cell(position).sequence.load(std::memory_order_acquire);
+        if (std::ptrdiff_t(sequence - (position + lag)) < 0) return 0;
+        position = index.load(std::memory_order_relaxed);
+        continue;
+      }
+      // Only the owner of a position changes its slot's sequence, so the
+      // slots checked above stay ready until someone claims them here.
+      if (index.compare_exchange_weak(position, position + ready,
+                                      std::memory_order_relaxed)) {
+        return ready;
+      }
+    }
+  }
+
+  // Stores the element of a claimed enqueue position and hands the slot to
+  // its consumer.
+  template <typename U>
+  void publish(size_type position, U &&value) {
+    cell_type &slot = cell(position);
+    slot.value = open_stl::forward<U>(value);
+    slot.sequence.store(position + 1, std::memory_order_release);
+    wake(slot);
+  }
+
+  // Takes the element of a claimed dequeue position and hands the slot to
+  // the producer of the next round.
+  value_type consume(size_type position) {
+    cell_type &slot = cell(position);
+    value_type value = move(slot.value);
+    slot.sequence.store(position + m_mask + 1, std::memory_order_release);
+    wake(slot);
+    return value;
+  }
+};
+}  // namespace open_stl
+
+#endif  // OPEN_STL_MPMC_QUEUE_H_
@@ -0,0 +1,597 @@
+#ifndef OPEN_STL_NUMERIC_H_
+#define OPEN_STL_NUMERIC_H_
+
+#include <OpenSTL/execution.h>
+#include <OpenSTL/functional.h>
+#include <OpenSTL/internal/iterator.h>
+#include <OpenSTL/internal/parallel.h>
+#include <OpenSTL/type_traits.h>
+#include <OpenSTL/vector.h>
+
+#include <cstddef>
+
+namespace open_stl {
+namespace internal {
+
+// True when an algorithm called with ExecutionPolicy over Iterator may split
+// its range across threads. Anything other than a random-access range under
+// the parallel policy runs sequentially.
+template <typename ExecutionPolicy, typename Iterator>
+inline constexpr bool use_parallel_v =
+    is_same<remove_cvref_t<ExecutionPolicy>,
+            execution::parallel_policy>::value &&
+    is_random_access_iterator<Iterator>::value;
+
+/*
+    Folds `count` (at least one) values produced by `load` with `op`.
+
+    Template Parameters:
+        - T: The accumulator type.
+        - Load: A callable mapping an index in [0, count) to a value.
+        - BinaryOperation: An associative and commutative operation.
+
+    The loop keeps four independent accumulators so consecutive iterations do
+   not wait on each other, which lets the compiler keep them in vector
+   registers. This reorders the operands, so it is only used where the
+   standard allows reordering (reduce and transform_reduce).
+*/
+template <typename T, typename Load, typename BinaryOperation>
+T reduce_indexed(std::size_t count, Load load, BinaryOperation op) {
+  if (count < 8) {
+    T acc = load(0);
+    for (std::size_t i = 1; i < count; i++) {
+      acc = op(acc, load(i));
+    }
+    return acc;
+  }
+  T acc0 = load(0);
+  T acc1 = load(1);
+  T acc2 = load(2);
+  T acc3 = load(3);
+  std::size_t i = 4;
+  for (; i + 4 <= count; i += 4) {
+    acc0 = op(acc0, load(i));
+    acc1 = op(acc1, load(i + 1));
+    acc2 = op(acc2, load(i + 2));
+    acc3 = op(acc3, load(i + 3));
+  }
+  for (; i < count; i++) {
+    acc0 = op(acc0, load(i));
+  }
+  return op(op(acc0, acc1), op(acc2, acc3));
+}
+
+// Sequential reduction of `count` loaded values into `init`.
+template <typename T, typename Load, typename BinaryOperation>
+T reduce_indexed(T init, std::size_t count, Load load, BinaryOperation op) {
+  if (count == 0) return init;
+  return op(init, reduce_indexed<T>(count, load, op));
+}
+
+/*
+    Parallel reduction of `count` loaded values into `init`.
+
+    The range is split into blocks, each block is folded on its own thread
+   with reduce_indexed, and the per-block results are folded into `init` on
+   the calling thread.
+*/
+template <typename T, typename Load, typename BinaryOperation>
+T parallel_reduce_indexed(T init, std::size_t count, Load load,
+                          BinaryOperation op) {
+  std::size_t blocks = parallel_block_count(count);
+  if (blocks == 1) return reduce_indexed<T>(init, count, load, op);
+  vector<T> partials(blocks);
+  parallel_blocks(blocks, [&](std::size_t block) {
+    std::size_t begin = block_begin(block, blocks, count);
+    std::size_t end = block_begin(block + 1, blocks, count);
+    partials[block] = reduce_indexed<T>(
+        end - begin, [&](std::size_t i) { return load(begin + i); }, op);
+  });
+  for (const T &partial : partials) {
+    init = op(init, partial);
+  }
+  return init;
+}
+
+/*
+    Two-pass blocked prefix scan.
+
+    Template Parameters:
+        - T: The accumulator type.
+        - RandomIterator: The input iterator type.
+        - OutputIterator: The random-access output iterator type.
+        - BinaryOperation: An associative operation.
+
+    Parameters:
+        - first, count: The input range.
+        - d_first: The beginning of the output range; may equal `first`.
+        - op: The scan operation.
+        - init: The initial value, used when `has_init` is true.
+        - has_init: Whether `init` seeds the scan.
+        - inclusive: Whether element i of the output includes input i.
+
+    The first pass folds every block on its own thread. The block totals are
+   then scanned on the calling thread to get each block's carry-in, and the
+   second pass scans every block again starting from its carry-in. Operands
+   are combined strictly left to right, so `op` need not be commutative.
+*/
+template <typename T, typename RandomIterator, typename OutputIterator,
+          typename BinaryOperation>
+OutputIterator parallel_scan(RandomIterator first, std::size_t count,
+                             OutputIterator d_first, BinaryOperation op,
+                             T init, bool has_init, bool inclusive) {
+  std::size_t blocks = parallel_block_count(count);
+  vector<T> carries(blocks);
+  if (blocks > 1) {
+    vector<T> sums(blocks);
+    parallel_blocks(blocks - 1, [&](std::size_t block) {
+      std::size_t begin = block_begin(block, blocks, count);
+      std::size_t end = block_begin(block + 1, blocks, count);
+      T acc = first[begin];
+      for (std::size_t i = begin + 1; i < end; i++) {
+        acc = op(acc, first[i]);
+      }
+      sums[block] = acc;
+    });
+    carries[1] = has_init ? op(init, sums[0]) : sums[0];
+    for (std::size_t block = 2; block < blocks; block++) {
+      carries[block] = op(carries[block - 1], sums[block - 1]);
+    }
+  }
+  if (has_init) carries[0] = init;
+  parallel_blocks(blocks, [&](std::size_t block) {
+    std::size_t begin = block_begin(block, blocks, count);
+    std::size_t end = block_begin(block + 1, blocks, count);
+    if (begin == end) return;
+    if (inclusive) {
+      T acc = block == 0 && !has_init ? T(first[begin])
+                                      : T(op(carries[block], first[begin]));
+      d_first[begin] = acc;
+      for (std::size_t i = begin + 1; i < end; i++) {
+        acc = op(acc, first[i]);
+        d_first[i] = acc;
+      }
+    } else {
+      T acc = carries[block];
+      for (std::size_t i = begin; i < end; i++) {
+        T value = first[i];
+        d_first[i] = acc;
+        acc = op(acc, value);
+      }
+    }
+  });
+  return d_first + count;
+}
+
+}  // namespace internal
+
+/*
+    Reduces a range with a binary operation, in unspecified order.
+
+    Template Parameters:
+        - InputIterator: The type of iterator for the input range.
+        - T: The type of the initial value and of the result.
+        - BinaryOperation: The reduction operation.
+
+    Parameters:
+        - first: The beginning of the range.
+        - last: The end of the range.
+        - init: The initial value of the reduction.
+        - op: The reduction operation.
+
+    Returns:
+        - The generalized sum of `init` and every element of the range.
+
+    Unlike a left fold, the elements may be grouped and reordered, so `op`
+   must be associative and commutative. For random-access ranges the fold runs
+   with four independent accumulators, which the compiler can vectorize.
+*/
+template <typename InputIterator, typename T, typename BinaryOperation>
+T reduce(InputIterator first, InputIterator last, T init,
+         BinaryOperation op) {
+  if constexpr (internal::is_random_access_iterator<InputIterator>::value) {
+    return internal::reduce_indexed<T>(
+        init, last - first, [first](std::size_t i) { return first[i]; }, op);
+  } else {
+    for (; first != last; ++first) {
+      init = op(init, *first);
+    }
+    return init;
+  }
+}
+
+// Reduces a range into `init` with addition.
+template <typename InputIterator, typename T>
+T reduce(InputIterator first, InputIterator last, T init) {
+  return open_stl::reduce(first, last, init, plus<>());
+}
+
+// Reduces a range with addition, starting from a value-initialized element.
+template <typename InputIterator>
+remove_cvref_t<decltype(*InputIterator())> reduce(InputIterator first,
+                                                  InputIterator last) {
+  return open_stl::reduce(first, last, remove_cvref_t<decltype(*first)>(),
+                          plus<>());
+}
+
+/*
+    Reduces a range with a binary operation under an execution policy.
+
+    Template Parameters:
+        - ExecutionPolicy: execution::sequenced_policy or
+   execution::parallel_policy.
+        - ForwardIterator: The type of iterator for the input range.
+        - T: The type of the initial value and of the result.
+        - BinaryOperation: The reduction operation.
+
+    Returns:
+        - The generalized sum of `init` and every element of the range.
+
+    With the parallel policy and a random-access range, every thread reduces
+   one contiguous block and the block results are combined at the end.
+*/
+template <typename ExecutionPolicy, typename ForwardIterator, typename T,
+          typename BinaryOperation>
+  requires execution::is_execution_policy_v<ExecutionPolicy>
+T reduce(ExecutionPolicy &&, ForwardIterator first, ForwardIterator last,
+         T init, BinaryOperation op) {
+  if constexpr (internal::use_parallel_v<ExecutionPolicy, ForwardIterator>) {
+    return internal::parallel_reduce_indexed<T>(
+        init, last - first, [first](std::size_t i) { return first[i]; }, op);
+  } else {
+    return open_stl::reduce(first, last, init, op);
+  }
+}
+
+// Reduces a range into `init` with addition under an execution policy.
+template <typename ExecutionPolicy, typename ForwardIterator, typename T>
+  requires execution::is_execution_policy_v<ExecutionPolicy>
+T reduce(ExecutionPolicy &&policy, ForwardIterator first, ForwardIterator last,
+         T init) {
+  return open_stl::reduce(policy, first, last, init, plus<>());
+}
+
+// Reduces a range with addition under an execution policy.
+template <typename ExecutionPolicy, typename ForwardIterator>
+  requires execution::is_execution_policy_v<ExecutionPolicy>
+remove_cvref_t<decltype(*ForwardIterator())> reduce(ExecutionPolicy &&policy,
+                                                    ForwardIterator first,
+                                                    ForwardIterator last) {
+  return open_stl::reduce(policy, first, last,
+                          remove_cvref_t<decltype(*first)>(), plus<>());
+}
+
+/*
+    Transforms every element of a range and reduces the results.
+
+    Template Parameters:
+        - InputIterator: The type of iterator for the input range.
+        - T: The type of the initial value and of the result.
+        - BinaryOperation: The reduction operation.
+        - UnaryOperation: The transformation applied to each element.
+
+    Parameters:
+        - first: The beginning of the range.
+        - last: The end of the range.
+        - init: The initial value of the reduction.
+        - reduce_op: The reduction operation.
+        - transform_op: The transformation applied to each element.
+
+    Returns:
+        - The generalized sum of `init` and `transform_op(x)` for every
+   element x of the range.
+
+    The transformed values are never stored; they are folded as soon as they
+   are produced, with the same unrolling as reduce.
+*/
+template <typename InputIterator, typename T, typename BinaryOperation,
+          typename UnaryOperation>
+T transform_reduce(InputIterator first, InputIterator last, T init,
+                   BinaryOperation reduce_op, UnaryOperation transform_op) {
+  if constexpr (internal::is_random_access_iterator<InputIterator>::value) {
+    return internal::reduce_indexed<T>(
+        init, last - first,
+        [first, &transform_op](std::size_t i) {
+          return transform_op(first[i]);
+        },
+        reduce_op);
+  } else {
+    for (; first != last; ++first) {
+      init = reduce_op(init, transform_op(*first));
+    }
+    return init;
+  }
+}
+
+/*
+    Combines two ranges element-wise and reduces the results.
+
+    Template Parameters:
+        - InputIterator1: The type of iterator for the first range.
+        - InputIterator2: The type of iterator for the second range.
+        - T: The type of the initial value and of the result.
+        - BinaryOperation1: The reduction operation.
+        - BinaryOperation2: The operation combining a pair of elements.
+
+    Parameters:
+        - first1: The beginning of the first range.
+        - last1: The end of the first range.
+        - first2: The beginning of the second range, at least as long as the
+   first.
+        - init: The initial value of the reduction.
+        - reduce_op: The reduction operation.
+        - transform_op: The operation combining a pair of elements.
+
+    Returns:
+        - The generalized sum of `init` and `transform_op(a, b)` for every
+   pair of corresponding elements.
+*/
+template <typename InputIterator1, typename InputIterator2, typename T,
+          typename BinaryOperation1, typename BinaryOperation2>
+T transform_reduce(InputIterator1 first1, InputIterator1 last1,
+                   InputIterator2 first2, T init, BinaryOperation1 reduce_op,
+                   BinaryOperation2 transform_op) {
+  if constexpr (internal::is_random_access_iterator<InputIterator1>::value &&
+                internal::is_random_access_iterator<InputIterator2>::value) {
+    return internal::reduce_indexed<T>(
+        init, last1 - first1,
+        [first1, first2, &transform_op](std::size_t i) {
+          return transform_op(first1[i], first2[i]);
+        },
+        reduce_op);
+  } else {
+    for (; first1 != last1; ++first1, ++first2) {
+      init = reduce_op(init, transform_op(*first1, *first2));
+    }
+    return init;
+  }
+}
+
+// Computes the inner product of two ranges, starting from `init`.
+template <typename InputIterator1, typename InputIterator2, typename T>
+T transform_reduce(InputIterator1 first1, InputIterator1 last1,
+                   InputIterator2 first2, T init) {
+  return open_stl::transform_reduce(first1, last1, first2, init, plus<>(),
+                                    multiplies<>());
+}
+
+// Transforms and reduces a range under an execution policy.
+template <typename ExecutionPolicy, typename ForwardIterator, typename T,
+          typename BinaryOperation, typename UnaryOperation>
+  requires execution::is_execution_policy_v<ExecutionPolicy>
+T transform_reduce(ExecutionPolicy &&, ForwardIterator first,
+                   ForwardIterator last, T init, BinaryOperation reduce_op,
+                   UnaryOperation transform_op) {
+  if constexpr (internal::use_parallel_v<ExecutionPolicy, ForwardIterator>) {
+    return internal::parallel_reduce_indexed<T>(
+        init, last - first,
+        [first, &transform_op](std::size_t i) {
+          return transform_op(first[i]);
+        },
+        reduce_op);
+  } else {
+    return open_stl::transform_reduce(first, last, init, reduce_op,
+                                      transform_op);
+  }
+}
+
+// Combines two ranges element-wise and reduces them under an execution policy.
+template <typename ExecutionPolicy, typename ForwardIterator1,
+          typename ForwardIterator2, typename T, typename BinaryOperation1,
+          typename BinaryOperation2>
+  requires execution::is_execution_policy_v<ExecutionPolicy>
+T transform_reduce(ExecutionPolicy &&, ForwardIterator1 first1,
+                   ForwardIterator1 last1, ForwardIterator2 first2, T init,
+                   BinaryOperation1 reduce_op,
+                   BinaryOperation2 transform_op) {
+  if constexpr (internal::use_parallel_v<ExecutionPolicy, ForwardIterator1> &&
+                internal::is_random_access_iterator<ForwardIterator2>::value) {
+    return internal::parallel_reduce_indexed<T>(
+        init, last1 - first1,
+        [first1, first2, &transform_op](std::size_t i) {
+          return transform_op(first1[i], first2[i]);
+        },
+        reduce_op);
+  } else {
+    return open_stl::transform_reduce(first1, last1, first2, init, reduce_op,
+                                      transform_op);
+  }
+}
+
+// Computes the inner product of two ranges under an execution policy.
+template <typename ExecutionPolicy, typename ForwardIterator1,
+          typename ForwardIterator2, typename T>
+  requires execution::is_execution_policy_v<ExecutionPolicy>
+T transform_reduce(ExecutionPolicy &&policy, ForwardIterator1 first1,
+                   ForwardIterator1 last1, ForwardIterator2 first2, T init) {
+  return open_stl::transform_reduce(policy, first1, last1, first2, init,
+                                    plus<>(), multiplies<>());
+}
+
+/*
+    Computes an inclusive prefix scan of a range, seeded with `init`.
+
+    Template Parameters:
+        - InputIterator: The type of iterator for the input range.
+        - OutputIterator: The type of iterator for the output range.
+        - BinaryOperation: The scan operation.
+        - T: The type of the initial value and of the running total.
+
+    Parameters:
+        - first: The beginning of the input range.
+        - last: The end of the input range.
+        - d_first: The beginning of the output range; may equal `first`.
+        - op: The scan operation, which must be associative.
+        - init: The value every output element starts from.
+
+    Returns:
+        - An iterator past the last element written.
+
+    Output element i is `init op x0 op ... op xi`. The running total is kept
+   in a local variable rather than re-read from the output.
+*/
+template <typename InputIterator, typename OutputIterator,
+          typename BinaryOperation, typename T>
+OutputIterator inclusive_scan(InputIterator first, InputIterator last,
+                              OutputIterator d_first, BinaryOperation op,
+                              T init) {
+  for (; first != last; ++first, ++d_first) {
+    init = op(init, *first);
+    *d_first = init;
+  }
+  return d_first;
+}
+
+// Computes an inclusive prefix scan of a range with `op`.
+template <typename InputIterator, typename OutputIterator,
+          typename BinaryOperation>
+OutputIterator inclusive_scan(InputIterator first, InputIterator last,
+                              OutputIterator d_first, BinaryOperation op) {
+  if (first == last) return d_first;
+  remove_cvref_t<decltype(*first)> acc = *first;
+  *d_first = acc;
+  return open_stl::inclusive_scan(++first, last, ++d_first, op, acc);
+}
+
+// Computes an inclusive prefix sum of a range.
+template <typename InputIterator, typename OutputIterator>
+OutputIterator inclusive_scan(InputIterator first, InputIterator last,
+                              OutputIterator d_first) {
+  return open_stl::inclusive_scan(first, last, d_first, plus<>());
+}
+
+/*
+    Computes an inclusive prefix scan of a range under an execution policy.
+
+    Template Parameters:
+        - ExecutionPolicy: execution::sequenced_policy or
+   execution::parallel_policy.
+        - ForwardIterator1: The type of iterator for the input range.
+        - ForwardIterator2: The type of iterator for the output range.
+        - BinaryOperation: The scan operation, which must be associative.
+        - T: The type of the initial value and of the running total.
+
+    Returns:
+        - An iterator past the last element written.
+
+    With the parallel policy and random-access ranges, the scan runs in two
+   passes over contiguous blocks: the first pass computes every block's total,
+   the second rescans each block starting from the combined totals of the
+   blocks before it.
+*/
+template <typename ExecutionPolicy, typename ForwardIterator1,
+          typename ForwardIterator2, typename BinaryOperation, typename T>
+  requires execution::is_execution_policy_v<ExecutionPolicy>
+ForwardIterator2 inclusive_scan(ExecutionPolicy &&policy,
+                                ForwardIterator1 first, ForwardIterator1 last,
+                                ForwardIterator2 d_first, BinaryOperation op,
+                                T init) {
+  if constexpr (internal::use_parallel_v<ExecutionPolicy, ForwardIterator1> &&
+                internal::is_random_access_iterator<ForwardIterator2>::value) {
+    return internal::parallel_scan<T>(first, last - first, d_first, op, init,
+                                      true, true);
+  } else {
+    return open_stl::inclusive_scan(first, last, d_first, op, init);
+  }
+}
+
+// Computes an inclusive prefix scan of a range with `op` under an execution
+// policy.
+template <typename ExecutionPolicy, typename ForwardIterator1,
+          typename ForwardIterator2, typename BinaryOperation>
+  requires execution::is_execution_policy_v<ExecutionPolicy>
+ForwardIterator2 inclusive_scan(ExecutionPolicy &&, ForwardIterator1 first,
+                                ForwardIterator1 last, ForwardIterator2 d_first,
+                                BinaryOperation op) {
+  if constexpr (internal::use_parallel_v<ExecutionPolicy, ForwardIterator1> &&
+                internal::is_random_access_iterator<ForwardIterator2>::value) {
+    return internal::parallel_scan<remove_cvref_t<decltype(*first)>>(
+        first, last - first, d_first, op, {}, false, true);
+  } else {
+    return open_stl::inclusive_scan(first, last, d_first, op);
+  }
+}
+
+// Computes an inclusive prefix sum of a range under an execution policy.
+template <typename ExecutionPolicy, typename ForwardIterator1,
+          typename ForwardIterator2>
+  requires execution::is_execution_policy_v<ExecutionPolicy>
+ForwardIterator2 inclusive_scan(ExecutionPolicy &&policy,
+                                ForwardIterator1 first, ForwardIterator1 last,
+                                ForwardIterator2 d_first) {
+  return open_stl::inclusive_scan(policy, first, last, d_first, plus<>());
+}
+
+/*
+    Computes an exclusive prefix scan of a range.
+
+    Template Parameters:
+        - InputIterator: The type of iterator for the input range.
+        - OutputIterator: The type of iterator for the output range.
+        - T: The type of the initial value and of the running total.
+        - BinaryOperation: The scan operation.
+
+    Parameters:
+        - first: The beginning of the input range.
+        - last: The end of the input range.
+        - d_first: The beginning of the output range; may equal `first`.
+        - init: The value written to the first output element.
+        - op: The scan operation, which must be associative.
+
+    Returns:
+        - An iterator past the last element written.
+
+    Output element i is `init op x0 op ... op x(i-1)`, so element i of the
+   input is not included in output element i. Each input element is read
+   before its output slot is written, which makes the scan safe in place.
+*/
+template <typename InputIterator, typename OutputIterator, typename T,
+          typename BinaryOperation>
+OutputIterator exclusive_scan(InputIterator first, InputIterator last,
+                              OutputIterator d_first, T init,
+                              BinaryOperation op) {
+  for (; first != last; ++first, ++d_first) {
+    T value = *first;
+    *d_first = init;
+    init = op(init, value);
+  }
+  return d_first;
+}
+
+// Computes an exclusive prefix sum of a range, starting from `init`.
+template <typename InputIterator, typename OutputIterator, typename T>
+OutputIterator exclusive_scan(InputIterator first, InputIterator last,
+                              OutputIterator d_first, T init) {
+  return open_stl::exclusive_scan(first, last, d_first, init, plus<>());
+}
+
+// Computes an exclusive prefix scan of a range under an execution policy.
+// The parallel version uses the same two-pass blocked scan as inclusive_scan.
+template <typename ExecutionPolicy, typename ForwardIterator1,
+          typename ForwardIterator2, typename T, typename BinaryOperation>
+  requires execution::is_execution_policy_v<ExecutionPolicy>
+ForwardIterator2 exclusive_scan(ExecutionPolicy &&, ForwardIterator1 first,
+                                ForwardIterator1 last, ForwardIterator2 d_first,
+                                T init, BinaryOperation op) {
+  if constexpr (internal::use_parallel_v<ExecutionPolicy, ForwardIterator1> &&
+                internal::is_random_access_iterator<ForwardIterator2>::value) {
+    return internal::parallel_scan<T>(first, last - first, d_first, op, init,
+                                      true, false);
+  } else {
+    return open_stl::exclusive_scan(first, last, d_first, init, op);
+  }
+}
+
+// Computes an exclusive prefix sum of a range under an execution policy.
+template <typename ExecutionPolicy, typename ForwardIterator1,
+          typename ForwardIterator2, typename T>
+  requires execution::is_execution_policy_v<ExecutionPolicy>
+ForwardIterator2 exclusive_scan(ExecutionPolicy &&policy,
+                                ForwardIterator1 first, ForwardIterator1 last,
+                                ForwardIterator2 d_first, T init) {
+  return open_stl::exclusive_scan(policy, first, last, d_first, init, plus<>());
+}
+
+}  // namespace open_stl
+
+#endif  // OPEN_STL_NUMERIC_H_
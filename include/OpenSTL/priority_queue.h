@@ -0,0 +1,309 @@
+#ifndef OPEN_STL_PRIORITY_QUEUE_H_
+#define OPEN_STL_PRIORITY_QUEUE_H_
+
+#include <OpenSTL/algorithm.h>
+#include <OpenSTL/functional.h>
+#include <OpenSTL/utility.h>
+#include <OpenSTL/vector.h>
+
+#include <cstddef>
+
+namespace open_stl {
+/*
+    A max-priority queue stored as a d-ary heap.
+
+    Template Parameters:
+        - T: The type of the elements.
+        - Container: The random-access container holding the heap.
+        - Compare: The ordering; the element ordered last is on top.
+        - Arity: The number of children of every heap node.
+
+    The first three parameters match std::priority_queue. With four children
+   per node the heap is half as deep as a binary one, and the children a
+   sift-down compares sit next to each other, usually in one cache line. A
+   pop costs a few more comparisons per level but about half as many cache
+   misses, which wins once the heap outgrows the cache. A push only walks up
+   the shorter path and gets cheaper too.
+*/
+template <typename T, typename Container = vector<T>,
+          typename Compare = less<T>, std::size_t Arity = 4>
+class priority_queue {
+  static_assert(Arity >= 2, "A heap node needs at least two children");
+
+  static constexpr std::ptrdiff_t arity = std::ptrdiff_t(Arity);
+
+ public:
+  using container_type = Container;
+  using value_compare = Compare;
+  using value_type = T;
+  using size_type = std::size_t;
+  using reference = T &;
+  using const_reference = const T &;
+
+  // Default constructor
+  priority_queue() : m_heap(), m_comp() {}
+
+  // Constructor taking the ordering
+  explicit priority_queue(const Compare &comp) : m_heap(), m_comp(comp) {}
+
+  // Constructor taking the ordering and initial elements, which are
+  // arranged into a heap in O(n).
+  priority_queue(const Compare &comp, Container elements)
+      : m_heap(move(elements)), m_comp(comp) {
+    internal::make_heap<arity>(m_heap.begin(), m_heap.end(), m_comp);
+  }
+
+  // Constructor taking a range of initial elements, heapified in O(n).
+  template <typename InputIterator>
+  priority_queue(InputIterator first, InputIterator last,
+                 const Compare &comp = Compare())
+      : m_heap(), m_comp(comp) {
+    for (; first != last; ++first) {
+      m_heap.push_back(*first);
+    }
+    internal::make_heap<arity>(m_heap.begin(), m_heap.end(), m_comp);
+  }
+
+  // Returns the element on top, which the queue must hold
+  const_reference top() const { return m_heap.front(); }
+
+  // Checks whether the queue is empty
+  bool empty() const { return m_heap.empty(); }
+
+  // Returns the number of elements
+  size_type size() const { return m_heap.size(); }
+
+  // Adds a copy of `value`, in O(log n).
+  void push(const value_type &value) {
+    m_heap.push_back(value);
+    internal::sift_up<arity>(m_heap.begin(), m_heap.size() - 1, m_comp);
+  }
+
+  // Adds `value` by moving it, in O(log n).
+  void push(value_type &&value) {
+    m_heap.push_back(move(value));
+    internal::sift_up<arity>(m_heap.begin(), m_heap.size() - 1, m_comp);
+  }
+
+  // Constructs an element from `args` and adds it, in O(log n).
+  template <typename... Args>
+  void emplace(Args &&...args) {
+    push(value_type(open_stl::forward<Args>(args)...));
+  }
+
+  // Removes the element on top, which the queue must hold, in O(log n).
+  void pop() {
+    if (m_heap.size() > 1) m_heap.front() = move(m_heap.back());
+    m_heap.pop_back();
+    if (!m_heap.empty()) {
+      internal::sift_down<arity>(m_heap.begin(), 0, m_heap.size(), m_comp);
+    }
+  }
+
+  // Swaps the contents of two queues.
+  void swap(priority_queue &right) {
+    open_stl::swap(m_heap, right.m_heap);
+    open_stl::swap(m_comp, right.m_comp);
+  }
+
+ private:
+  Container m_heap;
+  Compare m_comp;
+};
+
+namespace internal {
+
+// An element of an indexed_priority_queue's heap. The priority is stored
+// next to its id so that a sift only touches the heap array.
+template <typename T>
+struct indexed_heap_entry {
+  T priority;
+  std::size_t id;
+};
+
+}  // namespace internal
+
+/*
+    A d-ary max-heap of integer ids whose priorities can change in place.
+
+    Template Parameters:
+        - T: The type of the priorities.
+        - Compare: The ordering of priorities; the id whose priority is
+       ordered last is on top.
+        - Arity: The number of children of every heap node.
+
+    Ids are small integers, such as vertex or task numbers: the queue keeps
+   a table from id to heap position, sized by the largest id pushed, so it
+   can find any id in O(1) and then move it up or down in O(log n). This is
+   what Dijkstra's algorithm and schedulers with changing deadlines need;
+   with std::priority_queue they push duplicates and skip stale entries
+   instead.
+
+    For a shortest-path search use Compare = greater<T>, so the smallest
+   distance is on top and decrease_key() lowers a distance.
+*/
+template <typename T, typename Compare = less<T>, std::size_t Arity = 4>
+class indexed_priority_queue {
+  static_assert(Arity >= 2, "A heap node needs at least two children");
+
+  using entry = internal::indexed_heap_entry<T>;
+
+ public:
+  using value_type = T;
+  using value_compare = Compare;
+  using size_type = std::size_t;
+  using const_reference = const T &;
+
+  // Default constructor
+  indexed_priority_queue() : m_heap(), m_position(), m_comp() {}
+
+  // Constructor taking the ordering
+  explicit indexed_priority_queue(const Compare &comp)
+      : m_heap(), m_position(), m_comp(comp) {}
+
+  // Checks whether the queue is empty
+  bool empty() const { return m_heap.empty(); }
+
+  // Returns the number of ids in the queue
+  size_type size() const { return m_heap.size(); }
+
+  // Returns the id on top, which the queue must hold
+  size_type top_id() const { return m_heap.front().id; }
+
+  // Returns the priority of the id on top, which the queue must hold
+  const_reference top() const { return m_heap.front().priority; }
+
+  // Checks whether `id` is in the queue
+  bool contains(size_type id) const {
+    return id < m_position.size() && m_position[id] != 0;
+  }
+
+  // Returns the priority of `id`, which must be in the queue
+  const_reference priority(size_type id) const {
+    return m_heap[m_position[id] - 1].priority;
+  }
+
+  // Adds `id`, which must not be in the queue, with `priority`, in
+  // O(log n).
+  void push(size_type id, const value_type &priority) {
+    if (id >= m_position.capacity()) {
+      // Grow the table geometrically, so pushing ids in increasing order
+      // costs amortized O(1) per id instead of a reallocation each.
+      size_type doubled = 2 * m_position.capacity();
+      m_position.reserve(id + 1 > doubled ? id + 1 : doubled);
+    }
+    if (id >= m_position.size()) m_position.resize(id + 1);
+    m_heap.push_back(entry{priority, id});
+    sift_up(m_heap.size() - 1);
+  }
+
+  // Removes the id on top, which the queue must hold, in O(log n).
+  void pop() { erase_at(0); }
+
+  // Removes `id`, which must be in the queue, in O(log n).
+  void erase(size_type id) { erase_at(m_position[id] - 1); }
+
+  /*
+      Moves `id` towards the top by giving it a priority ordered no earlier
+     than its current one.
+
+      Parameters:
+          - id: An id in the queue.
+          - priority: The new priority. With Compare = greater<T> it must
+         not be greater than the current priority, which is the classic
+         decrease-key.
+
+      Runs in O(log n), sifting up only.
+  */
+  void decrease_key(size_type id, const value_type &priority) {
+    size_type index = m_position[id] - 1;
+    m_heap[index].priority = priority;
+    sift_up(index);
+  }
+
+  // Gives `id`, which must be in the queue, a new priority in either
+  // direction, in O(log n).
+  void update(size_type id, const value_type &priority) {
+    size_type index = m_position[id] - 1;
+    bool raised = m_comp(m_heap[index].priority, priority);
+    m_heap[index].priority = priority;
+    if (raised) {
+      sift_up(index);
+    } else {
+      sift_down(index);
+    }
+  }
+
+  // Removes every id
+  void clear() {
+    for (size_type i = 0; i < m_heap.size(); i++) {
+      m_position[m_heap[i].id] = 0;
+    }
+    m_heap.clear();
+  }
+
+ private:
+  vector<entry> m_heap;
+  // One more than the heap index of every id, or 0 for an absent id, so
+  // that growing the table with value-initialized entries marks new ids
+  // absent.
+  vector<size_type> m_position;
+  Compare m_comp;
+
+  // Stores `value` at heap slot `index` and records its position.
+  void place(size_type index, entry &&value) {
+    m_position[value.id] = index + 1;
+    m_heap[index] = move(value);
+  }
+
+  void sift_up(size_type hole) {
+    entry value = move(m_heap[hole]);
+    while (hole > 0) {
+      size_type parent = (hole - 1) / Arity;
+      if (!m_comp(m_heap[parent].priority, value.priority)) break;
+      place(hole, move(m_heap[parent]));
+      hole = parent;
+    }
+    place(hole, move(value));
+  }
+
+  void sift_down(size_type hole) {
+    size_type length = m_heap.size();
+    entry value = move(m_heap[hole]);
+    while (true) {
+      size_type child = Arity * hole + 1;
+      if (child >= length) break;
+      size_type last_child = child + Arity < length ? child + Arity : length;
+      for (size_type sibling = child + 1; sibling < last_child; sibling++) {
+        if (m_comp(m_heap[child].priority, m_heap[sibling].priority)) {
+          child = sibling;
+        }
+      }
+      if (!m_comp(value.priority, m_heap[child].priority)) break;
+      place(hole, move(m_heap[child]));
+      hole = child;
+    }
+    place(hole, move(value));
+  }
+
+  void erase_at(size_type index) {
+    m_position[m_heap[index].id] = 0;
+    size_type last = m_heap.size() - 1;
+    if (index == last) {
+      m_heap.pop_back();
+      return;
+    }
+    // Fill the hole with the last entry, which may belong above or below it.
+    bool raised = m_comp(m_heap[index].priority, m_heap[last].priority);
+    place(index, move(m_heap[last]));
+    m_heap.pop_back();
+    if (raised) {
+      sift_up(index);
+    } else {
+      sift_down(index);
+    }
+  }
+};
+}  // namespace open_stl
+
+#endif  // OPEN_STL_PRIORITY_QUEUE_H_
@@ -0,0 +1,544 @@
+#ifndef OPEN_STL_RING_BUFFER_H_
+#define OPEN_STL_RING_BUFFER_H_
+
+#include <OpenSTL/array.h>
+#include <OpenSTL/internal/iterator.h>
+#include <OpenSTL/memory.h>
+#include <OpenSTL/type_traits.h>
+#include <OpenSTL/utility.h>
+
+#include <bit>
+#include <cstddef>
+#include <cstring>
+#include <stdexcept>
+
+namespace open_stl {
+namespace internal {
+
+// Copies `count` elements, with one memcpy when T allows it.
+template <typename T>
+void copy_elements(const T *source, std::size_t count, T *destination) {
+  if constexpr (is_trivially_copyable<T>::value) {
+    if (count != 0) std::memcpy(destination, source, count * sizeof(T));
+  } else {
+    for (std::size_t i = 0; i < count; i++) {
+      destination[i] = source[i];
+    }
+  }
+}
+
+// Moves `count` elements, with one memcpy when T allows it.
+template <typename T>
+void move_elements(T *source, std::size_t count, T *destination) {
+  if constexpr (is_trivially_copyable<T>::value) {
+    if (count != 0) std::memcpy(destination, source, count * sizeof(T));
+  } else {
+    for (std::size_t i = 0; i < count; i++) {
+      destination[i] = move(source[i]);
+    }
+  }
+}
+
+/*
+    Random access iterator over a ring buffer, in order from front to back.
+
+    Template Parameters:
+        - T: The element type, const-qualified for const iterators.
+*/
+template <typename T>
+class ring_buffer_iterator {
+ public:
+  using iterator_category = random_access_iterator_tag;
+  using value_type = typename remove_cv<T>::type;
+  using difference_type = std::ptrdiff_t;
+  using pointer = T *;
+  using reference = T &;
+
+  ring_buffer_iterator() : m_slots(nullptr), m_mask(0), m_pos(0) {}
+
+  // `pos` counts from slot 0 without wrapping; the mask is applied on
+  // dereference.
+  ring_buffer_iterator(T *slots, std::size_t mask, std::size_t pos)
+      : m_slots(slots), m_mask(mask), m_pos(pos) {}
+
+  // Converts an iterator to a const iterator.
+  template <typename Other>
+  ring_buffer_iterator(const ring_buffer_iterator<Other> &other)
+      : m_slots(other.m_slots), m_mask(other.m_mask), m_pos(other.m_pos) {}
+
+  reference operator*() const { return m_slots[m_pos & m_mask]; }
+  pointer operator->() const { return &**this; }
+  reference operator[](difference_type off) const { return *(*this + off); }
+
+  ring_buffer_iterator &operator++() {
+    ++m_pos;
+    return *this;
+  }
+
+  ring_buffer_iterator operator++(int) {
+    ring_buffer_iterator it = *this;
+    ++m_pos;
+    return it;
+  }
+
+  ring_buffer_iterator &operator--() {
+    --m_pos;
+    return *this;
+  }
+
+  ring_buffer_iterator operator--(int) {
+    ring_buffer_iterator it = *this;
+    --m_pos;
+    return it;
+  }
+
+  ring_buffer_iterator &operator+=(difference_type off) {
+    m_pos += off;
+    return *this;
+  }
+
+  ring_buffer_iterator &operator-=(difference_type off) {
+    m_pos -= off;
+    return *this;
+  }
+
+  ring_buffer_iterator operator+(difference_type off) const {
+    return ring_buffer_iterator(m_slots, m_mask, m_pos + off);
+  }
+
+  ring_buffer_iterator operator-(difference_type off) const {
+    return ring_buffer_iterator(m_slots, m_mask, m_pos - off);
+  }
+
+  difference_type operator-(const ring_buffer_iterator &right) const {
+    return difference_type(m_pos - right.m_pos);
+  }
+
+  bool operator==(const ring_buffer_iterator &right) const {
+    return m_pos == right.m_pos;
+  }
+  bool operator!=(const ring_buffer_iterator &right) const {
+    return m_pos != right.m_pos;
+  }
+  bool operator<(const ring_buffer_iterator &right) const {
+    return m_pos < right.m_pos;
+  }
+
+ private:
+  template <typename Other>
+  friend class ring_buffer_iterator;
+
+  T *m_slots;
+  std::size_t m_mask;
+  std::size_t m_pos;
+};
+
+// Slot storage of ring_buffer: an array whose size is a power of two.
+template <typename T, std::size_t N>
+class fixed_ring_storage {
+  static_assert(N > 0 && (N & (N - 1)) == 0,
+                "ring_buffer capacity must be a power of two");
+
+ public:
+  T *slots() { return m_slots.data(); }
+  const T *slots() const { return m_slots.data(); }
+  static constexpr std::size_t mask() { return N - 1; }
+  static constexpr std::size_t capacity() { return N; }
+
+ private:
+  array<T, N> m_slots;
+};
+
+// Slot storage of dynamic_ring_buffer: a power-of-two number of slots from
+// the allocator, of which `capacity` are used.
+template <typename T, typename Allocator>
+class dynamic_ring_storage {
+ public:
+  explicit dynamic_ring_storage(std::size_t capacity)
+      : m_slots(nullptr),
+        m_mask(std::bit_ceil(capacity == 0 ? 1 : capacity) - 1),
+        m_capacity(capacity) {
+    Allocator alloc;
+    m_slots = alloc.allocate(m_mask + 1);
+  }
+
+  dynamic_ring_storage(const dynamic_ring_storage &right)
+      : dynamic_ring_storage(right.m_capacity) {
+    copy_elements(right.m_slots, m_mask + 1, m_slots);
+  }
+
+  dynamic_ring_storage(dynamic_ring_storage &&right)
+      : m_slots(right.m_slots),
+        m_mask(right.m_mask),
+        m_capacity(right.m_capacity) {
+    right.m_slots = nullptr;
+    right.m_capacity = 0;
+    right.m_mask = 0;
+  }
+
+  ~dynamic_ring_storage() {
+    Allocator alloc;
+    alloc.deallocate(m_slots);
+  }
+
+  dynamic_ring_storage &operator=(dynamic_ring_storage right) {
+    open_stl::swap(m_slots, right.m_slots);
+    open_stl::swap(m_mask, right.m_mask);
+    open_stl::swap(m_capacity, right.m_capacity);
+    return *this;
+  }
+
+  T *slots() { return m_slots; }
+  const T *slots() const { return m_slots; }
+  std::size_t mask() const { return m_mask; }
+  std::size_t capacity() const { return m_capacity; }
+
+ private:
+  T *m_slots;
+  std::size_t m_mask;
+  std::size_t m_capacity;
+};
+
+/*
+    The ring buffer logic shared by ring_buffer and dynamic_ring_buffer.
+
+    Template Parameters:
+        - T: The type of the elements.
+        - Storage: Provides `slots()`, a power-of-two slot count minus one as
+   `mask()`, and the usable `capacity()`.
+
+    The elements occupy slots head, head + 1, ... modulo the slot count, so
+   every index is reduced with a mask instead of a division. When the live
+   range wraps around the end of the slots it is two contiguous spans, which
+   first_span() and second_span() expose for bulk copies.
+*/
+template <typename T, typename Storage>
+class basic_ring_buffer {
+ public:
+  using value_type = T;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference = T &;
+  using const_reference = const T &;
+  using pointer = T *;
+  using const_pointer = const T *;
+  using iterator = ring_buffer_iterator<T>;
+  using const_iterator = ring_buffer_iterator<const T>;
+
+  // Returns the maximum number of elements
+  size_type capacity() const { return m_storage.capacity(); }
+
+  // Returns the number of elements
+  size_type size() const { return m_size; }
+
+  // Checks whether the buffer is empty
+  bool empty() const { return m_size == 0; }
+
+  // Checks whether the buffer holds capacity() elements
+  bool full() const { return m_size == capacity(); }
+
+  // Returns a reference to the element `off` places from the front
+  reference operator[](size_type off) {
+    return m_storage.slots()[(m_head + off) & m_storage.mask()];
+  }
+
+  // Returns a const reference to the element `off` places from the front
+  const_reference operator[](size_type off) const {
+    return m_storage.slots()[(m_head + off) & m_storage.mask()];
+  }
+
+  // Returns a reference to the element `off` places from the front; throws
+  // std::out_of_range if `off` is not less than size().
+  reference at(size_type off) {
+    check_index(off);
+    return (*this)[off];
+  }
+
+  // Returns a const reference to the element `off` places from the front;
+  // throws std::out_of_range if `off` is not less than size().
+  const_reference at(size_type off) const {
+    check_index(off);
+    return (*this)[off];
+  }
+
+  // Returns a reference to the first element
+  reference front() { return (*this)[0]; }
+
+  // Returns a const reference to the first element
+  const_reference front() const { return (*this)[0]; }
+
+  // Returns a reference to the last element
+  reference back() { return (*this)[m_size - 1]; }
+
+  // Returns a const reference to the last element
+  const_reference back() const { return (*this)[m_size - 1]; }
+
+  // Returns an iterator to the first element
+  iterator begin() {
+    return iterator(m_storage.slots(), m_storage.mask(), m_head);
+  }
+
+  // Returns a const iterator to the first element
+  const_iterator begin() const {
+    return const_iterator(m_storage.slots(), m_storage.mask(), m_head);
+  }
+
+  // Returns an iterator past the last element
+  iterator end() { return begin() + m_size; }
+
+  // Returns a const iterator past the last element
+  const_iterator end() const { return begin() + m_size; }
+
+  // Appends `value`. Returns false, leaving the buffer unchanged, if it is
+  // full.
+  bool push_back(const_reference value) {
+    if (full()) return false;
+    (*this)[m_size] = value;
+    m_size++;
+    return true;
+  }
+
+  // Prepends `value`. Returns false, leaving the buffer unchanged, if it is
+  // full.
+  bool push_front(const_reference value) {
+    if (full()) return false;
+    m_head = (m_head - 1) & m_storage.mask();
+    m_size++;
+    front() = value;
+    return true;
+  }
+
+  // Appends `value`, dropping the front element first if the buffer is full.
+  // This is the sliding-window mode: the buffer keeps the latest capacity()
+  // values, so a buffer of capacity 0 drops `value` itself.
+  void push_back_overwrite(const_reference value) {
+    if (capacity() == 0) return;
+    if (full()) pop_front();
+    push_back(value);
+  }
+
+  // Prepends `value`, dropping the back element first if the buffer is full.
+  void push_front_overwrite(const_reference value) {
+    if (capacity() == 0) return;
+    if (full()) pop_back();
+    push_front(value);
+  }
+
+  // Removes the first element.
+  void pop_front() {
+    reset(front());
+    m_head = (m_head + 1) & m_storage.mask();
+    m_size--;
+  }
+
+  // Removes the last element.
+  void pop_back() {
+    reset(back());
+    m_size--;
+  }
+
+  // Removes every element.
+  void clear() {
+    drop_front(m_size);
+    m_head = 0;
+  }
+
+  // Returns the longest run of elements starting at the front that is
+  // contiguous in memory, as a pointer and a length.
+  pair<pointer, size_type> first_span() {
+    return pair<pointer, size_type>(m_storage.slots() + m_head,
+                                    first_span_length());
+  }
+
+  // Const overload of first_span().
+  pair<const_pointer, size_type> first_span() const {
+    return pair<const_pointer, size_type>(m_storage.slots() + m_head,
+                                          first_span_length());
+  }
+
+  // Returns the elements after first_span(), which wrapped around to the
+  // start of the storage. The length is 0 if nothing wrapped.
+  pair<pointer, size_type> second_span() {
+    return pair<pointer, size_type>(m_storage.slots(),
+                                    m_size - first_span_length());
+  }
+
+  // Const overload of second_span().
+  pair<const_pointer, size_type> second_span() const {
+    return pair<const_pointer, size_type>(m_storage.slots(),
+                                          m_size - first_span_length());
+  }
+
+  /*
+      Appends up to `count` values from `source`.
+
+      Returns:
+          - The number of values appended, which is `count` limited to the
+     free space.
+
+      The values are copied with at most two memcpy calls when T is trivially
+     copyable: one up to the end of the storage and one from its start.
+  */
+  size_type push_back_n(const_pointer source, size_type count) {
+    size_type free = capacity() - m_size;
+    if (count > free) count = free;
+    size_type tail = (m_head + m_size) & m_storage.mask();
+    size_type until_end = m_storage.mask() + 1 - tail;
+    size_type first = count < until_end ? count : until_end;
+    copy_elements(source, first, m_storage.slots() + tail);
+    copy_elements(source + first, count - first, m_storage.slots());
+    m_size += count;
+    return count;
+  }
+
+  // Appends all `count` values from `source`, dropping as many front
+  // elements as needed; only the last capacity() values are kept if `count`
+  // exceeds the capacity.
+  void push_back_overwrite_n(const_pointer source, size_type count) {
+    if (count >= capacity()) {
+      clear();
+      push_back_n(source + (count - capacity()), capacity());
+      return;
+    }
+    size_type free = capacity() - m_size;
+    if (count > free) drop_front(count - free);
+    push_back_n(source, count);
+  }
+
+  /*
+      Moves up to `count` elements from the front into `destination`.
+
+      Returns:
+          - The number of elements removed, which is `count` limited to
+     size().
+  */
+  size_type pop_front_n(pointer destination, size_type count) {
+    if (count > m_size) count = m_size;
+    size_type first_length = first_span_length();
+    size_type first = count < first_length ? count : first_length;
+    copy_elements(m_storage.slots() + m_head, first, destination);
+    copy_elements(m_storage.slots(), count - first, destination + first);
+    drop_front(count);
+    return count;
+  }
+
+ protected:
+  template <typename... Args>
+  explicit basic_ring_buffer(Args &&...args)
+      : m_storage(open_stl::forward<Args>(args)...), m_head(0), m_size(0) {}
+
+  basic_ring_buffer(const basic_ring_buffer &right) = default;
+
+  // Move constructor; `right` is left empty.
+  basic_ring_buffer(basic_ring_buffer &&right)
+      : m_storage(move(right.m_storage)),
+        m_head(right.m_head),
+        m_size(right.m_size) {
+    right.m_head = 0;
+    right.m_size = 0;
+  }
+
+  basic_ring_buffer &operator=(const basic_ring_buffer &right) = default;
+
+  // Move assignment operator; `right` is left empty.
+  basic_ring_buffer &operator=(basic_ring_buffer &&right) {
+    if (this != &right) {
+      m_storage = move(right.m_storage);
+      m_head = right.m_head;
+      m_size = right.m_size;
+      right.m_head = 0;
+      right.m_size = 0;
+    }
+    return *this;
+  }
+
+ private:
+  Storage m_storage;
+  size_type m_head;
+  size_type m_size;
+
+  size_type first_span_length() const {
+    size_type until_end = m_storage.mask() + 1 - m_head;
+    return m_size < until_end ? m_size : until_end;
+  }
+
+  // Releases what a removed element holds; trivially copyable elements are
+  // left as they are, since they hold nothing.
+  static void reset(reference slot) {
+    if constexpr (!is_trivially_copyable<T>::value) slot = value_type();
+  }
+
+  // Removes `count` elements from the front without reading them.
+  void drop_front(size_type count) {
+    if constexpr (!is_trivially_copyable<T>::value) {
+      for (size_type i = 0; i < count; i++) {
+        reset((*this)[i]);
+      }
+    }
+    m_head = (m_head + count) & m_storage.mask();
+    m_size -= count;
+  }
+
+  void check_index(size_type off) const {
+    if (off >= m_size) {
+      throw std::out_of_range(
+          "Error: Index out of range in ring_buffer. Please ensure the index "
+          "is within the valid range of elements.");
+    }
+  }
+};
+
+}  // namespace internal
+
+/*
+    A fixed-capacity circular buffer stored in an array.
+
+    Template Parameters:
+        - T: The type of the elements.
+        - N: The capacity; must be a power of two.
+
+    Elements can be pushed and popped at both ends in O(1), and the buffer
+   never allocates: its slots are an open_stl::array<T, N> held inline. The
+   *_overwrite functions turn it into a sliding window over the latest N
+   values. first_span() and second_span() expose the contents as at most two
+   contiguous runs, and push_back_n() and pop_front_n() copy whole runs in
+   and out with memcpy.
+*/
+template <typename T, std::size_t N>
+class ring_buffer
+    : public internal::basic_ring_buffer<T,
+                                         internal::fixed_ring_storage<T, N>> {
+ public:
+  // Default constructor; the buffer is empty.
+  ring_buffer() : internal::basic_ring_buffer<T, storage>() {}
+
+ private:
+  using storage = internal::fixed_ring_storage<T, N>;
+};
+
+/*
+    A circular buffer whose capacity is chosen at construction.
+
+    Template Parameters:
+        - T: The type of the elements.
+        - Allocator: The allocator for the slots.
+
+    It behaves like ring_buffer but allocates its slots once, in the
+   constructor, and never again. Any capacity is allowed; the storage is
+   rounded up to a power of two so indices are still reduced with a mask.
+*/
+template <typename T, typename Allocator = allocator<T>>
+class dynamic_ring_buffer
+    : public internal::basic_ring_buffer<
+          T, internal::dynamic_ring_storage<T, Allocator>> {
+ public:
+  // Constructor taking the capacity
+  explicit dynamic_ring_buffer(std::size_t capacity)
+      : internal::basic_ring_buffer<T, storage>(capacity) {}
+
+ private:
+  using storage = internal::dynamic_ring_storage<T, Allocator>;
+};
+}  // namespace open_stl
+
+#endif  // OPEN_STL_RING_BUFFER_H_
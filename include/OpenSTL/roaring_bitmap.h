@@ -0,0 +1,1018 @@
+#ifndef OPEN_STL_ROARING_BITMAP_H_
+#define OPEN_STL_ROARING_BITMAP_H_
+
+#include <OpenSTL/algorithm.h>
+#include <OpenSTL/internal/bit_ops.h>
+#include <OpenSTL/utility.h>
+#include <OpenSTL/vector.h>
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <stdexcept>
+#include <string>
+
+namespace open_stl {
+namespace internal {
+
+// Number of set bits in a 2^16-bit bitset.
+inline std::uint32_t bitset_cardinality(const std::uint64_t *words) {
+  return std::uint32_t(popcount_words(words, 1024));
+}
+
+// Sets the bits first..last, inclusive, of a bitset.
+inline void set_bit_range(std::uint64_t *words, std::uint32_t first,
+                          std::uint32_t last) {
+  std::uint32_t first_word = first >> 6;
+  std::uint32_t last_word = last >> 6;
+  std::uint64_t first_mask = ~std::uint64_t(0) << (first & 63);
+  std::uint64_t last_mask = ~std::uint64_t(0) >> (63 - (last & 63));
+  if (first_word == last_word) {
+    words[first_word] |= first_mask & last_mask;
+    return;
+  }
+  words[first_word] |= first_mask;
+  for (std::uint32_t i = first_word + 1; i < last_word; i++) {
+    words[i] = ~std::uint64_t(0);
+  }
+  words[last_word] |= last_mask;
+}
+
+/*
+    Calls `out` for every value in both of two sorted arrays.
+
+    When one array is much shorter, each of its values is looked up in the
+   rest of the longer one by binary search, which costs O(m log n) instead
+   of the O(m + n) of a merge.
+*/
+template <typename Out>
+void intersect_arrays(const std::uint16_t *a, std::size_t a_size,
+                      const std::uint16_t *b, std::size_t b_size, Out out) {
+  if (a_size > b_size) {
+    open_stl::swap(a, b);
+    open_stl::swap(a_size, b_size);
+  }
+  const std::uint16_t *b_end = b + b_size;
+  if (a_size * 32 < b_size) {
+    for (std::size_t i = 0; i < a_size && b != b_end; i++) {
+      b = open_stl::lower_bound(b, b_end, a[i]);
+      if (b != b_end && *b == a[i]) out(a[i]);
+    }
+    return;
+  }
+  const std::uint16_t *a_end = a + a_size;
+  while (a != a_end && b != b_end) {
+    if (*a < *b) {
+      a++;
+    } else if (*b < *a) {
+      b++;
+    } else {
+      out(*a);
+      a++;
+      b++;
+    }
+  }
+}
+
+/*
+    The set of low 16 bits of the values of a roaring_bitmap sharing the same
+   high 16 bits.
+
+    A container is in one of three forms:
+        - array: the values in `values`, sorted; used up to 4096 values,
+       where it takes at most as much memory as a bitset.
+        - bitset: 2^16 bits in `words`; used above 4096 values.
+        - run: pairs of (start, length - 1) in `values`, sorted; used where
+       run_optimize() finds it smallest, and for a full range of 2^16.
+*/
+struct roaring_container {
+  enum kind_type : std::uint8_t { array_kind, bitset_kind, run_kind };
+
+  static constexpr std::uint32_t array_limit = 4096;
+  static constexpr std::size_t bitset_words = 1024;
+
+  kind_type kind = array_kind;
+  std::uint32_t cardinality = 0;
+  vector<std::uint16_t> values;
+  vector<std::uint64_t> words;
+
+  // Returns the number of runs of a run container
+  std::size_t run_count() const { return values.size() / 2; }
+
+  // Checks whether the container holds `value`
+  bool contains(std::uint16_t value) const {
+    if (kind == array_kind) {
+      const std::uint16_t *end = values.data() + values.size();
+      const std::uint16_t *it =
+          open_stl::lower_bound(values.data(), end, value);
+      return it != end && *it == value;
+    }
+    if (kind == bitset_kind) return (words[value >> 6] >> (value & 63)) & 1;
+    // The last run starting at or before `value` is the only candidate.
+    std::size_t low = 0;
+    std::size_t high = run_count();
+    while (low < high) {
+      std::size_t middle = (low + high) / 2;
+      if (values[2 * middle] <= value) {
+        low = middle + 1;
+      } else {
+        high = middle;
+      }
+    }
+    return low > 0 && value - values[2 * (low - 1)] <= values[2 * low - 1];
+  }
+
+  // Calls `f` for every value, in increasing order.
+  template <typename F>
+  void for_each(F &&f) const {
+    if (kind == array_kind) {
+      for (std::size_t i = 0; i < values.size(); i++) {
+        f(values[i]);
+      }
+    } else if (kind == bitset_kind) {
+      for (std::size_t i = 0; i < bitset_words; i++) {
+        for (std::uint64_t word = words[i]; word != 0; word &= word - 1) {
+          f(std::uint16_t(i * 64 + std::countr_zero(word)));
+        }
+      }
+    } else {
+      for (std::size_t run = 0; run < run_count(); run++) {
+        std::uint32_t start = values[2 * run];
+        std::uint32_t last = start + values[2 * run + 1];
+        for (std::uint32_t value = start; value <= last; value++) {
+          f(std::uint16_t(value));
+        }
+      }
+    }
+  }
+
+  // Adds `value`, returning whether it was absent.
+  bool add(std::uint16_t value) {
+    if (contains(value)) return false;
+    if (kind == run_kind) materialize();
+    if (kind == array_kind && cardinality == array_limit) to_bitset();
+    if (kind == array_kind) {
+      std::uint16_t *it = open_stl::lower_bound(
+          values.data(), values.data() + values.size(), value);
+      std::size_t position = it - values.data();
+      values.push_back(value);
+      for (std::size_t i = values.size() - 1; i > position; i--) {
+        values[i] = values[i - 1];
+      }
+      values[position] = value;
+    } else {
+      words[value >> 6] |= std::uint64_t(1) << (value & 63);
+    }
+    cardinality++;
+    return true;
+  }
+
+  // Removes `value`, returning whether it was present.
+  bool remove(std::uint16_t value) {
+    if (!contains(value)) return false;
+    if (kind == run_kind) materialize();
+    if (kind == array_kind) {
+      values.erase(open_stl::lower_bound(
+          values.data(), values.data() + values.size(), value));
+    } else {
+      words[value >> 6] &= ~(std::uint64_t(1) << (value & 63));
+    }
+    cardinality--;
+    normalize();
+    return true;
+  }
+
+  // Adds the values first..last, inclusive.
+  void add_range(std::uint32_t first, std::uint32_t last) {
+    if (first == 0 && last == 0xffff) {
+      kind = run_kind;
+      values = vector<std::uint16_t>({0, 0xffff});
+      words = vector<std::uint64_t>();
+      cardinality = 0x10000;
+      return;
+    }
+    if (kind != bitset_kind) to_bitset();
+    set_bit_range(words.data(), first, last);
+    cardinality = bitset_cardinality(words.data());
+    normalize();
+  }
+
+  // Converts the container to a bitset.
+  void to_bitset() {
+    vector<std::uint64_t> bits(bitset_words, 0);
+    if (kind == run_kind) {
+      for (std::size_t run = 0; run < run_count(); run++) {
+        set_bit_range(bits.data(), values[2 * run],
+                      std::uint32_t(values[2 * run]) + values[2 * run + 1]);
+      }
+    } else {
+      for_each([&bits](std::uint16_t value) {
+        bits[value >> 6] |= std::uint64_t(1) << (value & 63);
+      });
+    }
+    words = open_stl::move(bits);
+    values = vector<std::uint16_t>();
+    kind = bitset_kind;
+  }
+
+  // Converts the container to a sorted array.
+  void to_array() {
+    vector<std::uint16_t> sorted;
+    sorted.reserve(cardinality);
+    for_each([&sorted](std::uint16_t value) { sorted.push_back(value); });
+    values = open_stl::move(sorted);
+    words = vector<std::uint64_t>();
+    kind = array_kind;
+  }
+
+  // Converts the container to runs.
+  void to_runs() {
+    vector<std::uint16_t> runs;
+    std::uint32_t start = 0;
+    std::uint32_t previous = 0;
+    bool open = false;
+    for_each([&](std::uint16_t value) {
+      if (open && value == previous + 1) {
+        previous = value;
+        return;
+      }
+      if (open) {
+        runs.push_back(std::uint16_t(start));
+        runs.push_back(std::uint16_t(previous - start));
+      }
+      start = previous = value;
+      open = true;
+    });
+    if (open) {
+      runs.push_back(std::uint16_t(start));
+      runs.push_back(std::uint16_t(previous - start));
+    }
+    values = open_stl::move(runs);
+    words = vector<std::uint64_t>();
+    kind = run_kind;
+  }
+
+  // Converts a run container to an array or a bitset, by cardinality.
+  void materialize() {
+    if (kind != run_kind) return;
+    if (cardinality <= array_limit) {
+      to_array();
+    } else {
+      to_bitset();
+    }
+  }
+
+  // Restores the array-or-bitset choice after the cardinality of an array
+  // or bitset container changed.
+  void normalize() {
+    if (kind == bitset_kind && cardinality <= array_limit) {
+      to_array();
+    } else if (kind == array_kind && cardinality > array_limit) {
+      to_bitset();
+    }
+  }
+
+  // Counts the runs of consecutive values.
+  std::size_t count_runs() const {
+    if (kind == run_kind) return run_count();
+    if (kind == array_kind) {
+      std::size_t runs = values.empty() ? 0 : 1;
+      for (std::size_t i = 1; i < values.size(); i++) {
+        runs += values[i] != values[i - 1] + 1;
+      }
+      return runs;
+    }
+    // A run starts at every set bit whose lower neighbour is clear.
+    std::size_t runs = 0;
+    std::uint64_t carry = 0;
+    for (std::size_t i = 0; i < bitset_words; i++) {
+      runs += std::popcount(words[i] & ~((words[i] << 1) | carry));
+      carry = words[i] >> 63;
+    }
+    return runs;
+  }
+
+  // Returns the size of the container in the serialized format
+  std::size_t serialized_bytes() const {
+    if (kind == run_kind) return 2 + 4 * run_count();
+    if (kind == array_kind) return 2 * std::size_t(cardinality);
+    return 8 * bitset_words;
+  }
+
+  // Switches to runs if they take less space than an array or bitset, and
+  // back if not. Returns whether the container ends up as runs.
+  bool run_optimize() {
+    std::size_t run_bytes = 2 + 4 * count_runs();
+    std::size_t other_bytes = cardinality <= array_limit
+                                  ? 2 * std::size_t(cardinality)
+                                  : 8 * bitset_words;
+    if (run_bytes < other_bytes) {
+      if (kind != run_kind) to_runs();
+      return true;
+    }
+    materialize();
+    return false;
+  }
+
+  // Checks whether two containers hold the same values, in any form
+  bool same_values(const roaring_container &other) const {
+    if (cardinality != other.cardinality) return false;
+    if (kind == other.kind) {
+      return kind == bitset_kind ? words == other.words
+                                 : values == other.values;
+    }
+    roaring_container left = *this;
+    roaring_container right = other;
+    left.to_bitset();
+    right.to_bitset();
+    return left.words == right.words;
+  }
+};
+
+// Returns `container`, or a copy of it in array or bitset form if it is a
+// run container, kept in `scratch`.
+inline const roaring_container &without_runs(
+    const roaring_container &container, roaring_container &scratch) {
+  if (container.kind != roaring_container::run_kind) return container;
+  scratch = container;
+  scratch.materialize();
+  return scratch;
+}
+
+// Returns the values in both containers.
+inline roaring_container roaring_and(const roaring_container &a,
+                                     const roaring_container &b) {
+  using container = roaring_container;
+  container a_scratch;
+  container b_scratch;
+  const container &x = without_runs(a, a_scratch);
+  const container &y = without_runs(b, b_scratch);
+  container result;
+  if (x.kind == container::bitset_kind && y.kind == container::bitset_kind) {
+    result.words = vector<std::uint64_t>(container::bitset_words, 0);
+    transform_words<bit_and>(result.words.data(), x.words.data(),
+                             y.words.data(), container::bitset_words);
+    result.kind = container::bitset_kind;
+    result.cardinality = bitset_cardinality(result.words.data());
+    result.normalize();
+  } else if (x.kind == container::array_kind &&
+             y.kind == container::array_kind) {
+    intersect_arrays(x.values.data(), x.values.size(), y.values.data(),
+                     y.values.size(), [&result](std::uint16_t value) {
+                       result.values.push_back(value);
+                     });
+    result.cardinality = std::uint32_t(result.values.size());
+  } else {
+    const container &array = x.kind == container::array_kind ? x : y;
+    const container &bitset = x.kind == container::array_kind ? y : x;
+    for (std::size_t i = 0; i < array.values.size(); i++) {
+      std::uint16_t value = array.values[i];
+      if ((bitset.words[value >> 6] >> (value & 63)) & 1) {
+        result.values.push_back(value);
+      }
+    }
+    result.cardinality = std::uint32_t(result.values.size());
+  }
+  return result;
+}
+
+// Returns the number of values in both containers, without building them.
+inline std::uint32_t roaring_and_cardinality(const roaring_container &a,
+                                             const roaring_container &b) {
+  using container = roaring_container;
+  container a_scratch;
+  container b_scratch;
+  const container &x = without_runs(a, a_scratch);
+  const container &y = without_runs(b, b_scratch);
+  std::uint32_t count = 0;
+  if (x.kind == container::bitset_kind && y.kind == container::bitset_kind) {
+    // AND a chunk at a time into a small buffer that stays in L1.
+    const std::size_t chunk_words = 64;
+    std::uint64_t chunk[chunk_words];
+    for (std::size_t i = 0; i < container::bitset_words; i += chunk_words) {
+      transform_words<bit_and>(chunk, x.words.data() + i,
+                               y.words.data() + i, chunk_words);
+      count += std::uint32_t(popcount_words(chunk, chunk_words));
+    }
+  } else if (x.kind == container::array_kind &&
+             y.kind == container::array_kind) {
+    intersect_arrays(x.values.data(), x.values.size(), y.values.data(),
+                     y.values.size(), [&count](std::uint16_t) { count++; });
+  } else {
+    const container &array = x.kind == container::array_kind ? x : y;
+    const container &bitset = x.kind == container::array_kind ? y : x;
+    for (std::size_t i = 0; i < array.values.size(); i++) {
+      std::uint16_t value = array.values[i];
+      count += (bitset.words[value >> 6] >> (value & 63)) & 1;
+    }
+  }
+  return count;
+}
+
+// Returns the values in either container.
+inline roaring_container roaring_or(const roaring_container &a,
+                                    const roaring_container &b) {
+  using container = roaring_container;
+  container a_scratch;
+  container b_scratch;
+  const container &x = without_runs(a, a_scratch);
+  const container &y = without_runs(b, b_scratch);
+  container result;
+  if (x.kind == container::array_kind && y.kind == container::array_kind) {
+    std::size_t i = 0;
+    std::size_t j = 0;
+    result.values.reserve(x.values.size() + y.values.size());
+    while (i < x.values.size() || j < y.values.size()) {
+      if (j == y.values.size() ||
+          (i < x.values.size() && x.values[i] < y.values[j])) {
+        result.values.push_back(x.values[i++]);
+      } else if (i == x.values.size() || y.values[j] < x.values[i]) {
+        result.values.push_back(y.values[j++]);
+      } else {
+        result.values.push_back(x.values[i++]);
+        j++;
+      }
+    }
+    result.cardinality = std::uint32_t(result.values.size());
+    result.normalize();
+    return result;
+  }
+  const container &bitset = x.kind == container::bitset_kind ? x : y;
+  const container &other = x.kind == container::bitset_kind ? y : x;
+  result = bitset;
+  if (other.kind == container::bitset_kind) {
+    transform_words<bit_or>(result.words.data(), result.words.data(),
+                            other.words.data(), container::bitset_words);
+  } else {
+    for (std::size_t i = 0; i < other.values.size(); i++) {
+      std::uint16_t value = other.values[i];
+      result.words[value >> 6] |= std::uint64_t(1) << (value & 63);
+    }
+  }
+  result.cardinality = bitset_cardinality(result.words.data());
+  return result;
+}
+
+// Returns the values in `a` but not in `b`.
+inline roaring_container roaring_andnot(const roaring_container &a,
+                                        const roaring_container &b) {
+  using container = roaring_container;
+  container a_scratch;
+  container b_scratch;
+  const container &x = without_runs(a, a_scratch);
+  const container &y = without_runs(b, b_scratch);
+  container result;
+  if (x.kind == container::array_kind) {
+    if (y.kind == container::array_kind) {
+      std::size_t j = 0;
+      for (std::size_t i = 0; i < x.values.size(); i++) {
+        while (j < y.values.size() && y.values[j] < x.values[i]) j++;
+        if (j == y.values.size() || y.values[j] != x.values[i]) {
+          result.values.push_back(x.values[i]);
+        }
+      }
+    } else {
+      for (std::size_t i = 0; i < x.values.size(); i++) {
+        std::uint16_t value = x.values[i];
+        if (((y.words[value >> 6] >> (value & 63)) & 1) == 0) {
+          result.values.push_back(value);
+        }
+      }
+    }
+    result.cardinality = std::uint32_t(result.values.size());
+    return result;
+  }
+  result = x;
+  if (y.kind == container::bitset_kind) {
+    transform_words<bit_andnot>(result.words.data(), result.words.data(),
+                                y.words.data(), container::bitset_words);
+  } else {
+    for (std::size_t i = 0; i < y.values.size(); i++) {
+      std::uint16_t value = y.values[i];
+      result.words[value >> 6] &= ~(std::uint64_t(1) << (value & 63));
+    }
+  }
+  result.cardinality = bitset_cardinality(result.words.data());
+  result.normalize();
+  return result;
+}
+
+inline void write_u16(unsigned char *out, std::uint16_t value) {
+  out[0] = static_cast<unsigned char>(value);
+  out[1] = static_cast<unsigned char>(value >> 8);
+}
+
+inline void write_u32(unsigned char *out, std::uint32_t value) {
+  write_u16(out, std::uint16_t(value));
+  write_u16(out + 2, std::uint16_t(value >> 16));
+}
+
+inline std::uint16_t read_u16(const unsigned char *in) {
+  return std::uint16_t(in[0] | in[1] << 8);
+}
+
+inline std::uint32_t read_u32(const unsigned char *in) {
+  return read_u16(in) | std::uint32_t(read_u16(in + 2)) << 16;
+}
+
+}  // namespace internal
+
+/*
+    A compressed set of 32-bit integers: a Roaring bitmap.
+
+    Values are grouped by their high 16 bits into containers, each holding
+   the low 16 bits of its values as a sorted array (up to 4096 values), a
+   2^16-bit bitset (more than 4096 values), or runs of consecutive values.
+   A sparse chunk costs two bytes per value and a dense one a fixed 8 KB, so
+   the bitmap stays small at any density, and operations work a container
+   at a time.
+
+    Union, intersection and difference combine the containers with matching
+   keys. Bitset pairs are combined with the SSE2 word kernels of
+   dynamic_bitset, and counted with its population count; array pairs by
+   merging, or by binary search when one array is much shorter, and mixed
+   pairs by testing the array's values in the bitset. and_cardinality()
+   counts an intersection without building it.
+
+    Run containers are only created by run_optimize(), which converts every
+   container for which runs are smallest, and by add_range() for a full
+   chunk. Operations on run containers expand them first.
+
+    serialize() writes the portable format shared by the Roaring libraries
+   for C, Java and Go (the RoaringFormatSpec), so bitmaps can be exchanged
+   with them; deserialize() reads it back, rejecting malformed input.
+*/
+class roaring_bitmap {
+  using container_type = internal::roaring_container;
+
+  // The cookies that open a serialized bitmap, with and without run
+  // containers.
+  static constexpr std::uint32_t serial_cookie = 12347;
+  static constexpr std::uint32_t serial_cookie_no_runs = 12346;
+  // Serialized bitmaps with run containers and fewer containers than this
+  // omit the offset header.
+  static constexpr std::size_t no_offset_threshold = 4;
+
+ public:
+  using value_type = std::uint32_t;
+  using size_type = std::size_t;
+
+  // Default constructor
+  roaring_bitmap() : m_keys(), m_containers() {}
+
+  // Constructor taking an std::initializer_list
+  roaring_bitmap(std::initializer_list<value_type> values)
+      : m_keys(), m_containers() {
+    for (value_type value : values) {
+      add(value);
+    }
+  }
+
+  // Returns the number of values
+  std::uint64_t cardinality() const {
+    std::uint64_t total = 0;
+    for (size_type i = 0; i < m_containers.size(); i++) {
+      total += m_containers[i].cardinality;
+    }
+    return total;
+  }
+
+  // Checks whether the bitmap is empty
+  bool empty() const { return m_containers.empty(); }
+
+  // Checks whether `value` is in the bitmap
+  bool contains(value_type value) const {
+    size_type index = find_key(std::uint16_t(value >> 16));
+    return index < m_keys.size() && m_keys[index] == value >> 16 &&
+           m_containers[index].contains(std::uint16_t(value));
+  }
+
+  // Adds `value`, returning whether it was absent.
+  bool add(value_type value) {
+    return container_for(std::uint16_t(value >> 16))
+        .add(std::uint16_t(value));
+  }
+
+  // Adds the values in [first, last).
+  void add_range(value_type first, std::uint64_t last) {
+    if (last > std::uint64_t(1) << 32) last = std::uint64_t(1) << 32;
+    if (first >= last) return;
+    value_type final = value_type(last - 1);
+    for (std::uint32_t key = first >> 16; key <= final >> 16; key++) {
+      std::uint32_t low = key == first >> 16 ? first & 0xffff : 0;
+      std::uint32_t high = key == final >> 16 ? final & 0xffff : 0xffff;
+      container_for(std::uint16_t(key)).add_range(low, high);
+    }
+  }
+
+  // Removes `value`, returning whether it was present.
+  bool remove(value_type value) {
+    size_type index = find_key(std::uint16_t(value >> 16));
+    if (index == m_keys.size() || m_keys[index] != value >> 16) return false;
+    container_type &container = m_containers[index];
+    if (!container.remove(std::uint16_t(value))) return false;
+    if (container.cardinality == 0) {
+      m_keys.erase(m_keys.begin() + index);
+      m_containers.erase(m_containers.begin() + index);
+    }
+    return true;
+  }
+
+  // Removes every value.
+  void clear() {
+    m_keys.clear();
+    m_containers.clear();
+  }
+
+  // Calls `f` for every value, in increasing order.
+  template <typename F>
+  void for_each(F f) const {
+    for (size_type i = 0; i < m_containers.size(); i++) {
+      value_type high = value_type(m_keys[i]) << 16;
+      m_containers[i].for_each(
+          [&f, high](std::uint16_t low) { f(high | low); });
+    }
+  }
+
+  // Returns the values in increasing order
+  vector<value_type> to_vector() const {
+    vector<value_type> values;
+    values.reserve(size_type(cardinality()));
+    for_each([&values](value_type value) { values.push_back(value); });
+    return values;
+  }
+
+  // Converts every container to runs where that is smallest, and back
+  // where it is not. Returns whether any container holds runs.
+  bool run_optimize() {
+    bool any = false;
+    for (size_type i = 0; i < m_containers.size(); i++) {
+      any |= m_containers[i].run_optimize();
+    }
+    return any;
+  }
+
+  // Returns the number of values in both bitmaps, without building the
+  // intersection.
+  std::uint64_t and_cardinality(const roaring_bitmap &other) const {
+    std::uint64_t total = 0;
+    size_type i = 0;
+    size_type j = 0;
+    while (i < m_keys.size() && j < other.m_keys.size()) {
+      if (m_keys[i] < other.m_keys[j]) {
+        i++;
+      } else if (other.m_keys[j] < m_keys[i]) {
+        j++;
+      } else {
+        total += internal::roaring_and_cardinality(m_containers[i++],
+                                                   other.m_containers[j++]);
+      }
+    }
+    return total;
+  }
+
+  // Returns the values in both bitmaps
+  friend roaring_bitmap operator&(const roaring_bitmap &left,
+                                  const roaring_bitmap &right) {
+    roaring_bitmap result;
+    size_type i = 0;
+    size_type j = 0;
+    while (i < left.m_keys.size() && j < right.m_keys.size()) {
+      if (left.m_keys[i] < right.m_keys[j]) {
+        i++;
+      } else if (right.m_keys[j] < left.m_keys[i]) {
+        j++;
+      } else {
+        result.append(left.m_keys[i],
+                      internal::roaring_and(left.m_containers[i],
+                                            right.m_containers[j]));
+        i++;
+        j++;
+      }
+    }
+    return result;
+  }
+
+  // Returns the values in either bitmap
+  friend roaring_bitmap operator|(const roaring_bitmap &left,
+                                  const roaring_bitmap &right) {
+    roaring_bitmap result;
+    size_type i = 0;
+    size_type j = 0;
+    while (i < left.m_keys.size() || j < right.m_keys.size()) {
+      if (j == right.m_keys.size() ||
+          (i < left.m_keys.size() && left.m_keys[i] < right.m_keys[j])) {
+        result.append(left.m_keys[i], left.m_containers[i]);
+        i++;
+      } else if (i == left.m_keys.size() ||
+                 right.m_keys[j] < left.m_keys[i]) {
+        result.append(right.m_keys[j], right.m_containers[j]);
+        j++;
+      } else {
+        result.append(left.m_keys[i],
+                      internal::roaring_or(left.m_containers[i],
+                                           right.m_containers[j]));
+        i++;
+        j++;
+      }
+    }
+    return result;
+  }
+
+  // Returns the values in `left` but not in `right` (and-not)
+  friend roaring_bitmap operator-(const roaring_bitmap &left,
+                                  const roaring_bitmap &right) {
+    roaring_bitmap result;
+    size_type j = 0;
+    for (size_type i = 0; i < left.m_keys.size(); i++) {
+      while (j < right.m_keys.size() && right.m_keys[j] < left.m_keys[i]) {
+        j++;
+      }
+      if (j < right.m_keys.size() && right.m_keys[j] == left.m_keys[i]) {
+        result.append(left.m_keys[i],
+                      internal::roaring_andnot(left.m_containers[i],
+                                               right.m_containers[j]));
+      } else {
+        result.append(left.m_keys[i], left.m_containers[i]);
+      }
+    }
+    return result;
+  }
+
+  // Keeps only the values also in `other`
+  roaring_bitmap &operator&=(const roaring_bitmap &other) {
+    return *this = *this & other;
+  }
+
+  // Adds the values of `other`
+  roaring_bitmap &operator|=(const roaring_bitmap &other) {
+    return *this = *this | other;
+  }
+
+  // Removes the values of `other`
+  roaring_bitmap &operator-=(const roaring_bitmap &other) {
+    return *this = *this - other;
+  }
+
+  // Checks if two bitmaps hold the same values
+  bool operator==(const roaring_bitmap &other) const {
+    if (m_keys != other.m_keys) return false;
+    for (size_type i = 0; i < m_containers.size(); i++) {
+      if (!m_containers[i].same_values(other.m_containers[i])) return false;
+    }
+    return true;
+  }
+
+  // Checks if two bitmaps hold different values
+  bool operator!=(const roaring_bitmap &other) const {
+    return !(*this == other);
+  }
+
+  // Returns the number of bytes serialize() writes
+  size_type serialized_size() const {
+    size_type count = m_containers.size();
+    bool runs = has_runs();
+    size_type size = runs ? 4 + (count + 7) / 8 : 8;
+    size += 4 * count;
+    if (!runs || count >= no_offset_threshold) size += 4 * count;
+    for (size_type i = 0; i < count; i++) {
+      size += m_containers[i].serialized_bytes();
+    }
+    return size;
+  }
+
+  /*
+      Writes the bitmap in the portable Roaring format.
+
+      Parameters:
+          - out: The destination, with room for serialized_size() bytes.
+
+      Returns:
+          - The number of bytes written.
+  */
+  size_type serialize(unsigned char *out) const {
+    using internal::write_u16;
+    using internal::write_u32;
+    size_type count = m_containers.size();
+    bool runs = has_runs();
+    unsigned char *position = out;
+    if (runs) {
+      write_u32(position, serial_cookie | std::uint32_t(count - 1) << 16);
+      position += 4;
+      for (size_type i = 0; i < (count + 7) / 8; i++) {
+        unsigned char flags = 0;
+        for (size_type bit = 0; bit < 8 && i * 8 + bit < count; bit++) {
+          if (m_containers[i * 8 + bit].kind == container_type::run_kind) {
+            flags |= static_cast<unsigned char>(1 << bit);
+          }
+        }
+        *position++ = flags;
+      }
+    } else {
+      write_u32(position, serial_cookie_no_runs);
+      write_u32(position + 4, std::uint32_t(count));
+      position += 8;
+    }
+    for (size_type i = 0; i < count; i++) {
+      write_u16(position, m_keys[i]);
+      write_u16(position + 2, std::uint16_t(m_containers[i].cardinality - 1));
+      position += 4;
+    }
+    if (!runs || count >= no_offset_threshold) {
+      size_type offset = size_type(position - out) + 4 * count;
+      for (size_type i = 0; i < count; i++) {
+        write_u32(position, std::uint32_t(offset));
+        position += 4;
+        offset += m_containers[i].serialized_bytes();
+      }
+    }
+    for (size_type i = 0; i < count; i++) {
+      const container_type &container = m_containers[i];
+      if (container.kind == container_type::run_kind) {
+        write_u16(position, std::uint16_t(container.run_count()));
+        position += 2;
+      }
+      if (container.kind == container_type::bitset_kind) {
+        for (size_type w = 0; w < container_type::bitset_words; w++) {
+          write_u32(position, std::uint32_t(container.words[w]));
+          write_u32(position + 4, std::uint32_t(container.words[w] >> 32));
+          position += 8;
+        }
+      } else {
+        for (size_type v = 0; v < container.values.size(); v++) {
+          write_u16(position, container.values[v]);
+          position += 2;
+        }
+      }
+    }
+    return size_type(position - out);
+  }
+
+  /*
+      Reads a bitmap in the portable Roaring format.
+
+      Parameters:
+          - data: The serialized bytes.
+          - size: The number of bytes available.
+
+      Returns:
+          - The bitmap. Throws std::invalid_argument if the bytes are not a
+         well-formed serialized bitmap.
+  */
+  static roaring_bitmap deserialize(const unsigned char *data,
+                                    size_type size) {
+    using internal::read_u16;
+    using internal::read_u32;
+    const unsigned char *position = data;
+    const unsigned char *end = data + size;
+    auto need = [&position, end](size_type bytes) {
+      if (size_type(end - position) < bytes) {
+        throw_invalid("the input is truncated");
+      }
+    };
+
+    need(4);
+    std::uint32_t cookie = read_u32(position);
+    position += 4;
+    size_type count;
+    const unsigned char *run_flags = nullptr;
+    if ((cookie & 0xffff) == serial_cookie) {
+      count = (cookie >> 16) + 1;
+      need((count + 7) / 8);
+      run_flags = position;
+      position += (count + 7) / 8;
+    } else if (cookie == serial_cookie_no_runs) {
+      need(4);
+      count = read_u32(position);
+      position += 4;
+      if (count > 0x10000) throw_invalid("it has too many containers");
+    } else {
+      throw_invalid("the cookie is unknown");
+    }
+
+    need(4 * count);
+    const unsigned char *descriptions = position;
+    position += 4 * count;
+    if (run_flags == nullptr || count >= no_offset_threshold) {
+      need(4 * count);
+      position += 4 * count;
+    }
+
+    roaring_bitmap result;
+    result.m_keys.reserve(count);
+    result.m_containers.reserve(count);
+    for (size_type i = 0; i < count; i++) {
+      std::uint16_t key = read_u16(descriptions + 4 * i);
+      std::uint32_t cardinality = read_u16(descriptions + 4 * i + 2) + 1u;
+      if (i > 0 && key <= result.m_keys[i - 1]) {
+        throw_invalid("its keys are not increasing");
+      }
+      container_type container;
+      container.cardinality = cardinality;
+      if (run_flags != nullptr && ((run_flags[i / 8] >> (i % 8)) & 1)) {
+        need(2);
+        size_type runs = read_u16(position);
+        position += 2;
+        need(4 * runs);
+        container.kind = container_type::run_kind;
+        container.values.resize(2 * runs);
+        std::uint32_t total = 0;
+        std::uint32_t next = 0;
+        for (size_type r = 0; r < 2 * runs; r += 2) {
+          std::uint32_t start = read_u16(position + 2 * r);
+          std::uint32_t length = read_u16(position + 2 * r + 2);
+          if (start < next || start + length > 0xffff) {
+            throw_invalid("its runs overlap or overflow");
+          }
+          container.values[r] = std::uint16_t(start);
+          container.values[r + 1] = std::uint16_t(length);
+          total += length + 1;
+          next = start + length + 1;
+        }
+        position += 4 * runs;
+        if (total != cardinality) throw_invalid("a cardinality is wrong");
+      } else if (cardinality <= container_type::array_limit) {
+        need(2 * size_type(cardinality));
+        container.values.resize(cardinality);
+        for (size_type v = 0; v < cardinality; v++) {
+          container.values[v] = read_u16(position + 2 * v);
+          if (v > 0 && container.values[v] <= container.values[v - 1]) {
+            throw_invalid("an array is not increasing");
+          }
+        }
+        position += 2 * size_type(cardinality);
+      } else {
+        need(8 * container_type::bitset_words);
+        container.kind = container_type::bitset_kind;
+        container.words.resize(container_type::bitset_words);
+        for (size_type w = 0; w < container_type::bitset_words; w++) {
+          container.words[w] =
+              read_u32(position + 8 * w) |
+              std::uint64_t(read_u32(position + 8 * w + 4)) << 32;
+        }
+        position += 8 * container_type::bitset_words;
+        if (internal::bitset_cardinality(container.words.data()) !=
+            cardinality) {
+          throw_invalid("a cardinality is wrong");
+        }
+      }
+      result.m_keys.push_back(key);
+      result.m_containers.push_back(open_stl::move(container));
+    }
+    return result;
+  }
+
+ private:
+  // The high 16 bits of the values in each container, increasing.
+  vector<std::uint16_t> m_keys;
+  vector<container_type> m_containers;
+
+  // Returns the position of the first key not less than `key`.
+  size_type find_key(std::uint16_t key) const {
+    return size_type(open_stl::lower_bound(m_keys.data(),
+                                           m_keys.data() + m_keys.size(),
+                                           key) -
+                     m_keys.data());
+  }
+
+  // Returns the container for `key`, inserting an empty one if needed.
+  container_type &container_for(std::uint16_t key) {
+    size_type index = find_key(key);
+    if (index == m_keys.size() || m_keys[index] != key) {
+      m_keys.push_back(key);
+      m_containers.push_back(container_type());
+      // Rotate the new container into place; moving a container moves
+      // only its vectors' pointers.
+      for (size_type i = m_keys.size() - 1; i > index; i--) {
+        open_stl::swap(m_keys[i], m_keys[i - 1]);
+        open_stl::swap(m_containers[i], m_containers[i - 1]);
+      }
+    }
+    return m_containers[index];
+  }
+
+  // Appends a container with a key greater than all others, unless it is
+  // empty.
+  void append(std::uint16_t key, container_type container) {
+    if (container.cardinality == 0) return;
+    m_keys.push_back(key);
+    m_containers.push_back(open_stl::move(container));
+  }
+
+  bool has_runs() const {
+    for (size_type i = 0; i < m_containers.size(); i++) {
+      if (m_containers[i].kind == container_type::run_kind) return true;
+    }
+    return false;
+  }
+
+  [[noreturn]] static void throw_invalid(const char *reason) {
+    throw std::invalid_argument(
+        std::string("Error: the bytes are not a serialized roaring_bitmap: ") +
+        reason + ".");
+  }
+};
+}  // namespace open_stl
+
+#endif  // OPEN_STL_ROARING_BITMAP_H_
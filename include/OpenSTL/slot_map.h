@@ -0,0 +1,277 @@
+#ifndef OPEN_STL_SLOT_MAP_H_
+#define OPEN_STL_SLOT_MAP_H_
+
+#include <OpenSTL/memory.h>
+#include <OpenSTL/utility.h>
+#include <OpenSTL/vector.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+
+namespace open_stl {
+/*
+    A 64-bit handle to an element of a slot_map.
+
+    The index names a slot of the map and the generation says which of the
+   elements that slot has held over time the handle refers to, so a handle
+   to an erased element is detected rather than aliasing its successor. A
+   default-constructed handle refers to nothing.
+*/
+struct slot_handle {
+  std::uint32_t index = 0;
+  std::uint32_t generation = 0;
+
+  // Checks if two handles refer to the same element
+  bool operator==(const slot_handle &right) const {
+    return index == right.index && generation == right.generation;
+  }
+
+  // Checks if two handles refer to different elements
+  bool operator!=(const slot_handle &right) const { return !(*this == right); }
+};
+
+static_assert(sizeof(slot_handle) == 8, "slot_handle must be 64 bits");
+
+namespace internal {
+
+// A slot of a slot_map. While the slot is in use, `index` is the position
+// of its element in the dense array and `generation` is odd; while it is
+// free, `index` links to the next free slot and `generation` is even.
+struct slot_map_slot {
+  std::uint32_t index;
+  std::uint32_t generation;
+};
+
+}  // namespace internal
+
+/*
+    A container of values addressed by generational handles, stored densely
+   for fast iteration.
+
+    Template Parameters:
+        - T: The type of the values.
+        - Allocator: The allocator; it is rebound to allocate the slot
+       tables.
+
+    The values live contiguously in a vector with no holes, so iterating
+   them is as fast as iterating a vector. Callers keep slot_handles instead
+   of pointers or indices: a handle names a slot, which stays put, and the
+   slot records where its value currently is in the dense array. Insert,
+   erase and lookup are all O(1). Erasing moves the last value into the
+   hole, so iteration order is not insertion order.
+
+    Every slot has a generation counter, bumped whenever its value is
+   inserted or erased, and a handle carries the generation it was issued
+   with. find() of a handle whose value was erased returns nullptr, even if
+   the slot has been reused since. A slot is retired rather than reused once
+   its 32-bit generation would wrap around, so a stale handle can never
+   match again.
+
+    Pointers and iterators into the dense array are invalidated by insertion
+   and erasure, as for a vector; handles are never invalidated.
+*/
+template <typename T, typename Allocator = allocator<T>>
+class slot_map {
+  using slot_type = internal::slot_map_slot;
+
+  template <typename U>
+  using rebound = typename Allocator::template rebind<U>::other;
+
+  // Ends the free list.
+  static constexpr std::uint32_t no_slot = std::uint32_t(-1);
+
+ public:
+  using value_type = T;
+  using size_type = std::size_t;
+  using handle_type = slot_handle;
+  using reference = T &;
+  using const_reference = const T &;
+  using iterator = T *;
+  using const_iterator = const T *;
+
+  // Default constructor
+  slot_map() : m_values(), m_owners(), m_slots(), m_free_head(no_slot) {}
+
+  // Returns an iterator to the first value in the dense array
+  iterator begin() { return m_values.begin(); }
+
+  // Returns a const iterator to the first value in the dense array
+  const_iterator begin() const { return m_values.begin(); }
+
+  // Returns an iterator past the last value
+  iterator end() { return m_values.end(); }
+
+  // Returns a const iterator past the last value
+  const_iterator end() const { return m_values.end(); }
+
+  // Returns a pointer to the dense array of values
+  T *data() { return m_values.data(); }
+
+  // Returns a const pointer to the dense array of values
+  const T *data() const { return m_values.data(); }
+
+  // Returns the number of values
+  size_type size() const { return m_values.size(); }
+
+  // Checks whether the map is empty
+  bool empty() const { return m_values.empty(); }
+
+  // Reserves room for `count` values without reallocating
+  void reserve(size_type count) {
+    m_values.reserve(count);
+    m_owners.reserve(count);
+    m_slots.reserve(count);
+  }
+
+  // Inserts a copy of `value` and returns its handle, in amortized O(1).
+  handle_type insert(const value_type &value) {
+    handle_type handle = acquire_slot();
+    m_values.push_back(value);
+    return handle;
+  }
+
+  // Inserts `value` by moving it and returns its handle.
+  handle_type insert(value_type &&value) {
+    handle_type handle = acquire_slot();
+    m_values.push_back(open_stl::move(value));
+    return handle;
+  }
+
+  // Constructs a value from `args`, inserts it and returns its handle.
+  template <typename... Args>
+  handle_type emplace(Args &&...args) {
+    return insert(value_type(open_stl::forward<Args>(args)...));
+  }
+
+  // Checks whether `handle` refers to a value in the map
+  bool contains(handle_type handle) const {
+    return handle.index < m_slots.size() &&
+           m_slots[handle.index].generation == handle.generation &&
+           (handle.generation & 1) != 0;
+  }
+
+  // Returns a pointer to the value of `handle`, or nullptr if the handle is
+  // stale or was never issued by this map.
+  T *find(handle_type handle) {
+    return contains(handle) ? &m_values[m_slots[handle.index].index]
+                            : nullptr;
+  }
+
+  // Returns a const pointer to the value of `handle`, or nullptr.
+  const T *find(handle_type handle) const {
+    return contains(handle) ? &m_values[m_slots[handle.index].index]
+                            : nullptr;
+  }
+
+  // Returns the value of `handle`, which must be valid.
+  reference operator[](handle_type handle) {
+    return m_values[m_slots[handle.index].index];
+  }
+
+  // Returns the value of `handle`, which must be valid (const version).
+  const_reference operator[](handle_type handle) const {
+    return m_values[m_slots[handle.index].index];
+  }
+
+  // Returns the value of `handle`; throws std::out_of_range if the handle
+  // is stale.
+  reference at(handle_type handle) {
+    if (!contains(handle)) throw_stale_handle();
+    return (*this)[handle];
+  }
+
+  // Returns the value of `handle` (const version)
+  const_reference at(handle_type handle) const {
+    if (!contains(handle)) throw_stale_handle();
+    return (*this)[handle];
+  }
+
+  // Returns the handle of the value at `position` in the dense array.
+  handle_type handle_at(size_type position) const {
+    std::uint32_t slot = m_owners[position];
+    return handle_type{slot, m_slots[slot].generation};
+  }
+
+  /*
+      Erases the value of `handle`, in O(1).
+
+      Parameters:
+          - handle: The handle of the value; stale handles are ignored.
+
+      Returns:
+          - True if a value was erased.
+
+      The last value of the dense array moves into the hole, and its slot
+     is updated to point there.
+  */
+  bool erase(handle_type handle) {
+    if (!contains(handle)) return false;
+    slot_type &slot = m_slots[handle.index];
+    std::uint32_t position = slot.index;
+    std::uint32_t last = std::uint32_t(m_values.size() - 1);
+    if (position != last) {
+      m_values[position] = open_stl::move(m_values[last]);
+      m_owners[position] = m_owners[last];
+      m_slots[m_owners[position]].index = position;
+    }
+    m_values.pop_back();
+    m_owners.pop_back();
+    release_slot(handle.index);
+    return true;
+  }
+
+  // Erases every value; all handles become stale.
+  void clear() {
+    for (size_type i = 0; i < m_owners.size(); i++) {
+      release_slot(m_owners[i]);
+    }
+    m_values.clear();
+    m_owners.clear();
+  }
+
+ private:
+  // The values, without holes.
+  vector<T, Allocator> m_values;
+  // m_owners[i] is the slot of m_values[i], for erasing by swap.
+  vector<std::uint32_t, rebound<std::uint32_t>> m_owners;
+  vector<slot_type, rebound<slot_type>> m_slots;
+  std::uint32_t m_free_head;
+
+  // Takes a free slot, or adds one, for a value about to be appended to the
+  // dense array, and returns the value's handle.
+  handle_type acquire_slot() {
+    std::uint32_t position = std::uint32_t(m_values.size());
+    std::uint32_t index;
+    if (m_free_head != no_slot) {
+      index = m_free_head;
+      m_free_head = m_slots[index].index;
+    } else {
+      index = std::uint32_t(m_slots.size());
+      m_slots.push_back(slot_type{0, 0});
+    }
+    slot_type &slot = m_slots[index];
+    slot.index = position;
+    slot.generation++;
+    m_owners.push_back(index);
+    return handle_type{index, slot.generation};
+  }
+
+  // Makes a slot free, retiring it instead if its generation wrapped.
+  void release_slot(std::uint32_t index) {
+    slot_type &slot = m_slots[index];
+    slot.generation++;
+    if (slot.generation == 0) return;
+    slot.index = m_free_head;
+    m_free_head = index;
+  }
+
+  [[noreturn]] static void throw_stale_handle() {
+    throw std::out_of_range(
+        "Error: slot_map handle is stale. Please ensure the value was not "
+        "erased before using its handle.");
+  }
+};
+}  // namespace open_stl
+
+#endif  // OPEN_STL_SLOT_MAP_H_
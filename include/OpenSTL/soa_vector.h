@@ -0,0 +1,413 @@
+#ifndef OPEN_STL_SOA_VECTOR_H_
+#define OPEN_STL_SOA_VECTOR_H_
+
+#include <OpenSTL/internal/iterator.h>
+#include <OpenSTL/memory.h>
+#include <OpenSTL/span.h>
+#include <OpenSTL/utility.h>
+
+#include <cstddef>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+
+namespace open_stl {
+namespace internal {
+
+/*
+    Random access iterator over a basic_soa_vector.
+
+    Template Parameters:
+        - Container: The basic_soa_vector type, const-qualified for const
+   iterators.
+        - Reference: The proxy reference type the container's operator[]
+   returns.
+
+    Dereferencing yields a tuple of references into the columns, built on
+   the fly, so there is no operator->.
+*/
+template <typename Container, typename Reference>
+class soa_iterator {
+ public:
+  using iterator_category = random_access_iterator_tag;
+  using value_type = typename Container::value_type;
+  using difference_type = std::ptrdiff_t;
+  using reference = Reference;
+
+  soa_iterator() : m_container(nullptr), m_index(0) {}
+
+  soa_iterator(Container *container, std::size_t index)
+      : m_container(container), m_index(index) {}
+
+  reference operator*() const { return (*m_container)[m_index]; }
+  reference operator[](difference_type off) const {
+    return (*m_container)[m_index + off];
+  }
+
+  soa_iterator &operator++() {
+    ++m_index;
+    return *this;
+  }
+
+  soa_iterator operator++(int) {
+    soa_iterator it = *this;
+    ++m_index;
+    return it;
+  }
+
+  soa_iterator &operator--() {
+    --m_index;
+    return *this;
+  }
+
+  soa_iterator operator--(int) {
+    soa_iterator it = *this;
+    --m_index;
+    return it;
+  }
+
+  soa_iterator &operator+=(difference_type off) {
+    m_index += off;
+    return *this;
+  }
+
+  soa_iterator &operator-=(difference_type off) {
+    m_index -= off;
+    return *this;
+  }
+
+  soa_iterator operator+(difference_type off) const {
+    return soa_iterator(m_container, m_index + off);
+  }
+
+  soa_iterator operator-(difference_type off) const {
+    return soa_iterator(m_container, m_index - off);
+  }
+
+  difference_type operator-(const soa_iterator &right) const {
+    return difference_type(m_index) - difference_type(right.m_index);
+  }
+
+  bool operator==(const soa_iterator &right) const {
+    return m_index == right.m_index;
+  }
+  bool operator!=(const soa_iterator &right) const {
+    return m_index != right.m_index;
+  }
+  bool operator<(const soa_iterator &right) const {
+    return m_index < right.m_index;
+  }
+
+ private:
+  Container *m_container;
+  std::size_t m_index;
+};
+
+}  // namespace internal
+
+/*
+    A sequence of records stored column by column ("structure of arrays").
+
+    Template Parameters:
+        - Allocator: The allocator; it is rebound to allocate each column.
+        - Ts: The types of the record fields, one column each.
+
+    soa_vector<float, float, int> behaves like a vector of
+   std::tuple<float, float, int>, but keeps every field in its own
+   contiguous array. A loop that reads only one or two fields then streams
+   through exactly the bytes it needs instead of dragging whole records
+   through the cache, and each column is a plain array the compiler can
+   vectorize over. data<I>() returns column I as a span.
+
+    The allocator comes first because the fields are a parameter pack;
+   soa_vector<Ts...> is basic_soa_vector with the default allocator.
+
+    operator[] returns a std::tuple of references into the columns, which
+   supports structured bindings and assigning a whole record. All columns
+   grow together, geometrically, so push_back is amortized O(1). Growing
+   invalidates all iterators, pointers and references.
+*/
+template <typename Allocator, typename... Ts>
+class basic_soa_vector {
+  static_assert(sizeof...(Ts) > 0, "soa_vector needs at least one column");
+
+  using indices = std::index_sequence_for<Ts...>;
+
+ public:
+  using value_type = std::tuple<Ts...>;
+  using reference = std::tuple<Ts &...>;
+  using const_reference = std::tuple<const Ts &...>;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using allocator_type = Allocator;
+  using iterator = internal::soa_iterator<basic_soa_vector, reference>;
+  using const_iterator =
+      internal::soa_iterator<const basic_soa_vector, const_reference>;
+
+  // The type of column I.
+  template <std::size_t I>
+  using column_type = std::tuple_element_t<I, value_type>;
+
+  // Default constructor
+  basic_soa_vector() : m_columns(), m_size(0), m_capacity(0) {}
+
+  // Constructor creating `count` value-initialized records
+  explicit basic_soa_vector(size_type count) : basic_soa_vector() {
+    resize(count);
+  }
+
+  // Copy constructor
+  basic_soa_vector(const basic_soa_vector &right) : basic_soa_vector() {
+    reserve(right.m_size);
+    copy_columns(right, indices());
+    m_size = right.m_size;
+  }
+
+  // Move constructor
+  basic_soa_vector(basic_soa_vector &&right)
+      : m_columns(right.m_columns),
+        m_size(right.m_size),
+        m_capacity(right.m_capacity) {
+    right.m_columns = columns();
+    right.m_size = 0;
+    right.m_capacity = 0;
+  }
+
+  // Copy and move assignment operator
+  basic_soa_vector &operator=(basic_soa_vector right) {
+    swap(right);
+    return *this;
+  }
+
+  // Destructor
+  ~basic_soa_vector() { deallocate(m_columns, indices()); }
+
+  // Returns the number of records
+  size_type size() const { return m_size; }
+
+  // Returns the number of records that fit without reallocating
+  size_type capacity() const { return m_capacity; }
+
+  // Checks whether the vector is empty
+  bool empty() const { return m_size == 0; }
+
+  // Returns column I, one element per record
+  template <std::size_t I>
+  span<column_type<I>> data() {
+    return span<column_type<I>>(std::get<I>(m_columns), m_size);
+  }
+
+  // Returns column I, one element per record, read-only
+  template <std::size_t I>
+  span<const column_type<I>> data() const {
+    return span<const column_type<I>>(std::get<I>(m_columns), m_size);
+  }
+
+  // Returns references to the fields of record `index`
+  reference operator[](size_type index) {
+    return record<reference>(m_columns, index, indices());
+  }
+
+  // Returns const references to the fields of record `index`
+  const_reference operator[](size_type index) const {
+    return record<const_reference>(m_columns, index, indices());
+  }
+
+  // Returns references to the fields of record `index`; throws
+  // std::out_of_range if `index` is not less than size().
+  reference at(size_type index) {
+    check_index(index);
+    return (*this)[index];
+  }
+
+  // Returns const references to the fields of record `index`; throws
+  // std::out_of_range if `index` is not less than size().
+  const_reference at(size_type index) const {
+    check_index(index);
+    return (*this)[index];
+  }
+
+  // Returns references to the first record
+  reference front() { return (*this)[0]; }
+
+  // Returns const references to the first record
+  const_reference front() const { return (*this)[0]; }
+
+  // Returns references to the last record
+  reference back() { return (*this)[m_size - 1]; }
+
+  // Returns const references to the last record
+  const_reference back() const { return (*this)[m_size - 1]; }
+
+  // Returns an iterator to the first record
+  iterator begin() { return iterator(this, 0); }
+
+  // Returns a const iterator to the first record
+  const_iterator begin() const { return const_iterator(this, 0); }
+
+  // Returns an iterator past the last record
+  iterator end() { return iterator(this, m_size); }
+
+  // Returns a const iterator past the last record
+  const_iterator end() const { return const_iterator(this, m_size); }
+
+  // Grows every column so `count` records fit without reallocating.
+  void reserve(size_type count) {
+    if (count > m_capacity) re_allocate(count);
+  }
+
+  // Changes the number of records; new records are value-initialized.
+  void resize(size_type count) {
+    if (count < m_size) {
+      reset(count, m_size, indices());
+    } else {
+      reserve(count);
+      reset(m_size, count, indices());
+    }
+    m_size = count;
+  }
+
+  // Removes every record, keeping the capacity.
+  void clear() { resize(0); }
+
+  // Appends a record given one value per column.
+  void push_back(const Ts &...values) {
+    expand_capacity();
+    assign(m_size, indices(), values...);
+    m_size++;
+  }
+
+  // Appends a record given as a tuple.
+  void push_back(const value_type &value) {
+    std::apply([this](const Ts &...values) { push_back(values...); }, value);
+  }
+
+  // Appends a record, constructing each field from the matching argument.
+  // Returns references to the new record.
+  template <typename... Args>
+    requires(sizeof...(Args) == sizeof...(Ts))
+  reference emplace_back(Args &&...args) {
+    expand_capacity();
+    assign(m_size, indices(), open_stl::forward<Args>(args)...);
+    m_size++;
+    return back();
+  }
+
+  // Removes the last record.
+  void pop_back() {
+    reset(m_size - 1, m_size, indices());
+    m_size--;
+  }
+
+  // Swaps the contents of two vectors.
+  void swap(basic_soa_vector &right) {
+    open_stl::swap(m_columns, right.m_columns);
+    open_stl::swap(m_size, right.m_size);
+    open_stl::swap(m_capacity, right.m_capacity);
+  }
+
+  // Checks if this vector holds the same records as another vector.
+  bool operator==(const basic_soa_vector &right) const {
+    if (m_size != right.m_size) return false;
+    for (size_type i = 0; i < m_size; i++) {
+      if ((*this)[i] != right[i]) return false;
+    }
+    return true;
+  }
+
+  // Checks if this vector differs from another vector.
+  bool operator!=(const basic_soa_vector &right) const {
+    return !(*this == right);
+  }
+
+ private:
+  using columns = std::tuple<Ts *...>;
+
+  template <typename T>
+  using column_allocator = typename Allocator::template rebind<T>::other;
+
+  columns m_columns;
+  size_type m_size;
+  size_type m_capacity;
+
+  template <typename Reference, std::size_t... I>
+  static Reference record(const columns &data, size_type index,
+                          std::index_sequence<I...>) {
+    return Reference(std::get<I>(data)[index]...);
+  }
+
+  template <std::size_t... I, typename... Args>
+  void assign(size_type index, std::index_sequence<I...>, Args &&...args) {
+    ((std::get<I>(m_columns)[index] =
+          column_type<I>(open_stl::forward<Args>(args))),
+     ...);
+  }
+
+  // Value-initializes the records in [first, last). The allocator only
+  // default-initializes, so this also runs before slots become records.
+  template <std::size_t... I>
+  void reset(size_type first, size_type last, std::index_sequence<I...>) {
+    for (size_type i = first; i < last; i++) {
+      ((std::get<I>(m_columns)[i] = column_type<I>()), ...);
+    }
+  }
+
+  template <std::size_t... I>
+  void copy_columns(const basic_soa_vector &right,
+                    std::index_sequence<I...>) {
+    for (size_type i = 0; i < right.m_size; i++) {
+      ((std::get<I>(m_columns)[i] = std::get<I>(right.m_columns)[i]), ...);
+    }
+  }
+
+  template <std::size_t... I>
+  static void deallocate(columns &data, std::index_sequence<I...>) {
+    (deallocate_column(std::get<I>(data)), ...);
+  }
+
+  template <typename T>
+  static void deallocate_column(T *column) {
+    column_allocator<T> alloc;
+    alloc.deallocate(column);
+  }
+
+  template <typename T>
+  T *grow_column(T *column, size_type new_capacity) {
+    column_allocator<T> alloc;
+    T *new_column = alloc.allocate(new_capacity);
+    for (size_type i = 0; i < m_size; i++) {
+      new_column[i] = move(column[i]);
+    }
+    alloc.deallocate(column);
+    return new_column;
+  }
+
+  void re_allocate(size_type new_capacity) {
+    std::apply(
+        [this, new_capacity](Ts *&...column) {
+          ((column = grow_column(column, new_capacity)), ...);
+        },
+        m_columns);
+    m_capacity = new_capacity;
+  }
+
+  // Makes room for one more record, doubling the capacity when full.
+  void expand_capacity() {
+    if (m_size == m_capacity) re_allocate(m_capacity == 0 ? 1 : 2 * m_capacity);
+  }
+
+  void check_index(size_type index) const {
+    if (index >= m_size) {
+      throw std::out_of_range(
+          "Error: Index out of range in soa_vector. Please ensure the index "
+          "is within the valid range of records.");
+    }
+  }
+};
+
+// A basic_soa_vector using the default allocator.
+template <typename... Ts>
+using soa_vector = basic_soa_vector<allocator<std::tuple<Ts...>>, Ts...>;
+}  // namespace open_stl
+
+#endif  // OPEN_STL_SOA_VECTOR_H_
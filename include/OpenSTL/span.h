@@ -0,0 +1,358 @@
+#ifndef OPEN_STL_SPAN_H_
+#define OPEN_STL_SPAN_H_
+
+#include <OpenSTL/algorithm.h>
+#include <OpenSTL/array.h>
+
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+
+namespace open_stl {
+// The extent of a span whose length is only known at run time.
+inline constexpr std::size_t dynamic_extent = std::size_t(-1);
+
+template <typename T, std::size_t Extent>
+class span;
+
+namespace internal {
+
+// The length of a span, stored only when it is not part of the type.
+template <std::size_t Extent>
+struct span_extent {
+  constexpr explicit span_extent(std::size_t) {}
+  static constexpr std::size_t size() { return Extent; }
+};
+
+template <>
+struct span_extent<dynamic_extent> {
+  constexpr explicit span_extent(std::size_t size) : m_size(size) {}
+  constexpr std::size_t size() const { return m_size; }
+
+  std::size_t m_size;
+};
+
+// True if a `From` array may be viewed through a `To` pointer, which only
+// allows adding const.
+template <typename From, typename To>
+inline constexpr bool is_span_compatible_v =
+    std::is_convertible_v<From (*)[], To (*)[]>;
+
+// True for contiguous containers with data() and size(), such as vector,
+// array and string, whose elements a span of `T` can view.
+template <typename Container, typename T>
+concept span_container =
+    !std::is_array_v<std::remove_cvref_t<Container>> &&
+    requires(Container &container) {
+      container.data();
+      container.size();
+    } &&
+    is_span_compatible_v<
+        std::remove_pointer_t<decltype(std::declval<Container &>().data())>,
+        T>;
+
+}  // namespace internal
+
+/*
+    A non-owning view of a contiguous sequence of elements.
+
+    Template Parameters:
+        - T: The element type; const-qualify it for a read-only view.
+        - Extent: The number of elements, or dynamic_extent if it is only
+       known at run time.
+
+    A span is a pointer and, for a dynamic extent, a length; copying one
+   copies two words and never the elements. Slicing with first(), last() and
+   subspan() is O(1), so a parser can hand out pieces of an input buffer
+   without allocating. A span with a static extent stores just the pointer.
+
+    A span does not extend the lifetime of what it views: it dangles once
+   the vector is resized or destroyed. Slicing is not bounds checked; at()
+   is.
+*/
+template <typename T, std::size_t Extent = dynamic_extent>
+class span {
+ public:
+  using element_type = T;
+  using value_type = std::remove_cv_t<T>;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using pointer = T *;
+  using const_pointer = const T *;
+  using reference = T &;
+  using const_reference = const T &;
+  using iterator = T *;
+
+  static constexpr size_type extent = Extent;
+
+  // Default constructor, making an empty span; only a span with extent 0 or
+  // dynamic_extent can be empty.
+  constexpr span()
+    requires(Extent == 0 || Extent == dynamic_extent)
+      : m_data(nullptr), m_extent(0) {}
+
+  // Constructor viewing `count` elements starting at `first`. For a static
+  // extent, `count` must equal Extent.
+  constexpr explicit(Extent != dynamic_extent)
+      span(pointer first, size_type count)
+      : m_data(first), m_extent(count) {}
+
+  // Constructor viewing the elements [first, last).
+  constexpr explicit(Extent != dynamic_extent) span(pointer first, pointer last)
+      : m_data(first), m_extent(size_type(last - first)) {}
+
+  // Constructor viewing a built-in array.
+  template <std::size_t N>
+    requires(Extent == dynamic_extent || Extent == N)
+  constexpr span(element_type (&values)[N]) : m_data(values), m_extent(N) {}
+
+  // Constructor viewing an open_stl::array.
+  template <typename U, std::size_t N>
+    requires((Extent == dynamic_extent || Extent == N) &&
+             internal::is_span_compatible_v<U, T>)
+  constexpr span(array<U, N> &values) : m_data(values.data()), m_extent(N) {}
+
+  // Constructor viewing a const open_stl::array.
+  template <typename U, std::size_t N>
+    requires((Extent == dynamic_extent || Extent == N) &&
+             internal::is_span_compatible_v<const U, T>)
+  constexpr span(const array<U, N> &values)
+      : m_data(values.data()), m_extent(N) {}
+
+  // Constructor viewing the elements of a contiguous container such as a
+  // vector or string. For a static extent, its size must equal Extent.
+  template <typename Container>
+    requires internal::span_container<Container, T>
+  constexpr explicit(Extent != dynamic_extent) span(Container &container)
+      : m_data(container.data()), m_extent(container.size()) {}
+
+  // Constructor viewing the elements of a const contiguous container.
+  template <typename Container>
+    requires internal::span_container<const Container, T>
+  constexpr explicit(Extent != dynamic_extent) span(const Container &container)
+      : m_data(container.data()), m_extent(container.size()) {}
+
+  // Converts from a span of less const-qualified elements, or from a static
+  // extent to a dynamic one.
+  template <typename U, std::size_t OtherExtent>
+    requires((Extent == dynamic_extent || Extent == OtherExtent) &&
+             internal::is_span_compatible_v<U, T>)
+  constexpr explicit(Extent != dynamic_extent &&
+                     OtherExtent == dynamic_extent)
+      span(const span<U, OtherExtent> &other)
+      : m_data(other.data()), m_extent(other.size()) {}
+
+  // Returns a pointer to the first element
+  constexpr pointer data() const { return m_data; }
+
+  // Returns the number of elements
+  constexpr size_type size() const { return m_extent.size(); }
+
+  // Returns the number of bytes the elements occupy
+  constexpr size_type size_bytes() const { return size() * sizeof(T); }
+
+  // Checks whether the span is empty
+  constexpr bool empty() const { return size() == 0; }
+
+  // Returns an iterator to the first element
+  constexpr iterator begin() const { return m_data; }
+
+  // Returns an iterator past the last element
+  constexpr iterator end() const { return m_data + size(); }
+
+  // Returns the element at `index`, which must be less than size()
+  constexpr reference operator[](size_type index) const {
+    return m_data[index];
+  }
+
+  // Returns the element at `index`; throws std::out_of_range if `index` is
+  // not less than size().
+  constexpr reference at(size_type index) const {
+    if (index >= size()) {
+      throw std::out_of_range(
+          "Error: span index out of range. Please ensure the index is within "
+          "the valid range.");
+    }
+    return m_data[index];
+  }
+
+  // Returns the first element
+  constexpr reference front() const { return m_data[0]; }
+
+  // Returns the last element
+  constexpr reference back() const { return m_data[size() - 1]; }
+
+  // Returns a span of the first Count elements
+  template <std::size_t Count>
+  constexpr span<T, Count> first() const {
+    static_assert(Extent == dynamic_extent || Count <= Extent,
+                  "span::first takes more elements than the span has");
+    return span<T, Count>(m_data, Count);
+  }
+
+  // Returns a span of the first `count` elements
+  constexpr span<T> first(size_type count) const {
+    return span<T>(m_data, count);
+  }
+
+  // Returns a span of the last Count elements
+  template <std::size_t Count>
+  constexpr span<T, Count> last() const {
+    static_assert(Extent == dynamic_extent || Count <= Extent,
+                  "span::last takes more elements than the span has");
+    return span<T, Count>(m_data + (size() - Count), Count);
+  }
+
+  // Returns a span of the last `count` elements
+  constexpr span<T> last(size_type count) const {
+    return span<T>(m_data + (size() - count), count);
+  }
+
+  /*
+      Returns a span of Count elements starting at Offset.
+
+      Template Parameters:
+          - Offset: The index of the first element of the result.
+          - Count: The number of elements, or dynamic_extent for all of the
+         remaining ones.
+
+      Returns:
+          - The subspan; its extent is static whenever it can be computed
+         from the template arguments.
+  */
+  template <std::size_t Offset, std::size_t Count = dynamic_extent>
+  constexpr auto subspan() const {
+    static_assert(Extent == dynamic_extent ||
+                      (Offset <= Extent &&
+                       (Count == dynamic_extent || Count <= Extent - Offset)),
+                  "span::subspan is out of range");
+    constexpr std::size_t result_extent =
+        Count != dynamic_extent
+            ? Count
+            : (Extent != dynamic_extent ? Extent - Offset : dynamic_extent);
+    return span<T, result_extent>(
+        m_data + Offset, Count == dynamic_extent ? size() - Offset : Count);
+  }
+
+  // Returns a span of `count` elements starting at `offset`, or of all the
+  // elements from `offset` on if `count` is dynamic_extent.
+  constexpr span<T> subspan(size_type offset,
+                            size_type count = dynamic_extent) const {
+    return span<T>(m_data + offset,
+                   count == dynamic_extent ? size() - offset : count);
+  }
+
+ private:
+  pointer m_data;
+  [[no_unique_address]] internal::span_extent<Extent> m_extent;
+};
+
+template <typename T, std::size_t N>
+span(T (&)[N]) -> span<T, N>;
+
+template <typename T, std::size_t N>
+span(array<T, N> &) -> span<T, N>;
+
+template <typename T, std::size_t N>
+span(const array<T, N> &) -> span<const T, N>;
+
+template <typename Container>
+span(Container &) -> span<std::remove_pointer_t<
+    decltype(std::declval<Container &>().data())>>;
+
+template <typename Container>
+span(const Container &) -> span<std::remove_pointer_t<
+    decltype(std::declval<const Container &>().data())>>;
+
+// Views the elements of a span as read-only bytes.
+template <typename T, std::size_t Extent>
+span<const std::byte> as_bytes(span<T, Extent> values) {
+  return span<const std::byte>(
+      reinterpret_cast<const std::byte *>(values.data()), values.size_bytes());
+}
+
+// Views the elements of a span as writable bytes.
+template <typename T, std::size_t Extent>
+  requires(!std::is_const_v<T>)
+span<std::byte> as_writable_bytes(span<T, Extent> values) {
+  return span<std::byte>(reinterpret_cast<std::byte *>(values.data()),
+                         values.size_bytes());
+}
+
+// Sorts the elements of a span with `comp`.
+template <typename T, std::size_t Extent, typename Compare>
+constexpr void sort(span<T, Extent> values, Compare comp) {
+  open_stl::sort(values.begin(), values.end(), comp);
+}
+
+// Sorts the elements of a span in ascending order.
+template <typename T, std::size_t Extent>
+constexpr void sort(span<T, Extent> values) {
+  open_stl::sort(values.begin(), values.end());
+}
+
+// Assigns `value` to every element of a span.
+template <typename T, std::size_t Extent, typename U>
+constexpr void fill(span<T, Extent> values, const U &value) {
+  open_stl::fill(values.begin(), values.end(), value);
+}
+
+// Applies `op` to every element of a span and stores the results from
+// `d_first` on, returning an iterator past the last element written.
+template <typename T, std::size_t Extent, typename OutputIterator,
+          typename UnaryOperation>
+constexpr OutputIterator transform(span<T, Extent> values,
+                                   OutputIterator d_first, UnaryOperation op) {
+  return open_stl::transform(values.begin(), values.end(), d_first, op);
+}
+
+// Returns an iterator to the first element of a sorted span that is not
+// ordered before `value` by `comp`.
+template <typename T, std::size_t Extent, typename U, typename Compare>
+constexpr T *lower_bound(span<T, Extent> values, const U &value,
+                         Compare comp) {
+  return open_stl::lower_bound(values.begin(), values.end(), value, comp);
+}
+
+// Returns an iterator to the first element of a sorted span that is not
+// less than `value`.
+template <typename T, std::size_t Extent, typename U>
+constexpr T *lower_bound(span<T, Extent> values, const U &value) {
+  return open_stl::lower_bound(values.begin(), values.end(), value);
+}
+
+// Returns an iterator to the first element of a sorted span that `value` is
+// ordered before by `comp`.
+template <typename T, std::size_t Extent, typename U, typename Compare>
+constexpr T *upper_bound(span<T, Extent> values, const U &value,
+                         Compare comp) {
+  return open_stl::upper_bound(values.begin(), values.end(), value, comp);
+}
+
+// Returns an iterator to the first element of a sorted span that is greater
+// than `value`.
+template <typename T, std::size_t Extent, typename U>
+constexpr T *upper_bound(span<T, Extent> values, const U &value) {
+  return open_stl::upper_bound(values.begin(), values.end(), value);
+}
+
+// Checks whether a sorted span holds an element equivalent to `value`.
+template <typename T, std::size_t Extent, typename U>
+constexpr bool binary_search(span<T, Extent> values, const U &value) {
+  return open_stl::binary_search(values.begin(), values.end(), value);
+}
+
+// Checks whether two spans hold equal elements.
+template <typename T, std::size_t Extent, typename U, std::size_t OtherExtent>
+constexpr bool equal(span<T, Extent> lhs, span<U, OtherExtent> rhs) {
+  const T *lhs_data = lhs.data();
+  const U *rhs_data = rhs.data();
+  if (lhs.size() != rhs.size()) return false;
+  for (std::size_t i = 0; i < lhs.size(); i++) {
+    if (lhs_data[i] != rhs_data[i]) return false;
+  }
+  return true;
+}
+}  // namespace open_stl
+
+#endif  // OPEN_STL_SPAN_H_
@@ -0,0 +1,178 @@
+#ifndef OPEN_STL_SPSC_QUEUE_H_
+#define OPEN_STL_SPSC_QUEUE_H_
+
+#include <OpenSTL/internal/prefetch.h>
+#include <OpenSTL/ring_buffer.h>
+#include <OpenSTL/utility.h>
+
+#include <atomic>
+#include <cstddef>
+
+namespace open_stl {
+/*
+    A bounded wait-free queue for exactly one producer thread and one
+   consumer thread.
+
+    Template Parameters:
+        - T: The type of the elements.
+        - N: The capacity; must be a power of two.
+
+    The elements live in a ring of N slots held inline in an array, so the
+   queue never allocates. The producer owns the tail index and the consumer
+   the head index; each sits on its own cache line, next to a private copy
+   of the other side's index. A side only reloads the shared index of its
+   peer when its cached copy says the queue is full (or empty), so in steady
+   state each operation touches one shared cache line instead of two.
+   Every operation finishes in a bounded number of steps whatever the other
+   thread does.
+
+    try_push_n() and try_pop_n() move whole batches with at most two copies
+   each (memcpy for trivially copyable types) and publish them with a single
+   atomic store, which amortizes the synchronization over the batch.
+
+    Only the producer thread may call the push functions and only the
+   consumer thread the pop functions; size() and empty() may be called from
+   either and return a snapshot.
+*/
+template <typename T, std::size_t N>
+class spsc_queue {
+ public:
+  using value_type = T;
+  using size_type = std::size_t;
+
+  // Default constructor; the queue is empty.
+  spsc_queue() : m_producer(), m_consumer(), m_slots() {}
+
+  spsc_queue(const spsc_queue &) = delete;
+  spsc_queue &operator=(const spsc_queue &) = delete;
+
+  // Returns the maximum number of elements
+  static constexpr size_type capacity() { return N; }
+
+  // Returns the number of elements at some instant during the call.
+  size_type size() const {
+    size_type head = m_consumer.head.load(std::memory_order_acquire);
+    size_type tail = m_producer.tail.load(std::memory_order_acquire);
+    return tail - head;
+  }
+
+  // Checks whether the queue was empty at some instant during the call.
+  bool empty() const { return size() == 0; }
+
+  // Appends a copy of `value`. Returns false if the queue is full.
+  bool try_push(const value_type &value) { return try_push_n(&value, 1) == 1; }
+
+  // Appends `value` by moving it. Returns false, leaving `value` untouched,
+  // if the queue is full.
+  bool try_push(value_type &&value) {
+    size_type tail = m_producer.tail.load(std::memory_order_relaxed);
+    if (free_slots(tail, 1) == 0) return false;
+    m_slots.slots()[tail & mask] = move(value);
+    m_producer.tail.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+  // Constructs an element from `args` and appends it. Returns false if the
+  // queue is full, in which case nothing is constructed.
+  template <typename... Args>
+  bool try_emplace(Args &&...args) {
+    size_type tail = m_producer.tail.load(std::memory_order_relaxed);
+    if (free_slots(tail, 1) == 0) return false;
+    m_slots.slots()[tail & mask] = value_type(open_stl::forward<Args>(args)...);
+    m_producer.tail.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+  /*
+      Appends up to `count` values from `source`.
+
+      Returns:
+          - The number of values appended, which is `count` limited to the
+     free space. The consumer sees all of them at once.
+  */
+  size_type try_push_n(const value_type *source, size_type count) {
+    size_type tail = m_producer.tail.load(std::memory_order_relaxed);
+    size_type free = free_slots(tail, count);
+    if (count > free) count = free;
+    if (count == 0) return 0;
+    size_type offset = tail & mask;
+    size_type first = count < N - offset ? count : N - offset;
+    internal::copy_elements(source, first, m_slots.slots() + offset);
+    internal::copy_elements(source + first, count - first, m_slots.slots());
+    m_producer.tail.store(tail + count, std::memory_order_release);
+    return count;
+  }
+
+  // Moves the first element into `value`. Returns false, leaving `value`
+  // untouched, if the queue is empty.
+  bool try_pop(value_type &value) { return try_pop_n(&value, 1) == 1; }
+
+  /*
+      Moves up to `count` elements from the front into `destination`.
+
+      Returns:
+          - The number of elements removed, which is `count` limited to the
+     number available.
+  */
+  size_type try_pop_n(value_type *destination, size_type count) {
+    size_type head = m_consumer.head.load(std::memory_order_relaxed);
+    size_type available = available_slots(head, count);
+    if (count > available) count = available;
+    if (count == 0) return 0;
+    size_type offset = head & mask;
+    size_type first = count < N - offset ? count : N - offset;
+    internal::move_elements(m_slots.slots() + offset, first, destination);
+    internal::move_elements(m_slots.slots(), count - first,
+                            destination + first);
+    m_consumer.head.store(head + count, std::memory_order_release);
+    return count;
+  }
+
+ private:
+  static constexpr size_type mask = N - 1;
+
+  // The indices count every element ever pushed or popped and are reduced
+  // with `mask` only to address a slot; since N divides 2^64, the
+  // differences stay correct when they wrap.
+  struct alignas(internal::cache_line_size) producer_side {
+    std::atomic<size_type> tail{0};
+    // The consumer's head as last seen by the producer.
+    size_type cached_head = 0;
+  };
+
+  struct alignas(internal::cache_line_size) consumer_side {
+    std::atomic<size_type> head{0};
+    // The producer's tail as last seen by the consumer.
+    size_type cached_tail = 0;
+  };
+
+  producer_side m_producer;
+  consumer_side m_consumer;
+  alignas(internal::cache_line_size) internal::fixed_ring_storage<T, N>
+      m_slots;
+
+  // Returns the free slots the producer can count on, reloading the head
+  // only when the cached one leaves fewer than `wanted`.
+  size_type free_slots(size_type tail, size_type wanted) {
+    size_type free = N - (tail - m_producer.cached_head);
+    if (free < wanted) {
+      m_producer.cached_head = m_consumer.head.load(std::memory_order_acquire);
+      free = N - (tail - m_producer.cached_head);
+    }
+    return free;
+  }
+
+  // Returns the elements the consumer can count on, reloading the tail only
+  // when the cached one shows fewer than `wanted`.
+  size_type available_slots(size_type head, size_type wanted) {
+    size_type available = m_consumer.cached_tail - head;
+    if (available < wanted) {
+      m_consumer.cached_tail = m_producer.tail.load(std::memory_order_acquire);
+      available = m_consumer.cached_tail - head;
+    }
+    return available;
+  }
+};
+}  // namespace open_stl
+
+#endif  // OPEN_STL_SPSC_QUEUE_H_
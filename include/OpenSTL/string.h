@@ -0,0 +1,633 @@
+#ifndef OPEN_STL_STRING_H_
+#define OPEN_STL_STRING_H_
+
+#include <OpenSTL/memory.h>
+#include <OpenSTL/string_view.h>
+#include <OpenSTL/utility.h>
+
+#include <bit>
+#include <climits>
+#include <cstddef>
+#include <cstring>
+#include <initializer_list>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+namespace open_stl {
+/*
+    A contiguous, null-terminated sequence of characters with small-string
+   optimization.
+
+    Template Parameters:
+        - CharT: The character type.
+        - Allocator: The allocator used for strings too long to store inline.
+
+    The string object is three words, a pointer, a size and a capacity. A
+   string short enough to fit in those words minus one character, 23 chars
+   on a 64-bit platform, is stored inline in them and allocates nothing.
+   The last character of the object tells the two layouts apart. Inline, it
+   holds the number of unused inline characters, so it is zero exactly when
+   the string is full and then doubles as the null terminator. On the heap,
+   its top bit is set, which the capacity word is encoded to guarantee.
+
+    Growth is geometric, so a series of append() or reserve() calls costs
+   amortized constant time per character. Character operations go through
+   std::char_traits<CharT>.
+*/
+template <typename CharT, typename Allocator = allocator<CharT>>
+class basic_string {
+  using traits = std::char_traits<CharT>;
+  using tag_type = std::make_unsigned_t<CharT>;
+  using view_type = basic_string_view<CharT>;
+
+  struct heap_rep {
+    CharT *data;
+    std::size_t size;
+    // The capacity, encoded so that the last character of the object has
+    // its top bit set.
+    std::size_t capacity_word;
+  };
+
+ public:
+  using value_type = CharT;
+  using allocator_type = Allocator;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference = CharT &;
+  using const_reference = const CharT &;
+  using pointer = CharT *;
+  using const_pointer = const CharT *;
+  using iterator = CharT *;
+  using const_iterator = const CharT *;
+
+  // Returned by find() when nothing matches, and meaning "to the end" as a
+  // count.
+  static constexpr size_type npos = size_type(-1);
+
+  // The longest string stored without allocating.
+  static constexpr size_type inline_capacity =
+      sizeof(heap_rep) / sizeof(CharT) - 1;
+
+  // Default constructor
+  basic_string() { set_inline_size(0); }
+
+  // Constructor taking a null-terminated string
+  basic_string(const CharT *chars) { init(chars, traits::length(chars)); }
+
+  // Constructor taking the first `count` characters of `chars`
+  basic_string(const CharT *chars, size_type count) { init(chars, count); }
+
+  // Constructor with `count` copies of `ch`
+  basic_string(size_type count, CharT ch) {
+    init_uninitialized(count);
+    traits::assign(data(), count, ch);
+  }
+
+  // Constructor copying the characters of a view
+  explicit basic_string(view_type view) { init(view.data(), view.size()); }
+
+  // Constructor taking an std::initializer_list of characters
+  basic_string(std::initializer_list<CharT> chars) {
+    init(chars.begin(), chars.size());
+  }
+
+  // Copy constructor
+  basic_string(const basic_string &right) {
+    if (right.is_long()) {
+      init(right.m_heap.data, right.m_heap.size);
+    } else {
+      // A fixed-size copy of the whole object beats copying size() chars.
+      std::memcpy(static_cast<void *>(this), &right, sizeof(basic_string));
+    }
+  }
+
+  // Move constructor
+  basic_string(basic_string &&right) {
+    std::memcpy(static_cast<void *>(this), &right, sizeof(basic_string));
+    right.set_inline_size(0);
+  }
+
+  // Destructor
+  ~basic_string() { release(); }
+
+  // Copy assignment operator
+  basic_string &operator=(const basic_string &right) {
+    if (this != &right) assign(right.data(), right.size());
+    return *this;
+  }
+
+  // Move assignment operator
+  basic_string &operator=(basic_string &&right) {
+    if (this != &right) {
+      release();
+      std::memcpy(static_cast<void *>(this), &right, sizeof(basic_string));
+      right.set_inline_size(0);
+    }
+    return *this;
+  }
+
+  // Assigns a null-terminated string
+  basic_string &operator=(const CharT *chars) {
+    return assign(chars, traits::length(chars));
+  }
+
+  // Replaces the contents with the first `count` characters of `chars`,
+  // which may point into this string.
+  basic_string &assign(const CharT *chars, size_type count) {
+    if (count <= capacity()) {
+      traits::move(data(), chars, count);
+      set_size(count);
+    } else {
+      CharT *buffer = allocate_buffer(count);
+      traits::copy(buffer, chars, count);
+      release();
+      set_heap(buffer, count, count);
+    }
+    return *this;
+  }
+
+  // Returns a pointer to the characters
+  CharT *data() { return is_long() ? m_heap.data : m_inline; }
+
+  // Returns a const pointer to the characters
+  const CharT *data() const { return is_long() ? m_heap.data : m_inline; }
+
+  // Returns a pointer to the null-terminated characters
+  const CharT *c_str() const { return data(); }
+
+  // Returns a view of the characters, valid until the string is modified
+  view_type view() const { return view_type(data(), size()); }
+
+  // Converts to a view of the characters
+  operator view_type() const { return view(); }
+
+  // Returns the number of characters
+  size_type size() const {
+    return is_long() ? m_heap.size : inline_capacity - tag();
+  }
+
+  // Returns the number of characters
+  size_type length() const { return size(); }
+
+  // Returns how many characters fit without reallocating
+  size_type capacity() const {
+    return is_long() ? decode_capacity(m_heap.capacity_word) : inline_capacity;
+  }
+
+  // Checks whether the string is empty
+  bool empty() const { return size() == 0; }
+
+  // Checks whether the characters live inline rather than on the heap
+  bool is_inline() const { return !is_long(); }
+
+  // Returns an iterator to the first character
+  iterator begin() { return data(); }
+
+  // Returns a const iterator to the first character
+  const_iterator begin() const { return data(); }
+
+  // Returns a const iterator to the first character
+  const_iterator cbegin() const { return data(); }
+
+  // Returns an iterator past the last character
+  iterator end() { return data() + size(); }
+
+  // Returns a const iterator past the last character
+  const_iterator end() const { return data() + size(); }
+
+  // Returns a const iterator past the last character
+  const_iterator cend() const { return end(); }
+
+  // Returns the character at `position`, which must be at most size(); the
+  // character at size() is the null terminator.
+  reference operator[](size_type position) { return data()[position]; }
+
+  // Returns the character at `position` (const version)
+  const_reference operator[](size_type position) const {
+    return data()[position];
+  }
+
+  // Returns the character at `position`; throws std::out_of_range if
+  // `position` is not less than size().
+  reference at(size_type position) {
+    if (position >= size()) throw_out_of_range();
+    return data()[position];
+  }
+
+  // Returns the character at `position` (const version)
+  const_reference at(size_type position) const {
+    if (position >= size()) throw_out_of_range();
+    return data()[position];
+  }
+
+  // Returns the first character
+  reference front() { return data()[0]; }
+
+  // Returns the first character (const version)
+  const_reference front() const { return data()[0]; }
+
+  // Returns the last character
+  reference back() { return data()[size() - 1]; }
+
+  // Returns the last character (const version)
+  const_reference back() const { return data()[size() - 1]; }
+
+  /*
+      Reserves space for at least `count` characters.
+
+      Parameters:
+          - count: The number of characters to make room for.
+
+      Unlike std::string::reserve, the new capacity is at least twice the
+     old one, so reserving a little more before each append still costs
+     amortized constant time per character.
+  */
+  void reserve(size_type count) {
+    if (count > capacity()) reallocate(grown_capacity(count));
+  }
+
+  // Releases unused heap capacity, moving the characters back inline when
+  // they fit.
+  void shrink_to_fit() {
+    if (!is_long()) return;
+    size_type count = m_heap.size;
+    if (count <= inline_capacity) {
+      CharT *buffer = m_heap.data;
+      traits::copy(m_inline, buffer, count);
+      set_inline_size(count);
+      deallocate_buffer(buffer);
+    } else if (count < capacity()) {
+      reallocate(count);
+    }
+  }
+
+  // Removes every character, keeping the capacity
+  void clear() { set_size(0); }
+
+  // Resizes to `count` characters, appending copies of `ch` if it grows.
+  void resize(size_type count, CharT ch = CharT()) {
+    size_type old_size = size();
+    if (count > old_size) {
+      reserve(count);
+      traits::assign(data() + old_size, count - old_size, ch);
+    }
+    set_size(count);
+  }
+
+  /*
+      Resizes to at most `count` characters whose contents are written by a
+     callback, without initializing them first.
+
+      Template Parameters:
+          - Operation: Called as op(CharT *data, size_type count).
+
+      Parameters:
+          - count: The number of characters the callback may write.
+          - op: Writes up to `count` characters starting at `data` and
+         returns how many of them to keep.
+
+      Characters [0, size()) keep their values when op is called. This
+     avoids zero-filling a buffer that is about to be overwritten, for
+     example by a formatting or decoding routine.
+  */
+  template <typename Operation>
+  void resize_and_overwrite(size_type count, Operation op) {
+    if (count > capacity()) reallocate(grown_capacity(count));
+    set_size(static_cast<size_type>(op(data(), count)));
+  }
+
+  // Appends a character
+  void push_back(CharT ch) {
+    size_type old_size = size();
+    if (old_size == capacity()) reallocate(grown_capacity(old_size + 1));
+    data()[old_size] = ch;
+    set_size(old_size + 1);
+  }
+
+  // Removes the last character
+  void pop_back() { set_size(size() - 1); }
+
+  /*
+      Appends characters.
+
+      Parameters:
+          - chars: The characters to append; they may point into this
+         string.
+          - count: The number of characters.
+
+      Returns:
+          - A reference to this string.
+  */
+  basic_string &append(const CharT *chars, size_type count) {
+    size_type old_size = size();
+    if (count > capacity() - old_size) {
+      // The old buffer outlives the copy, in case `chars` points into it.
+      size_type new_capacity = grown_capacity(old_size + count);
+      CharT *buffer = allocate_buffer(new_capacity);
+      traits::copy(buffer, data(), old_size);
+      traits::copy(buffer + old_size, chars, count);
+      release();
+      set_heap(buffer, old_size + count, new_capacity);
+    } else {
+      traits::move(data() + old_size, chars, count);
+      set_size(old_size + count);
+    }
+    return *this;
+  }
+
+  // Appends a null-terminated string
+  basic_string &append(const CharT *chars) {
+    return append(chars, traits::length(chars));
+  }
+
+  // Appends another string
+  basic_string &append(const basic_string &right) {
+    return append(right.data(), right.size());
+  }
+
+  // Appends the characters of a view
+  basic_string &append(view_type view) {
+    return append(view.data(), view.size());
+  }
+
+  // Appends `count` copies of `ch`
+  basic_string &append(size_type count, CharT ch) {
+    size_type old_size = size();
+    reserve(old_size + count);
+    traits::assign(data() + old_size, count, ch);
+    set_size(old_size + count);
+    return *this;
+  }
+
+  // Appends another string
+  basic_string &operator+=(const basic_string &right) { return append(right); }
+
+  // Appends a null-terminated string
+  basic_string &operator+=(const CharT *chars) { return append(chars); }
+
+  // Appends a character
+  basic_string &operator+=(CharT ch) {
+    push_back(ch);
+    return *this;
+  }
+
+  // Returns the characters [position, position + count), clamped to the
+  // end; throws std::out_of_range if `position` is past the end.
+  basic_string substr(size_type position = 0, size_type count = npos) const {
+    check_position(position);
+    size_type available = size() - position;
+    return basic_string(data() + position,
+                        count < available ? count : available);
+  }
+
+  // Returns the index of the first `ch` at or after `position`, or npos.
+  size_type find(CharT ch, size_type position = 0) const {
+    return view().find(ch, position);
+  }
+
+  // Returns the index of the first occurrence of `chars[0, count)` at or
+  // after `position`, or npos.
+  size_type find(const CharT *chars, size_type position,
+                 size_type count) const {
+    return view().find(view_type(chars, count), position);
+  }
+
+  // Returns the index of the first occurrence of `needle` at or after
+  // `position`, or npos.
+  size_type find(view_type needle, size_type position = 0) const {
+    return view().find(needle, position);
+  }
+
+  // Returns the index of the first occurrence of `right` at or after
+  // `position`, or npos.
+  size_type find(const basic_string &right, size_type position = 0) const {
+    return find(right.data(), position, right.size());
+  }
+
+  // Returns the index of the first occurrence of a null-terminated string at
+  // or after `position`, or npos.
+  size_type find(const CharT *chars, size_type position = 0) const {
+    return find(chars, position, traits::length(chars));
+  }
+
+  /*
+      Compares with another sequence of characters lexicographically.
+
+      Parameters:
+          - chars: The characters to compare with.
+          - count: The number of characters.
+
+      Returns:
+          - A negative value, zero or a positive value if this string orders
+         before, equal to or after the characters.
+  */
+  int compare(const CharT *chars, size_type count) const {
+    return view().compare(view_type(chars, count));
+  }
+
+  // Compares with another string lexicographically
+  int compare(const basic_string &right) const {
+    return compare(right.data(), right.size());
+  }
+
+  // Checks if two strings hold the same characters
+  bool operator==(const basic_string &right) const {
+    size_type length = size();
+    return length == right.size() &&
+           traits::compare(data(), right.data(), length) == 0;
+  }
+
+  // Checks if the string holds the same characters as a null-terminated
+  // string
+  bool operator==(const CharT *chars) const {
+    size_type length = traits::length(chars);
+    return length == size() && traits::compare(data(), chars, length) == 0;
+  }
+
+  // Checks if two strings differ
+  bool operator!=(const basic_string &right) const { return !(*this == right); }
+
+  // Checks if the string differs from a null-terminated string
+  bool operator!=(const CharT *chars) const { return !(*this == chars); }
+
+  // Checks if the string orders before another string
+  bool operator<(const basic_string &right) const { return compare(right) < 0; }
+
+  // Checks if the string orders before or equal to another string
+  bool operator<=(const basic_string &right) const {
+    return compare(right) <= 0;
+  }
+
+  // Checks if the string orders after another string
+  bool operator>(const basic_string &right) const { return compare(right) > 0; }
+
+  // Checks if the string orders after or equal to another string
+  bool operator>=(const basic_string &right) const {
+    return compare(right) >= 0;
+  }
+
+  // Swaps the contents of two strings
+  void swap(basic_string &right) {
+    unsigned char temp[sizeof(basic_string)];
+    std::memcpy(temp, static_cast<void *>(this), sizeof(basic_string));
+    std::memcpy(static_cast<void *>(this), &right, sizeof(basic_string));
+    std::memcpy(static_cast<void *>(&right), temp, sizeof(basic_string));
+  }
+
+ private:
+  static_assert(std::is_same<typename Allocator::value_type, CharT>::value,
+                "basic_string requires an allocator of CharT");
+
+  static constexpr int tag_bits = int(sizeof(CharT) * CHAR_BIT);
+  static constexpr tag_type long_bit = tag_type(1) << (tag_bits - 1);
+  static constexpr bool little_endian =
+      std::endian::native == std::endian::little;
+
+  union {
+    heap_rep m_heap;
+    CharT m_inline[inline_capacity + 1];
+  };
+
+  // The last character of the object, shared by both layouts.
+  tag_type tag() const { return tag_type(m_inline[inline_capacity]); }
+
+  bool is_long() const { return (tag() & long_bit) != 0; }
+
+  // Packs a capacity so that the last character of the object, which on a
+  // little-endian machine holds the top bits of the word and on a big-endian
+  // one its bottom bits, has its top bit set.
+  static size_type encode_capacity(size_type capacity) {
+    if constexpr (little_endian) {
+      return capacity | (size_type(1) << (sizeof(size_type) * CHAR_BIT - 1));
+    } else {
+      return (capacity << tag_bits) | size_type(long_bit);
+    }
+  }
+
+  static size_type decode_capacity(size_type word) {
+    if constexpr (little_endian) {
+      return word & ~(size_type(1) << (sizeof(size_type) * CHAR_BIT - 1));
+    } else {
+      return word >> tag_bits;
+    }
+  }
+
+  void set_inline_size(size_type count) {
+    m_inline[count] = CharT();
+    m_inline[inline_capacity] = CharT(inline_capacity - count);
+  }
+
+  void set_heap(CharT *buffer, size_type count, size_type capacity) {
+    buffer[count] = CharT();
+    m_heap.data = buffer;
+    m_heap.size = count;
+    m_heap.capacity_word = encode_capacity(capacity);
+  }
+
+  // Sets the size within the current capacity and writes the terminator.
+  void set_size(size_type count) {
+    if (is_long()) {
+      m_heap.size = count;
+      m_heap.data[count] = CharT();
+    } else {
+      set_inline_size(count);
+    }
+  }
+
+  // Allocates room for `capacity` characters and the terminator.
+  static CharT *allocate_buffer(size_type capacity) {
+    Allocator alloc;
+    return alloc.allocate(capacity + 1);
+  }
+
+  static void deallocate_buffer(CharT *buffer) {
+    Allocator alloc;
+    alloc.deallocate(buffer);
+  }
+
+  void release() {
+    if (is_long()) deallocate_buffer(m_heap.data);
+  }
+
+  // Sets up an empty object to hold `count` characters, without writing
+  // them.
+  void init_uninitialized(size_type count) {
+    if (count <= inline_capacity) {
+      set_inline_size(count);
+    } else {
+      set_heap(allocate_buffer(count), count, count);
+    }
+  }
+
+  void init(const CharT *chars, size_type count) {
+    init_uninitialized(count);
+    traits::copy(data(), chars, count);
+  }
+
+  // Returns the capacity to grow to when `count` characters are needed.
+  size_type grown_capacity(size_type count) const {
+    size_type doubled = 2 * capacity();
+    return count > doubled ? count : doubled;
+  }
+
+  // Moves the characters to a heap buffer of `new_capacity` characters,
+  // which must hold them and exceed inline_capacity.
+  void reallocate(size_type new_capacity) {
+    size_type count = size();
+    CharT *buffer = allocate_buffer(new_capacity);
+    traits::copy(buffer, data(), count);
+    release();
+    set_heap(buffer, count, new_capacity);
+  }
+
+  // Throws std::out_of_range unless `position` is at most size().
+  void check_position(size_type position) const {
+    if (position > size()) throw_out_of_range();
+  }
+
+  [[noreturn]] static void throw_out_of_range() {
+    throw std::out_of_range(
+        "Error: string index out of range. Please ensure the index is within "
+        "the valid range.");
+  }
+};
+
+// Concatenates two strings
+template <typename CharT, typename Allocator>
+basic_string<CharT, Allocator> operator+(
+    const basic_string<CharT, Allocator> &left,
+    const basic_string<CharT, Allocator> &right) {
+  basic_string<CharT, Allocator> result;
+  result.reserve(left.size() + right.size());
+  result.append(left);
+  result.append(right);
+  return result;
+}
+
+// Concatenates a string and a null-terminated string
+template <typename CharT, typename Allocator>
+basic_string<CharT, Allocator> operator+(
+    const basic_string<CharT, Allocator> &left, const CharT *right) {
+  basic_string<CharT, Allocator> result = left;
+  result.append(right);
+  return result;
+}
+
+// Appends to a string that is about to expire, reusing its buffer.
+template <typename CharT, typename Allocator>
+basic_string<CharT, Allocator> operator+(
+    basic_string<CharT, Allocator> &&left,
+    const basic_string<CharT, Allocator> &right) {
+  left.append(right);
+  return move(left);
+}
+
+using string = basic_string<char>;
+using u8string = basic_string<char8_t>;
+using u16string = basic_string<char16_t>;
+using u32string = basic_string<char32_t>;
+using wstring = basic_string<wchar_t>;
+}  // namespace open_stl
+
+#endif  // OPEN_STL_STRING_H_
@@ -0,0 +1,257 @@
+#ifndef OPEN_STL_STRING_VIEW_H_
+#define OPEN_STL_STRING_VIEW_H_
+
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+
+namespace open_stl {
+/*
+    A non-owning view of a contiguous sequence of characters.
+
+    Template Parameters:
+        - CharT: The character type.
+
+    A string_view is a pointer and a length. Taking a substr(), or trimming
+   it with remove_prefix() and remove_suffix(), is O(1) and never copies or
+   allocates, which makes it the type to pass tokens of a parsed buffer
+   around in. The characters are not null-terminated in general, and the
+   view dangles once the string it was taken from changes or dies.
+   Character operations go through std::char_traits<CharT>.
+*/
+template <typename CharT>
+class basic_string_view {
+  using traits = std::char_traits<CharT>;
+
+ public:
+  using value_type = CharT;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using pointer = CharT *;
+  using const_pointer = const CharT *;
+  using reference = CharT &;
+  using const_reference = const CharT &;
+  using iterator = const CharT *;
+  using const_iterator = const CharT *;
+
+  // Returned by find() when nothing matches, and meaning "to the end" as a
+  // count.
+  static constexpr size_type npos = size_type(-1);
+
+  // Default constructor, making an empty view
+  constexpr basic_string_view() : m_data(nullptr), m_size(0) {}
+
+  // Constructor viewing a null-terminated string
+  constexpr basic_string_view(const CharT *chars)
+      : m_data(chars), m_size(traits::length(chars)) {}
+
+  // Constructor viewing `count` characters starting at `chars`
+  constexpr basic_string_view(const CharT *chars, size_type count)
+      : m_data(chars), m_size(count) {}
+
+  // Constructor viewing the characters [first, last)
+  constexpr basic_string_view(const CharT *first, const CharT *last)
+      : m_data(first), m_size(size_type(last - first)) {}
+
+  // Returns a pointer to the first character
+  constexpr const_pointer data() const { return m_data; }
+
+  // Returns the number of characters
+  constexpr size_type size() const { return m_size; }
+
+  // Returns the number of characters
+  constexpr size_type length() const { return m_size; }
+
+  // Checks whether the view is empty
+  constexpr bool empty() const { return m_size == 0; }
+
+  // Returns an iterator to the first character
+  constexpr const_iterator begin() const { return m_data; }
+
+  // Returns an iterator to the first character
+  constexpr const_iterator cbegin() const { return m_data; }
+
+  // Returns an iterator past the last character
+  constexpr const_iterator end() const { return m_data + m_size; }
+
+  // Returns an iterator past the last character
+  constexpr const_iterator cend() const { return m_data + m_size; }
+
+  // Returns the character at `position`, which must be less than size()
+  constexpr const_reference operator[](size_type position) const {
+    return m_data[position];
+  }
+
+  // Returns the character at `position`; throws std::out_of_range if
+  // `position` is not less than size().
+  constexpr const_reference at(size_type position) const {
+    if (position >= m_size) throw_out_of_range();
+    return m_data[position];
+  }
+
+  // Returns the first character
+  constexpr const_reference front() const { return m_data[0]; }
+
+  // Returns the last character
+  constexpr const_reference back() const { return m_data[m_size - 1]; }
+
+  // Drops the first `count` characters, which must not exceed size().
+  constexpr void remove_prefix(size_type count) {
+    m_data += count;
+    m_size -= count;
+  }
+
+  // Drops the last `count` characters, which must not exceed size().
+  constexpr void remove_suffix(size_type count) { m_size -= count; }
+
+  // Swaps two views
+  constexpr void swap(basic_string_view &right) {
+    basic_string_view temp = *this;
+    *this = right;
+    right = temp;
+  }
+
+  // Returns a view of the characters [position, position + count), clamped
+  // to the end; throws std::out_of_range if `position` is past the end.
+  constexpr basic_string_view substr(size_type position = 0,
+                                     size_type count = npos) const {
+    if (position > m_size) throw_out_of_range();
+    size_type available = m_size - position;
+    return basic_string_view(m_data + position,
+                             count < available ? count : available);
+  }
+
+  // Checks whether the view begins with `prefix`.
+  constexpr bool starts_with(basic_string_view prefix) const {
+    return m_size >= prefix.m_size &&
+           traits::compare(m_data, prefix.m_data, prefix.m_size) == 0;
+  }
+
+  // Checks whether the view begins with `ch`.
+  constexpr bool starts_with(CharT ch) const {
+    return m_size != 0 && traits::eq(m_data[0], ch);
+  }
+
+  // Checks whether the view ends with `suffix`.
+  constexpr bool ends_with(basic_string_view suffix) const {
+    return m_size >= suffix.m_size &&
+           traits::compare(m_data + (m_size - suffix.m_size), suffix.m_data,
+                           suffix.m_size) == 0;
+  }
+
+  // Checks whether the view ends with `ch`.
+  constexpr bool ends_with(CharT ch) const {
+    return m_size != 0 && traits::eq(m_data[m_size - 1], ch);
+  }
+
+  // Returns the index of the first `ch` at or after `position`, or npos.
+  constexpr size_type find(CharT ch, size_type position = 0) const {
+    if (position >= m_size) return npos;
+    const CharT *found = traits::find(m_data + position, m_size - position, ch);
+    return found == nullptr ? npos : size_type(found - m_data);
+  }
+
+  // Returns the index of the first occurrence of `needle` at or after
+  // `position`, or npos.
+  constexpr size_type find(basic_string_view needle,
+                           size_type position = 0) const {
+    size_type count = needle.m_size;
+    if (count == 0) return position <= m_size ? position : npos;
+    while (position < m_size && m_size - position >= count) {
+      // Jump to the next candidate first character, then verify the rest.
+      const CharT *candidate = traits::find(
+          m_data + position, m_size - position - count + 1, needle.m_data[0]);
+      if (candidate == nullptr) return npos;
+      if (traits::compare(candidate + 1, needle.m_data + 1, count - 1) == 0) {
+        return size_type(candidate - m_data);
+      }
+      position = size_type(candidate - m_data) + 1;
+    }
+    return npos;
+  }
+
+  // Returns the index of the last `ch` at or before `position`, or npos.
+  constexpr size_type rfind(CharT ch, size_type position = npos) const {
+    if (m_size == 0) return npos;
+    size_type index = position < m_size ? position : m_size - 1;
+    for (;; index--) {
+      if (traits::eq(m_data[index], ch)) return index;
+      if (index == 0) return npos;
+    }
+  }
+
+  // Checks whether the view contains `needle`.
+  constexpr bool contains(basic_string_view needle) const {
+    return find(needle) != npos;
+  }
+
+  // Checks whether the view contains `ch`.
+  constexpr bool contains(CharT ch) const { return find(ch) != npos; }
+
+  /*
+      Compares with another view lexicographically.
+
+      Parameters:
+          - right: The view to compare with.
+
+      Returns:
+          - A negative value, zero or a positive value if this view orders
+         before, equal to or after `right`.
+  */
+  constexpr int compare(basic_string_view right) const {
+    size_type count = m_size < right.m_size ? m_size : right.m_size;
+    int result = traits::compare(m_data, right.m_data, count);
+    if (result != 0) return result;
+    return m_size < right.m_size ? -1 : (m_size > right.m_size ? 1 : 0);
+  }
+
+  // Checks if two views hold the same characters
+  friend constexpr bool operator==(basic_string_view left,
+                                   basic_string_view right) {
+    return left.m_size == right.m_size &&
+           traits::compare(left.m_data, right.m_data, left.m_size) == 0;
+  }
+
+  // Checks if a view orders before another view
+  friend constexpr bool operator<(basic_string_view left,
+                                  basic_string_view right) {
+    return left.compare(right) < 0;
+  }
+
+  // Checks if a view orders before or equal to another view
+  friend constexpr bool operator<=(basic_string_view left,
+                                   basic_string_view right) {
+    return left.compare(right) <= 0;
+  }
+
+  // Checks if a view orders after another view
+  friend constexpr bool operator>(basic_string_view left,
+                                  basic_string_view right) {
+    return left.compare(right) > 0;
+  }
+
+  // Checks if a view orders after or equal to another view
+  friend constexpr bool operator>=(basic_string_view left,
+                                   basic_string_view right) {
+    return left.compare(right) >= 0;
+  }
+
+ private:
+  const CharT *m_data;
+  size_type m_size;
+
+  [[noreturn]] static void throw_out_of_range() {
+    throw std::out_of_range(
+        "Error: string_view index out of range. Please ensure the index is "
+        "within the valid range.");
+  }
+};
+
+using string_view = basic_string_view<char>;
+using u8string_view = basic_string_view<char8_t>;
+using u16string_view = basic_string_view<char16_t>;
+using u32string_view = basic_string_view<char32_t>;
+using wstring_view = basic_string_view<wchar_t>;
+}  // namespace open_stl
+
+#endif  // OPEN_STL_STRING_VIEW_H_
@@ -0,0 +1,690 @@
+#ifndef OPEN_STL_THREAD_POOL_H_
+#define OPEN_STL_THREAD_POOL_H_
+
+#include <OpenSTL/deque.h>
+#include <OpenSTL/internal/prefetch.h>
+#include <OpenSTL/utility.h>
+#include <OpenSTL/vector.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <new>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+
+namespace open_stl {
+namespace internal {
+
+// Returns the number of hardware threads, never less than one.
+inline std::size_t hardware_threads() {
+  unsigned int count = std::thread::hardware_concurrency();
+  return count == 0 ? 1 : count;
+}
+
+/*
+    A unit of work run by thread_pool.
+
+    Tasks are reference counted: the pool holds one reference until run()
+   returned, and whoever else observes the task (a task_handle) holds
+   another. The last release() deletes the task.
+*/
+class pool_task {
+ public:
+  virtual void run() = 0;
+
+  void release() {
+    if (m_references.fetch_sub(1, std::memory_order_acq_rel) == 1) delete this;
+  }
+
+ protected:
+  explicit pool_task(int references) : m_references(references) {}
+  virtual ~pool_task() = default;
+
+ private:
+  std::atomic<int> m_references;
+};
+
+/*
+    The Chase-Lev work-stealing deque, in the formulation of Le, Pop, Cohen
+   and Zappa Nardelli ("Correct and efficient work-stealing for weak memory
+   models", 2013).
+
+    The owning worker pushes and pops tasks at the bottom, like a stack,
+   which keeps its working set hot in its cache. Other threads steal from
+   the top, taking the oldest task, which in divide-and-conquer work is the
+   largest one left. Owner operations are plain loads and stores except when
+   the deque holds a single task; thieves synchronize with one
+   compare-and-swap on the top index.
+
+    The ring doubles when full. Thieves may still be reading the old ring,
+   so it is retired instead of freed and released with the deque.
+*/
+class work_stealing_deque {
+ public:
+  work_stealing_deque()
+      : m_top(0), m_bottom(0), m_ring(new ring(64)), m_retired() {}
+
+  work_stealing_deque(const work_stealing_deque &) = delete;
+  work_stealing_deque &operator=(const work_stealing_deque &) = delete;
+
+  ~work_stealing_deque() {
+    delete m_ring.load(std::memory_order_relaxed);
+    for (ring *old : m_retired) {
+      delete old;
+    }
+  }
+
+  // Pushes a task at the bottom. Only the owner may call this.
+  void push(pool_task *task) {
+    std::int64_t bottom = m_bottom.load(std::memory_order_relaxed);
+    std::int64_t top = m_top.load(std::memory_order_acquire);
+    ring *slots = m_ring.load(std::memory_order_relaxed);
+    if (bottom - top > slots->mask) slots = grow(slots, top, bottom);
+    slots->store(bottom, task);
+    m_bottom.store(bottom + 1, std::memory_order_release);
+  }
+
+  // Pops the task at the bottom, or returns nullptr if the deque is empty.
+  // Only the owner may call this.
+  pool_task *pop() {
+    std::int64_t bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+    ring *slots = m_ring.load(std::memory_order_relaxed);
+    // The store and the load of top must not be reordered, or a thief and
+    // the owner could both take the last task.
+    m_bottom.store(bottom, std::memory_order_seq_cst);
+    std::int64_t top = m_top.load(std::memory_order_seq_cst);
+    if (top > bottom) {
+      m_bottom.store(bottom + 1, std::memory_order_relaxed);
+      return nullptr;
+    }
+    pool_task *task = slots->load(bottom);
+    if (top == bottom) {
+      // The last task: race the thieves for it.
+      if (!m_top.compare_exchange_strong(top, top + 1,
+                                         std::memory_order_seq_cst,
+                                         std::memory_order_relaxed)) {
+        task = nullptr;
+      }
+      m_bottom.store(bottom + 1, std::memory_order_relaxed);
+    }
+    return task;
+  }
+
+  // Steals the task at the top. Returns nullptr if the deque is empty or
+  // another thread took the task first. Any thread may call this.
+  pool_task *steal() {
+    std::int64_t top = m_top.load(std::memory_order_seq_cst);
+    std::int64_t bottom = m_bottom.load(std::memory_order_seq_cst);
+    if (top >= bottom) return nullptr;
+    ring *slots = m_ring.load(std::memory_order_acquire);
+    pool_task *task = slots->load(top);
+    if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst,
+                                       std::memory_order_relaxed)) {
+      return nullptr;
+    }
+    return task;
+  }
+
+  // Checks whether the deque looked empty at some instant during the call.
+  bool empty() const {
+    return m_bottom.load(std::memory_order_relaxed) <=
+           m_top.load(std::memory_order_relaxed);
+  }
+
+ private:
+  class ring {
+   public:
+    explicit ring(std::int64_t capacity)
+        : mask(capacity - 1),
+          m_slots(new std::atomic<pool_task *>[std::size_t(capacity)]) {}
+
+    ~ring() { delete[] m_slots; }
+
+    pool_task *load(std::int64_t index) const {
+      return m_slots[index & mask].load(std::memory_order_relaxed);
+    }
+
+    void store(std::int64_t index, pool_task *task) {
+      m_slots[index & mask].store(task, std::memory_order_relaxed);
+    }
+
+    const std::int64_t mask;
+
+   private:
+    std::atomic<pool_task *> *m_slots;
+  };
+
+  alignas(cache_line_size) std::atomic<std::int64_t> m_top;
+  alignas(cache_line_size) std::atomic<std::int64_t> m_bottom;
+  std::atomic<ring *> m_ring;
+  // Rings replaced by grow(); touched only by the owner.
+  vector<ring *> m_retired;
+
+  ring *grow(ring *old, std::int64_t top, std::int64_t bottom) {
+    ring *bigger = new ring(2 * (old->mask + 1));
+    for (std::int64_t i = top; i < bottom; i++) {
+      bigger->store(i, old->load(i));
+    }
+    m_retired.push_back(old);
+    m_ring.store(bigger, std::memory_order_release);
+    return bigger;
+  }
+};
+
+// The shared state of a submitted task: completion flag, result or
+// exception. Held by the task itself, so submit() allocates once.
+template <typename R>
+class result_task : public pool_task {
+ public:
+  const std::atomic<bool> &done() const { return m_done; }
+
+  // Returns the result, or rethrows the exception the function threw.
+  R take() {
+    if (m_error) std::rethrow_exception(m_error);
+    if constexpr (!std::is_void_v<R>) {
+      return move(*std::launder(reinterpret_cast<R *>(m_storage)));
+    }
+  }
+
+ protected:
+  // One reference for the pool and one for the task_handle.
+  result_task() : pool_task(2), m_done(false), m_has_value(false) {}
+
+  ~result_task() override {
+    if constexpr (!std::is_void_v<R>) {
+      if (m_has_value) std::launder(reinterpret_cast<R *>(m_storage))->~R();
+    }
+  }
+
+  // Runs `function`, stores its outcome and wakes any waiting thread.
+  template <typename Function>
+  void complete(Function &function) {
+    try {
+      if constexpr (std::is_void_v<R>) {
+        function();
+      } else {
+        ::new (static_cast<void *>(m_storage)) R(function());
+        m_has_value = true;
+      }
+    } catch (...) {
+      m_error = std::current_exception();
+    }
+    m_done.store(true, std::memory_order_release);
+    m_done.notify_all();
+  }
+
+ private:
+  using storage_type = std::conditional_t<std::is_void_v<R>, char, R>;
+
+  std::atomic<bool> m_done;
+  std::exception_ptr m_error;
+  bool m_has_value;
+  alignas(storage_type) unsigned char m_storage[sizeof(storage_type)];
+};
+
+// A task created by thread_pool::submit().
+template <typename Function, typename R>
+class function_task final : public result_task<R> {
+ public:
+  explicit function_task(Function function) : m_function(move(function)) {}
+
+  void run() override { this->complete(m_function); }
+
+ private:
+  Function m_function;
+};
+
+}  // namespace internal
+
+template <typename R>
+class task_handle;
+
+/*
+    A fixed set of worker threads that share work by stealing.
+
+    Every worker owns a Chase-Lev deque. Tasks submitted from a worker go to
+   the bottom of its own deque, where that worker picks them up again in
+   last-in first-out order; tasks submitted from other threads go to a
+   shared injection queue. A worker that runs out of tasks takes from the
+   injection queue or steals the oldest task of a random other worker, and
+   only goes to sleep, on an atomic wait, when it finds nothing anywhere.
+
+    A worker that waits on the pool, in task_handle::get() or
+   parallel_for(), runs pending tasks while it waits instead of blocking,
+   so tasks may submit and wait on nested tasks without deadlocking the
+   pool. A thread outside the pool runs pending tasks only in
+   parallel_for(); in task_handle::get() it sleeps until the task has
+   finished.
+
+    shutdown(), also called by the destructor, lets the workers finish every
+   queued task and joins them.
+*/
+class thread_pool {
+ public:
+  // Constructor starting `threads` workers, at least one.
+  explicit thread_pool(std::size_t threads = internal::hardware_threads())
+      : m_workers(),
+        m_injected_mutex(),
+        m_injected(),
+        m_injected_count(0),
+        m_epoch(0),
+        m_sleeping(0),
+        m_stopping(false) {
+    if (threads == 0) threads = 1;
+    for (std::size_t i = 0; i < threads; i++) {
+      m_workers.push_back(new worker(i + 1));
+    }
+    for (worker *self : m_workers) {
+      self->thread = std::thread([this, self]() { work(self); });
+    }
+  }
+
+  thread_pool(const thread_pool &) = delete;
+  thread_pool &operator=(const thread_pool &) = delete;
+
+  // Destructor; runs the queued tasks and joins the workers.
+  ~thread_pool() { shutdown(); }
+
+  // Returns the number of worker threads.
+  std::size_t size() const { return m_workers.size(); }
+
+  /*
+      Queues a function to run on the pool.
+
+      Template Parameters:
+          - Function: A callable taking no arguments.
+
+      Returns:
+          - A task_handle that waits for the result.
+
+      Throws:
+          - std::runtime_error if the pool was shut down and the calling
+     thread is not one of its workers.
+  */
+  template <typename Function>
+  task_handle<std::invoke_result_t<Function &>> submit(Function function) {
+    using result_type = std::invoke_result_t<Function &>;
+    auto *task =
+        new internal::function_task<Function, result_type>(move(function));
+    if (!enqueue(task)) {
+      delete task;
+      throw std::runtime_error(
+          "Error: thread_pool is shut down. Tasks cannot be submitted after "
+          "shutdown().");
+    }
+    return task_handle<result_type>(task, this);
+  }
+
+  /*
+      Calls `function(i)` for every i in [first, last) on the pool and
+     returns when all calls finished.
+
+      Template Parameters:
+          - Function: A callable taking the index as std::size_t; it must be
+     safe to call concurrently for distinct indices.
+
+      Parameters:
+          - first, last: The index range.
+          - function: The loop body.
+          - grain: The fewest indices a task runs without checking whether
+     to split; 0 picks one from the range size.
+
+      Throws:
+          - The first exception thrown by `function`, after every task of the
+     loop finished. Indices after the one that threw in the same chunk are
+     skipped.
+
+      The range is split lazily: a thread holding a range only splits off
+     its upper half when its own deque is empty, that is when the tasks it
+     queued before were stolen, and otherwise works through the range one
+     grain at a time. Busy pools thus split little, idle ones split until
+     every worker has something to steal, and uneven iterations balance
+     out. The calling thread takes part in the loop. After shutdown() the
+     loop runs on the calling thread alone.
+  */
+  template <typename Function>
+  void parallel_for(std::size_t first, std::size_t last, Function function,
+                    std::size_t grain = 0) {
+    if (first >= last) return;
+    if (grain == 0) {
+      grain = (last - first) / (64 * (size() + 1));
+      if (grain == 0) grain = 1;
+    }
+    loop<Function> state(function, grain);
+    run_range(state, first, last);
+    finish(state);
+    help_until([&state]() {
+      return state.pending.load(std::memory_order_acquire) == 0;
+    });
+    if (state.error) std::rethrow_exception(state.error);
+  }
+
+  // Finishes every queued task and joins the workers. Later calls do
+  // nothing.
+  void shutdown() {
+    {
+      std::lock_guard<std::mutex> lock(m_injected_mutex);
+      if (m_stopping.load(std::memory_order_relaxed)) return;
+      m_stopping.store(true, std::memory_order_seq_cst);
+    }
+    m_epoch.fetch_add(1, std::memory_order_seq_cst);
+    m_epoch.notify_all();
+    for (worker *self : m_workers) {
+      self->thread.join();
+    }
+    for (worker *self : m_workers) {
+      delete self;
+    }
+    m_workers.clear();
+  }
+
+ private:
+  template <typename R>
+  friend class task_handle;
+
+  struct worker {
+    explicit worker(std::uint64_t seed) : tasks(), thread(), random(seed) {}
+
+    internal::work_stealing_deque tasks;
+    std::thread thread;
+    // State of the generator that picks steal victims.
+    std::uint64_t random;
+  };
+
+  // The shared state of one parallel_for() call.
+  template <typename Function>
+  struct loop {
+    loop(Function &body, std::size_t grain_size)
+        : function(body), grain(grain_size), pending(1), error_mutex() {}
+
+    Function &function;
+    std::size_t grain;
+    // Ranges not yet finished; the caller's own range counts as one.
+    std::atomic<std::size_t> pending;
+    std::mutex error_mutex;
+    std::exception_ptr error;
+  };
+
+  // A range split off by run_range().
+  template <typename Function>
+  class range_task final : public internal::pool_task {
+   public:
+    range_task(thread_pool *pool, loop<Function> &state, std::size_t first,
+               std::size_t last)
+        : pool_task(1),
+          m_pool(pool),
+          m_state(state),
+          m_first(first),
+          m_last(last) {}
+
+    void run() override {
+      m_pool->run_range(m_state, m_first, m_last);
+      m_pool->finish(m_state);
+    }
+
+   private:
+    thread_pool *m_pool;
+    loop<Function> &m_state;
+    std::size_t m_first;
+    std::size_t m_last;
+  };
+
+  vector<worker *> m_workers;
+  std::mutex m_injected_mutex;
+  // Tasks submitted from threads that are not workers of this pool.
+  deque<internal::pool_task *> m_injected;
+  std::atomic<std::size_t> m_injected_count;
+  // Bumped whenever work is queued; sleeping workers wait on it.
+  std::atomic<std::uint32_t> m_epoch;
+  std::atomic<std::uint32_t> m_sleeping;
+  std::atomic<bool> m_stopping;
+
+  // The pool and worker the calling thread belongs to, if any.
+  static inline thread_local thread_pool *t_pool = nullptr;
+  static inline thread_local worker *t_worker = nullptr;
+
+  worker *current_worker() const { return t_pool == this ? t_worker : nullptr; }
+
+  // Queues a task, returning false if the pool no longer accepts tasks from
+  // the calling thread.
+  bool enqueue(internal::pool_task *task) {
+    if (worker *self = current_worker()) {
+      self->tasks.push(task);
+    } else {
+      std::lock_guard<std::mutex> lock(m_injected_mutex);
+      if (m_stopping.load(std::memory_order_relaxed)) return false;
+      m_injected.push_back(task);
+      m_injected_count.fetch_add(1, std::memory_order_relaxed);
+    }
+    m_epoch.fetch_add(1, std::memory_order_seq_cst);
+    if (m_sleeping.load(std::memory_order_seq_cst) != 0) m_epoch.notify_one();
+    return true;
+  }
+
+  // Returns a task to run, or nullptr if none was found.
+  internal::pool_task *find_task(worker *self) {
+    if (self != nullptr) {
+      if (internal::pool_task *task = self->tasks.pop()) return task;
+    }
+    if (m_injected_count.load(std::memory_order_relaxed) != 0) {
+      std::lock_guard<std::mutex> lock(m_injected_mutex);
+      if (!m_injected.empty()) {
+        internal::pool_task *task = m_injected.front();
+        m_injected.pop_front();
+        m_injected_count.fetch_sub(1, std::memory_order_relaxed);
+        return task;
+      }
+    }
+    std::size_t count = m_workers.size();
+    if (count == 0) return nullptr;
+    std::size_t start = next_random(self) % count;
+    for (std::size_t i = 0; i < count; i++) {
+      worker *victim = m_workers[(start + i) % count];
+      if (victim == self) continue;
+      if (internal::pool_task *task = victim->tasks.steal()) return task;
+    }
+    return nullptr;
+  }
+
+  // Runs one task if there is any.
+  bool run_one(worker *self) {
+    internal::pool_task *task = find_task(self);
+    if (task == nullptr) return false;
+    task->run();
+    task->release();
+    return true;
+  }
+
+  // Runs tasks on the calling thread until `done` returns true. Threads
+  // that are not workers of this pool also steal, so they speed up the
+  // work they are waiting for.
+  template <typename Predicate>
+  void help_until(Predicate done) {
+    worker *self = current_worker();
+    while (!done()) {
+      if (!run_one(self)) std::this_thread::yield();
+    }
+  }
+
+  static std::uint64_t next_random(worker *self) {
+    static thread_local std::uint64_t outside_state = 0x9e3779b97f4a7c15ull;
+    std::uint64_t &state = self != nullptr ? self->random : outside_state;
+    // xorshift64
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    return state;
+  }
+
+  // The body of a worker thread.
+  void work(worker *self) {
+    t_pool = this;
+    t_worker = self;
+    while (true) {
+      if (run_one(self)) continue;
+      // Announce the intent to sleep before the last look for work, so a
+      // task queued after that look is guaranteed to wake this thread.
+      m_sleeping.fetch_add(1, std::memory_order_seq_cst);
+      std::uint32_t epoch = m_epoch.load(std::memory_order_seq_cst);
+      if (run_one(self)) {
+        m_sleeping.fetch_sub(1, std::memory_order_relaxed);
+        continue;
+      }
+      if (m_stopping.load(std::memory_order_seq_cst)) {
+        m_sleeping.fetch_sub(1, std::memory_order_relaxed);
+        return;
+      }
+      m_epoch.wait(epoch, std::memory_order_seq_cst);
+      m_sleeping.fetch_sub(1, std::memory_order_relaxed);
+    }
+  }
+
+  // Checks whether the calling thread should split off part of its range:
+  // true when its queued work has been taken by other threads.
+  bool should_split() {
+    if (m_stopping.load(std::memory_order_relaxed)) {
+      return current_worker() != nullptr && current_worker()->tasks.empty();
+    }
+    if (worker *self = current_worker()) return self->tasks.empty();
+    return m_injected_count.load(std::memory_order_relaxed) == 0;
+  }
+
+  template <typename Function>
+  void run_range(loop<Function> &state, std::size_t first, std::size_t last) {
+    while (last - first > state.grain) {
+      if (should_split()) {
+        std::size_t middle = first + (last - first) / 2;
+        state.pending.fetch_add(1, std::memory_order_relaxed);
+        if (enqueue(new range_task<Function>(this, state, middle, last))) {
+          last = middle;
+          continue;
+        }
+        state.pending.fetch_sub(1, std::memory_order_relaxed);
+      }
+      run_chunk(state, first, first + state.grain);
+      first += state.grain;
+    }
+    run_chunk(state, first, last);
+  }
+
+  // Runs the loop body over [first, last), recording the first exception.
+  template <typename Function>
+  void run_chunk(loop<Function> &state, std::size_t first, std::size_t last) {
+    try {
+      for (; first < last; first++) {
+        state.function(first);
+      }
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(state.error_mutex);
+      if (!state.error) state.error = std::current_exception();
+    }
+  }
+
+  template <typename Function>
+  void finish(loop<Function> &state) {
+    state.pending.fetch_sub(1, std::memory_order_acq_rel);
+  }
+};
+
+/*
+    Returns the pool shared by the library's parallel algorithms.
+
+    It is created on first use with one worker less than there are hardware
+   threads, since the thread that starts a parallel algorithm works as well.
+*/
+inline thread_pool &default_thread_pool() {
+  static thread_pool pool(internal::hardware_threads() - 1);
+  return pool;
+}
+
+/*
+    A handle to the result of a task submitted to a thread_pool, similar to
+   std::future.
+
+    Template Parameters:
+        - R: The type returned by the task.
+
+    Dropping a handle does not cancel the task; it still runs.
+*/
+template <typename R>
+class task_handle {
+ public:
+  // Default constructor; the handle refers to no task.
+  task_handle() : m_task(nullptr), m_pool(nullptr) {}
+
+  task_handle(const task_handle &) = delete;
+  task_handle &operator=(const task_handle &) = delete;
+
+  // Move constructor
+  task_handle(task_handle &&right)
+      : m_task(right.m_task), m_pool(right.m_pool) {
+    right.m_task = nullptr;
+  }
+
+  // Move assignment operator
+  task_handle &operator=(task_handle &&right) {
+    if (this != &right) {
+      if (m_task != nullptr) m_task->release();
+      m_task = right.m_task;
+      m_pool = right.m_pool;
+      right.m_task = nullptr;
+    }
+    return *this;
+  }
+
+  // Destructor
+  ~task_handle() {
+    if (m_task != nullptr) m_task->release();
+  }
+
+  // Checks whether the handle refers to a task.
+  bool valid() const { return m_task != nullptr; }
+
+  // Checks whether the task has finished.
+  bool ready() const {
+    return m_task->done().load(std::memory_order_acquire);
+  }
+
+  // Waits until the task has finished. A worker of the task's pool runs
+  // other tasks meanwhile; any other thread sleeps.
+  void wait() const {
+    const std::atomic<bool> &done = m_task->done();
+    if (m_pool->current_worker() != nullptr) {
+      m_pool->help_until(
+          [&done]() { return done.load(std::memory_order_acquire); });
+      return;
+    }
+    while (!done.load(std::memory_order_acquire)) {
+      done.wait(false, std::memory_order_acquire);
+    }
+  }
+
+  // Waits for the task and returns its result, or rethrows the exception it
+  // threw. The handle is left empty.
+  R get() {
+    wait();
+    internal::result_task<R> *task = m_task;
+    m_task = nullptr;
+    struct releaser {
+      internal::result_task<R> *task;
+      ~releaser() { task->release(); }
+    } guard{task};
+    return task->take();
+  }
+
+ private:
+  friend class thread_pool;
+
+  task_handle(internal::result_task<R> *task, thread_pool *pool)
+      : m_task(task), m_pool(pool) {}
+
+  internal::result_task<R> *m_task;
+  thread_pool *m_pool;
+};
+}  // namespace open_stl
+
+#endif  // OPEN_STL_THREAD_POOL_H_
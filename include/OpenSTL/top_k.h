@@ -0,0 +1,106 @@
+#ifndef OPEN_STL_TOP_K_H_
+#define OPEN_STL_TOP_K_H_
+
+#include <OpenSTL/algorithm.h>
+#include <OpenSTL/functional.h>
+#include <OpenSTL/vector.h>
+
+#include <cstddef>
+
+namespace open_stl {
+/*
+    A streaming accumulator that keeps the k largest values seen so far.
+
+    Template Parameters:
+        - T: The type of the values.
+        - Compare: The ordering values are ranked by; the values ordered last
+   are the ones kept.
+
+    Values are pushed one at a time and memory never grows beyond k values,
+   so the accumulator can sit on an unbounded stream. The kept values form a
+   heap with the smallest of them on top: a value that does not beat the
+   smallest kept value is rejected after a single comparison, and any other
+   value replaces it in O(log k).
+*/
+template <typename T, typename Compare = less<T>>
+class top_k {
+ public:
+  using value_type = T;
+  using size_type = std::size_t;
+  using const_reference = const T &;
+  using const_iterator = const T *;
+
+  // Creates an accumulator that keeps at most `k` values.
+  explicit top_k(size_type k, Compare comp = Compare())
+      : m_heap(), m_k(k), m_comp(comp) {
+    m_heap.reserve(k);
+  }
+
+  // Offers a value to the accumulator. It is kept if fewer than k values are
+  // held or it is ordered after the smallest kept value.
+  void push(const_reference value) {
+    if (m_heap.size() < m_k) {
+      m_heap.push_back(value);
+      internal::sift_up(m_heap.begin(), m_heap.size() - 1, heap_compare());
+    } else if (m_k != 0 && m_comp(m_heap.front(), value)) {
+      m_heap.front() = value;
+      internal::sift_down(m_heap.begin(), 0, m_heap.size(), heap_compare());
+    }
+  }
+
+  // Offers every value of a range to the accumulator.
+  template <typename InputIterator>
+  void push(InputIterator first, InputIterator last) {
+    for (; first != last; ++first) {
+      push(*first);
+    }
+  }
+
+  // Returns the smallest kept value, i.e. the value a new one has to beat
+  // once the accumulator is full. The accumulator must not be empty.
+  const_reference threshold() const { return m_heap.front(); }
+
+  // Returns the kept values, the largest first.
+  vector<T> sorted() const {
+    vector<T> values(m_heap);
+    internal::sort_heap(values.begin(), values.end(), heap_compare());
+    return values;
+  }
+
+  // Returns an iterator to the first kept value, in unspecified order.
+  const_iterator begin() const { return m_heap.begin(); }
+
+  // Returns an iterator past the last kept value.
+  const_iterator end() const { return m_heap.end(); }
+
+  // Returns the number of values currently kept.
+  size_type size() const { return m_heap.size(); }
+
+  // Returns the maximum number of values kept.
+  size_type capacity() const { return m_k; }
+
+  // Checks whether no value is kept.
+  bool empty() const { return m_heap.empty(); }
+
+  // Discards every kept value.
+  void clear() { m_heap.clear(); }
+
+ private:
+  // Reverses the ordering so the heap helpers, which build max-heaps, keep
+  // the smallest value on top.
+  struct reversed {
+    Compare comp;
+    bool operator()(const T &lhs, const T &rhs) const {
+      return comp(rhs, lhs);
+    }
+  };
+
+  vector<T> m_heap;
+  size_type m_k;
+  Compare m_comp;
+
+  reversed heap_compare() const { return reversed{m_comp}; }
+};
+}  // namespace open_stl
+
+#endif  // OPEN_STL_TOP_K_H_
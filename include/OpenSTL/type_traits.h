@@ -48,5 +48,103 @@ struct is_same<T, T> {
   static constexpr bool value = true;
 };
 
+/*
+    Template struct to strip a reference from a type.
+
+    Template Parameters:
+        - T: The type to be stripped.
+
+    Members:
+        - type: T with any lvalue or rvalue reference removed.
+*/
+template <typename T>
+struct remove_reference {
+  using type = T;
+};
+
+template <typename T>
+struct remove_reference<T &> {
+  using type = T;
+};
+
+template <typename T>
+struct remove_reference<T &&> {
+  using type = T;
+};
+
+/*
+    Template struct to strip top-level const and volatile qualifiers.
+
+    Template Parameters:
+        - T: The type to be stripped.
+
+    Members:
+        - type: T without its top-level cv-qualifiers.
+*/
+template <typename T>
+struct remove_cv {
+  using type = T;
+};
+
+template <typename T>
+struct remove_cv<const T> {
+  using type = T;
+};
+
+template <typename T>
+struct remove_cv<volatile T> {
+  using type = T;
+};
+
+template <typename T>
+struct remove_cv<const volatile T> {
+  using type = T;
+};
+
+/*
+    Alias that strips references first and cv-qualifiers second, yielding the
+   plain value type of an expression such as `*iterator`.
+*/
+template <typename T>
+using remove_cvref_t =
+    typename remove_cv<typename remove_reference<T>::type>::type;
+
+/*
+    Template struct to determine if one class is a base of another.
+
+    Template Parameters:
+        - Base: The candidate base class.
+        - Derived: The candidate derived class.
+
+    Members:
+        - value: True if Derived is Base or derives from it, false otherwise.
+
+    The check relies on the compiler intrinsic that every supported toolchain
+   (GCC, Clang and MSVC) provides, since it cannot be written portably in the
+   language itself.
+*/
+template <typename Base, typename Derived>
+struct is_base_of {
+  static constexpr bool value = __is_base_of(Base, Derived);
+};
+
+/*
+    Template struct to determine if a type can be copied with memcpy.
+
+    Template Parameters:
+        - T: The type to check.
+
+    Members:
+        - value: True if T is trivially copyable, false otherwise.
+
+    Containers use this to move blocks of elements with a single memcpy
+   instead of an element-by-element loop. Like is_base_of it relies on a
+   compiler intrinsic.
+*/
+template <typename T>
+struct is_trivially_copyable {
+  static constexpr bool value = __is_trivially_copyable(T);
+};
+
 }  // namespace open_stl
 #endif  // OPEN_STL_TYPE_TRAITS_H_
\ No newline at end of file
@@ -1,6 +1,8 @@
 #ifndef OPEN_STL_UTILITY_H_
 #define OPEN_STL_UTILITY_H_
 
+#include <OpenSTL/type_traits.h>
+
 namespace open_stl {
 /*
     Performs a cast to an rvalue reference, enabling move semantics.
@@ -18,10 +20,36 @@ namespace open_stl {
    be "moved" to an rvalue reference, avoiding unnecessary copies.
 */
 template <typename T>
-inline T &&move(const T &val) {
+constexpr T &&move(const T &val) {
   return (T &&)val;
 }
 
+/*
+    Forwards a function argument with the value category it was passed with.
+
+    Template Parameters:
+        - T: The deduced type of a forwarding reference parameter.
+
+    Parameters:
+        - val: The parameter to forward.
+
+    Returns:
+        - An rvalue reference if the argument was an rvalue, an lvalue
+   reference otherwise.
+
+    Containers use this in their emplace functions so arguments given as
+   temporaries are moved into the new element instead of copied.
+*/
+template <typename T>
+constexpr T &&forward(typename remove_reference<T>::type &val) {
+  return static_cast<T &&>(val);
+}
+
+template <typename T>
+constexpr T &&forward(typename remove_reference<T>::type &&val) {
+  return static_cast<T &&>(val);
+}
+
 /*
     Swaps the values of two objects of the same type.
 
@@ -35,12 +63,77 @@ inline T &&move(const T &val) {
    function to work correctly.
 */
 template <typename T>
-void swap(T &a, T &b) {
+constexpr void swap(T &a, T &b) {
   T temp = move(a);
   a = move(b);
   b = move(temp);
 }
 
+/*
+    Stores two heterogeneous values as a single object.
+
+    Template Parameters:
+        - T1: The type of the first value.
+        - T2: The type of the second value.
+
+    Members:
+        - first: The first value.
+        - second: The second value.
+
+    Pairs compare lexicographically: first by `first`, then by `second`.
+*/
+template <typename T1, typename T2>
+struct pair {
+  using first_type = T1;
+  using second_type = T2;
+
+  T1 first;
+  T2 second;
+
+  constexpr pair() : first(), second() {}
+
+  constexpr pair(const T1 &first_value, const T2 &second_value)
+      : first(first_value), second(second_value) {}
+
+  constexpr bool operator==(const pair &right) const {
+    return first == right.first && second == right.second;
+  }
+
+  constexpr bool operator!=(const pair &right) const {
+    return !(*this == right);
+  }
+
+  constexpr bool operator<(const pair &right) const {
+    return first < right.first ||
+           (!(right.first < first) && second < right.second);
+  }
+};
+
+/*
+    Creates a pair, deducing its types from the arguments.
+
+    Parameters:
+        - first: The first value.
+        - second: The second value.
+
+    Returns:
+        - A pair holding copies of both values.
+*/
+template <typename T1, typename T2>
+constexpr pair<T1, T2> make_pair(const T1 &first, const T2 &second) {
+  return pair<T1, T2>(first, second);
+}
+
+/*
+    Tag type telling a sorted container that its input is already sorted and
+   free of duplicates, so construction can skip sorting.
+*/
+struct sorted_unique_t {
+  explicit sorted_unique_t() = default;
+};
+
+inline constexpr sorted_unique_t sorted_unique{};
+
 }  // namespace open_stl
 
 #endif  // OPEN_STL_UTILITY_H_
\ No newline at end of file
@@ -2,6 +2,7 @@
 #define OPEN_STL_VECTOR_H_
 
 #include <OpenSTL/algorithm.h>
+#include <OpenSTL/internal/bit_ops.h>
 #include <OpenSTL/internal/reverse_iterator.h>
 #include <OpenSTL/memory.h>
 #include <OpenSTL/utility.h>
@@ -322,13 +323,17 @@ class vector {
 
   // Assigns the contents of another vector to this vector.
   vector& operator=(const vector& right) {
-    delete[] m_data;
+    if (this == &right) return *this;
+    Allocator alloc;
+    alloc.deallocate(m_data);
+    m_data = nullptr;
+    m_size = 0;
+    m_capacity = 0;
     re_allocate(right.m_size);
     for (size_type i = 0; i < right.m_size; i++) {
       m_data[i] = right[i];
     }
     m_size = right.m_size;
-    m_capacity = right.m_capacity;
     return *this;
   }
 
@@ -420,6 +425,435 @@ class vector {
     m_capacity = new_capacity;
   }
 };
+
+/*
+    A vector of bools packed 64 to a word.
+
+    Template Parameters:
+        - Allocator: The allocator; it is rebound to allocate the words.
+
+    Storing one bit per element takes an eighth of the memory of one bool
+   per byte, and lets whole-vector operations work a word at a time: count()
+   is one popcount per 64 elements and flip() one xor. Since single bits
+   cannot be addressed, operator[] and iterators hand out bit_reference
+   proxies instead of bool&. Bits past size() in the last word are kept
+   zero.
+*/
+template <typename Allocator>
+class vector<bool, Allocator> {
+ public:
+  using value_type = bool;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference = internal::bit_reference;
+  using const_reference = bool;
+  using iterator = internal::bit_iterator<internal::bit_word>;
+  using const_iterator = internal::bit_iterator<const internal::bit_word>;
+  using const_reverse_iterator = internal::reverse_iterator<const_iterator>;
+  using reverse_iterator = internal::reverse_iterator<iterator>;
+
+  // Default constructor
+  vector() : m_words(nullptr), m_size(0), m_capacity(0) {}
+
+  // Constructor taking an std::initializer_list
+  vector(const std::initializer_list<bool>& values) : vector() {
+    reserve(values.size());
+    for (bool value : values) {
+      push_back(value);
+    }
+  }
+
+  // Constructor with size argument; every element is false
+  explicit vector(size_type count) : vector() { resize(count); }
+
+  // Constructor with size and value arguments
+  explicit vector(size_type count, bool value) : vector() {
+    resize(count, value);
+  }
+
+  // Copy constructor
+  vector(const vector& right) : vector() {
+    re_allocate(right.m_size);
+    for (size_type i = 0; i < internal::word_count(right.m_size); i++) {
+      m_words[i] = right.m_words[i];
+    }
+    m_size = right.m_size;
+  }
+
+  // Move constructor
+  vector(vector&& right)
+      : m_words(right.m_words),
+        m_size(right.m_size),
+        m_capacity(right.m_capacity) {
+    right.m_words = nullptr;
+    right.m_size = 0;
+    right.m_capacity = 0;
+  }
+
+  // Destructor
+  ~vector() {
+    word_allocator alloc;
+    alloc.deallocate(m_words);
+  }
+
+  // Returns the element at the specified position, checking the bounds.
+  reference at(size_type off) {
+    check_index(off);
+    return (*this)[off];
+  }
+
+  // Returns the element at the specified position, checking the bounds.
+  const_reference at(size_type off) const {
+    check_index(off);
+    return (*this)[off];
+  }
+
+  // Returns the element at the specified position.
+  reference operator[](size_type position) {
+    return reference(m_words + position / internal::bits_per_word,
+                     internal::bit_mask(position));
+  }
+
+  // Returns the element at the specified position.
+  const_reference operator[](size_type position) const {
+    return (m_words[position / internal::bits_per_word] &
+            internal::bit_mask(position)) != 0;
+  }
+
+  // Returns the first element
+  reference front() { return (*this)[0]; }
+
+  // Returns the first element
+  const_reference front() const { return (*this)[0]; }
+
+  // Returns the last element
+  reference back() { return (*this)[m_size - 1]; }
+
+  // Returns the last element
+  const_reference back() const { return (*this)[m_size - 1]; }
+
+  // Returns an iterator pointing to the first element of the vector
+  iterator begin() { return iterator(m_words, 0); }
+
+  // Returns a const iterator pointing to the first element of the vector
+  const_iterator begin() const { return const_iterator(m_words, 0); }
+
+  // Returns a const iterator pointing to the first element of the vector
+  const_iterator cbegin() const { return begin(); }
+
+  // Returns a reverse iterator pointing to the last element of the vector
+  reverse_iterator rbegin() { return reverse_iterator(end() - 1); }
+
+  // Returns a const reverse iterator pointing to the last element of the vector
+  const_reverse_iterator rbegin() const {
+    return const_reverse_iterator(end() - 1);
+  }
+
+  // Returns a const reverse iterator pointing to the last element of the vector
+  const_reverse_iterator crbegin() const { return rbegin(); }
+
+  // Returns an iterator pointing to the past-the-end element of the vector
+  iterator end() { return iterator(m_words, m_size); }
+
+  // Returns a const iterator pointing to the past-the-end element of the
+  // vector
+  const_iterator end() const { return const_iterator(m_words, m_size); }
+
+  // Returns a const iterator pointing to the past-the-end element of the
+  // vector
+  const_iterator cend() const { return end(); }
+
+  // Returns a reverse iterator pointing to the element before the first element
+  // of the vector
+  reverse_iterator rend() { return reverse_iterator(begin() - 1); }
+
+  // Returns a const reverse iterator pointing to the element before the first
+  // element of the vector
+  const_reverse_iterator rend() const {
+    return const_reverse_iterator(begin() - 1);
+  }
+
+  // Returns a const reverse iterator pointing to the element before the first
+  // element of the vector
+  const_reverse_iterator crend() const { return rend(); }
+
+  // Returns the words holding the bits; bit i is bit i % 64 of word i / 64.
+  const internal::bit_word* data() const { return m_words; }
+
+  // Returns the number of elements currently stored in the vector.
+  size_type size() const { return m_size; }
+
+  // Returns the number of elements the vector can hold without resizing.
+  size_type capacity() const { return m_capacity; }
+
+  // Checks whether the vector is empty
+  bool empty() const { return m_size == 0; }
+
+  // Clears all elements from the vector, making it empty.
+  void clear() { resize(0); }
+
+  // Reserves memory for at least a specified number of elements.
+  void reserve(size_type count) {
+    if (count > m_capacity) re_allocate(count);
+  }
+
+  // Changes the size of the vector; new elements are set to `value`.
+  void resize(size_type new_size, bool value = false) {
+    if (new_size > m_capacity) {
+      re_allocate(m_capacity * 2 > new_size ? m_capacity * 2 : new_size);
+    }
+    if (new_size > m_size) {
+      if (value) set_range(m_size, new_size);
+    } else {
+      clear_tail(new_size);
+    }
+    m_size = new_size;
+  }
+
+  // Reduces the capacity of the vector to match its size.
+  void shrink_to_fit() {
+    if (m_capacity > internal::word_count(m_size) * internal::bits_per_word) {
+      re_allocate(m_size);
+    }
+  }
+
+  // Adds a value to the end of the vector.
+  void push_back(bool value) {
+    if (m_size == m_capacity) {
+      re_allocate(m_capacity == 0 ? internal::bits_per_word : m_capacity * 2);
+    }
+    if (value) (*this)[m_size] = true;
+    m_size++;
+  }
+
+  // Removes the last element from the vector.
+  void pop_back() {
+    m_size--;
+    (*this)[m_size] = false;
+  }
+
+  // Constructs an element from `args` at the end of the vector.
+  template <typename... Args>
+  void emplace_back(Args&&... args) {
+    push_back(bool(open_stl::forward<Args>(args)...));
+  }
+
+  // Constructs an element from `args` at the specified position, shifting
+  // the later elements up a word at a time.
+  template <typename... Args>
+  iterator emplace(const_iterator position, Args&&... args) {
+    bool value(open_stl::forward<Args>(args)...);
+    size_type off = position - cbegin();
+    if (m_size == m_capacity) {
+      re_allocate(m_capacity == 0 ? internal::bits_per_word : m_capacity * 2);
+    }
+    m_size++;
+    move_bits(off + 1, off, m_size - 1 - off);
+    (*this)[off] = value;
+    return begin() + off;
+  }
+
+  // Erases an element from the vector.
+  iterator erase(const_iterator position) {
+    return erase(position, position + 1);
+  }
+
+  // Erases a range of elements from the vector, shifting the later elements
+  // down a word at a time.
+  iterator erase(const_iterator first, const_iterator last) {
+    size_type off = first - cbegin();
+    size_type count = last - first;
+    move_bits(off, off + count, m_size - off - count);
+    clear_tail(m_size - count);
+    m_size -= count;
+    return begin() + off;
+  }
+
+  // Inverts every element.
+  void flip() {
+    size_type words = internal::word_count(m_size);
+    for (size_type i = 0; i < words; i++) {
+      m_words[i] = ~m_words[i];
+    }
+    if (words != 0) m_words[words - 1] &= internal::last_word_mask(m_size);
+  }
+
+  // Returns the number of elements that are true.
+  size_type count() const {
+    return internal::popcount_words(m_words, internal::word_count(m_size));
+  }
+
+  // Swaps the contents of two vectors.
+  void swap(vector& right) {
+    open_stl::swap(m_words, right.m_words);
+    open_stl::swap(m_size, right.m_size);
+    open_stl::swap(m_capacity, right.m_capacity);
+  }
+
+  // Assigns the contents of another vector to this vector.
+  vector& operator=(const vector& right) {
+    if (this != &right) {
+      vector copy(right);
+      swap(copy);
+    }
+    return *this;
+  }
+
+  // Assigns the contents of another vector to this vector using move
+  // semantics.
+  vector& operator=(vector&& right) {
+    if (this != &right) {
+      vector moved(move(right));
+      swap(moved);
+    }
+    return *this;
+  }
+
+  // Checks if this vector equal to another vector, a word at a time.
+  bool operator==(const vector& right) const {
+    if (m_size != right.m_size) return false;
+    for (size_type i = 0; i < internal::word_count(m_size); i++) {
+      if (m_words[i] != right.m_words[i]) return false;
+    }
+    return true;
+  }
+
+  // Checks if this vector is not equal to another vector.
+  bool operator!=(const vector& right) const { return !(*this == right); }
+
+  // Checks if this vector is lexicographically less than another vector.
+  bool operator<(const vector& right) const { return compare(right) < 0; }
+
+  // Checks if this vector is lexicographically less than or equal to another
+  // vector.
+  bool operator<=(const vector& right) const { return compare(right) <= 0; }
+
+  // Checks if this vector is greater than to another vector.
+  bool operator>(const vector& right) const { return compare(right) > 0; }
+
+  // Checks if this vector is greater than or equal to another vector.
+  bool operator>=(const vector& right) const { return compare(right) >= 0; }
+
+ private:
+  using word_allocator =
+      typename Allocator::template rebind<internal::bit_word>::other;
+
+  internal::bit_word* m_words;
+  size_type m_size;
+  // Always a multiple of the word size.
+  size_type m_capacity;
+
+  // Moves the bits into storage for at least `bits` bits; new words are
+  // zeroed.
+  void re_allocate(size_type bits) {
+    size_type words = internal::word_count(bits);
+    size_type kept = internal::word_count(m_size);
+    word_allocator alloc;
+    internal::bit_word* new_words = nullptr;
+    if (words != 0) new_words = alloc.allocate(words);
+    for (size_type i = 0; i < words; i++) {
+      new_words[i] = i < kept ? m_words[i] : 0;
+    }
+    alloc.deallocate(m_words);
+    m_words = new_words;
+    m_capacity = words * internal::bits_per_word;
+  }
+
+  // Sets the bits in [first, last).
+  void set_range(size_type first, size_type last) {
+    for (; first < last && first % internal::bits_per_word != 0; first++) {
+      (*this)[first] = true;
+    }
+    for (; last - first >= internal::bits_per_word;
+         first += internal::bits_per_word) {
+      m_words[first / internal::bits_per_word] = ~internal::bit_word(0);
+    }
+    for (; first < last; first++) {
+      (*this)[first] = true;
+    }
+  }
+
+  // Returns the `count` bits, at most a word, starting at bit `first`.
+  internal::bit_word load_bits(size_type first, size_type count) const {
+    size_type word = first / internal::bits_per_word;
+    size_type shift = first % internal::bits_per_word;
+    internal::bit_word bits = m_words[word] >> shift;
+    if (shift != 0 && shift + count > internal::bits_per_word) {
+      bits |= m_words[word + 1] << (internal::bits_per_word - shift);
+    }
+    return bits & internal::last_word_mask(count);
+  }
+
+  // Overwrites the `count` bits, at most a word, starting at bit `first`.
+  void store_bits(size_type first, internal::bit_word bits, size_type count) {
+    internal::bit_word mask = internal::last_word_mask(count);
+    size_type word = first / internal::bits_per_word;
+    size_type shift = first % internal::bits_per_word;
+    m_words[word] = (m_words[word] & ~(mask << shift)) | (bits << shift);
+    if (shift != 0 && shift + count > internal::bits_per_word) {
+      size_type high = internal::bits_per_word - shift;
+      m_words[word + 1] =
+          (m_words[word + 1] & ~(mask >> high)) | (bits >> high);
+    }
+  }
+
+  // Copies the `count` bits at `from` to `to`, a word at a time. The ranges
+  // may overlap: the copy runs away from the side it writes to.
+  void move_bits(size_type to, size_type from, size_type count) {
+    if (to < from) {
+      for (size_type done = 0; done < count;
+           done += internal::bits_per_word) {
+        size_type length = count - done < internal::bits_per_word
+                               ? count - done
+                               : internal::bits_per_word;
+        store_bits(to + done, load_bits(from + done, length), length);
+      }
+    } else if (to > from) {
+      while (count != 0) {
+        size_type length =
+            count < internal::bits_per_word ? count : internal::bits_per_word;
+        count -= length;
+        store_bits(to + count, load_bits(from + count, length), length);
+      }
+    }
+  }
+
+  // Compares lexicographically: the first differing bit is the lowest set
+  // bit of the xor of two words, and the shorter vector is less if one is a
+  // prefix of the other.
+  int compare(const vector& right) const {
+    size_type common = m_size < right.m_size ? m_size : right.m_size;
+    size_type words = internal::word_count(common);
+    for (size_type i = 0; i < words; i++) {
+      internal::bit_word difference = m_words[i] ^ right.m_words[i];
+      if (i == words - 1) difference &= internal::last_word_mask(common);
+      if (difference != 0) {
+        return (m_words[i] & (difference & -difference)) != 0 ? 1 : -1;
+      }
+    }
+    if (m_size == right.m_size) return 0;
+    return m_size < right.m_size ? -1 : 1;
+  }
+
+  // Clears the bits from `first` up to the current size.
+  void clear_tail(size_type first) {
+    size_type words = internal::word_count(m_size);
+    size_type word = first / internal::bits_per_word;
+    if (word >= words) return;
+    m_words[word] &= internal::bit_mask(first) - 1;
+    for (size_type i = word + 1; i < words; i++) {
+      m_words[i] = 0;
+    }
+  }
+
+  void check_index(size_type off) const {
+    if (off >= m_size) {
+      throw std::out_of_range(
+          "Error: vector index out of range. Please ensure the index is within "
+          "the valid range.");
+    }
+  }
+};
 }  // namespace open_stl
 
 #endif  // OPEN_STL_VECTOR_H_
\ No newline at end of file
@@ -1,6 +1,10 @@
 #include <OpenSTL/algorithm.h>
+#include <OpenSTL/vector.h>
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <random>
+
 TEST(lexicographical_compare, EqualRanges) {
   int lhs[] = {1, 2, 3};
   int rhs[] = {1, 2, 3};
@@ -8,6 +12,274 @@ TEST(lexicographical_compare, EqualRanges) {
             false);
 }
 
+TEST(lower_bound, random_access) {
+  open_stl::vector<int> vec = {1, 2, 2, 2, 5, 7, 9};
+  EXPECT_EQ(open_stl::lower_bound(vec.begin(), vec.end(), 0), vec.begin());
+  EXPECT_EQ(open_stl::lower_bound(vec.begin(), vec.end(), 2), vec.begin() + 1);
+  EXPECT_EQ(open_stl::lower_bound(vec.begin(), vec.end(), 3), vec.begin() + 4);
+  EXPECT_EQ(open_stl::lower_bound(vec.begin(), vec.end(), 9), vec.begin() + 6);
+  EXPECT_EQ(open_stl::lower_bound(vec.begin(), vec.end(), 10), vec.end());
+
+  open_stl::vector<int> empty;
+  EXPECT_EQ(open_stl::lower_bound(empty.begin(), empty.end(), 1), empty.end());
+}
+
+TEST(lower_bound, matches_linear_search) {
+  // Every length up to 64 and every probe, including between and beyond the
+  // stored values, to cover each shape of the halving loop.
+  for (int length = 0; length <= 64; length++) {
+    open_stl::vector<int> vec(length);
+    for (int i = 0; i < length; i++) {
+      vec[i] = 2 * i;
+    }
+    for (int value = -1; value <= 2 * length + 1; value++) {
+      int lower = 0;
+      while (lower < length && vec[lower] < value) lower++;
+      int upper = 0;
+      while (upper < length && vec[upper] <= value) upper++;
+      ASSERT_EQ(open_stl::lower_bound(vec.begin(), vec.end(), value) -
+                    vec.begin(),
+                lower);
+      ASSERT_EQ(open_stl::upper_bound(vec.begin(), vec.end(), value) -
+                    vec.begin(),
+                upper);
+    }
+  }
+}
+
+TEST(upper_bound, custom_comparator) {
+  open_stl::vector<int> vec = {9, 7, 7, 4, 1};
+  auto greater = [](int lhs, int rhs) { return lhs > rhs; };
+  EXPECT_EQ(open_stl::upper_bound(vec.begin(), vec.end(), 7, greater),
+            vec.begin() + 3);
+  EXPECT_EQ(open_stl::lower_bound(vec.begin(), vec.end(), 7, greater),
+            vec.begin() + 1);
+}
+
+TEST(equal_range, duplicates) {
+  open_stl::vector<int> vec = {1, 3, 3, 3, 4};
+  auto range = open_stl::equal_range(vec.begin(), vec.end(), 3);
+  EXPECT_EQ(range.first, vec.begin() + 1);
+  EXPECT_EQ(range.second, vec.begin() + 4);
+
+  range = open_stl::equal_range(vec.begin(), vec.end(), 2);
+  EXPECT_EQ(range.first, range.second);
+}
+
+TEST(binary_search, found_and_missing) {
+  int values[] = {2, 4, 6, 8};
+  EXPECT_TRUE(open_stl::binary_search(values, values + 4, 6));
+  EXPECT_FALSE(open_stl::binary_search(values, values + 4, 5));
+  EXPECT_FALSE(open_stl::binary_search(values, values + 4, 9));
+  EXPECT_FALSE(open_stl::binary_search(values, values, 2));
+}
+
+namespace {
+// Inputs that defeat naive pivot choices: sorted, reversed, all equal,
+// few distinct values, organ pipe and random.
+open_stl::vector<open_stl::vector<int>> selection_inputs() {
+  open_stl::vector<open_stl::vector<int>> inputs;
+  const int size = 1000;
+  std::mt19937 rng(42);
+  for (int shape = 0; shape < 6; shape++) {
+    open_stl::vector<int> values(size);
+    for (int i = 0; i < size; i++) {
+      switch (shape) {
+        case 0: values[i] = i; break;
+        case 1: values[i] = size - i; break;
+        case 2: values[i] = 7; break;
+        case 3: values[i] = i % 3; break;
+        case 4: values[i] = i < size / 2 ? i : size - i; break;
+        default: values[i] = static_cast<int>(rng() % 500); break;
+      }
+    }
+    inputs.push_back(values);
+  }
+  return inputs;
+}
+}  // namespace
+
+TEST(nth_element, selects_sorted_element) {
+  open_stl::vector<open_stl::vector<int>> inputs = selection_inputs();
+  for (const open_stl::vector<int> &input : inputs) {
+    open_stl::vector<int> sorted(input);
+    std::sort(sorted.begin(), sorted.end());
+    for (int nth : {0, 1, 499, 500, 989, 990, 999}) {
+      open_stl::vector<int> values(input);
+      open_stl::nth_element(values.begin(), values.begin() + nth,
+                            values.end());
+      ASSERT_EQ(values[nth], sorted[nth]);
+      for (int i = 0; i < nth; i++) {
+        ASSERT_LE(values[i], values[nth]);
+      }
+      for (int i = nth + 1; i < 1000; i++) {
+        ASSERT_GE(values[i], values[nth]);
+      }
+    }
+  }
+}
+
+TEST(nth_element, small_ranges_and_comparator) {
+  open_stl::vector<int> values = {5, 1, 4};
+  open_stl::nth_element(values.begin(), values.begin() + 1, values.end());
+  EXPECT_EQ(values[1], 4);
+
+  open_stl::vector<int> latencies = {12, 3, 40, 7, 25, 9, 31, 18};
+  auto greater = [](int lhs, int rhs) { return lhs > rhs; };
+  open_stl::nth_element(latencies.begin(), latencies.begin(), latencies.end(),
+                        greater);
+  EXPECT_EQ(latencies[0], 40);
+
+  open_stl::vector<int> empty;
+  open_stl::nth_element(empty.begin(), empty.begin(), empty.end());
+}
+
+TEST(partial_sort, sorts_front) {
+  open_stl::vector<open_stl::vector<int>> inputs = selection_inputs();
+  for (const open_stl::vector<int> &input : inputs) {
+    open_stl::vector<int> sorted(input);
+    std::sort(sorted.begin(), sorted.end());
+    open_stl::vector<int> values(input);
+    open_stl::partial_sort(values.begin(), values.begin() + 10, values.end());
+    for (int i = 0; i < 10; i++) {
+      ASSERT_EQ(values[i], sorted[i]);
+    }
+  }
+}
+
+TEST(partial_sort_copy, output_shorter_and_longer) {
+  int values[] = {9, 2, 7, 4, 5, 1};
+  open_stl::vector<int> out(3);
+  int *end = open_stl::partial_sort_copy(values, values + 6, out.begin(),
+                                         out.end());
+  EXPECT_EQ(end, out.end());
+  EXPECT_EQ(out, open_stl::vector<int>({1, 2, 4}));
+  // The input is left untouched.
+  EXPECT_EQ(values[0], 9);
+
+  open_stl::vector<int> wide(8, -1);
+  end = open_stl::partial_sort_copy(values, values + 6, wide.begin(),
+                                    wide.end(),
+                                    [](int lhs, int rhs) { return lhs > rhs; });
+  EXPECT_EQ(end, wide.begin() + 6);
+  EXPECT_EQ(wide, open_stl::vector<int>({9, 7, 5, 4, 2, 1, -1, -1}));
+}
+
+TEST(sort, matches_std_sort) {
+  open_stl::vector<open_stl::vector<int>> inputs = selection_inputs();
+  for (const open_stl::vector<int> &input : inputs) {
+    open_stl::vector<int> expected(input);
+    std::sort(expected.begin(), expected.end());
+    open_stl::vector<int> values(input);
+    open_stl::sort(values.begin(), values.end());
+    ASSERT_EQ(values, expected);
+  }
+
+  open_stl::vector<int> values = {3, 1, 2};
+  open_stl::sort(values.begin(), values.end(),
+                 [](int lhs, int rhs) { return lhs > rhs; });
+  EXPECT_EQ(values, open_stl::vector<int>({3, 2, 1}));
+}
+
+TEST(sort, heap_sort_fallback) {
+  // A depth limit of zero sends every range straight to heap sort.
+  open_stl::vector<int> values = selection_inputs()[5];
+  open_stl::vector<int> expected(values);
+  std::sort(expected.begin(), expected.end());
+  open_stl::internal::introsort(values.begin(), values.end(),
+                                open_stl::less<>(), 0);
+  EXPECT_EQ(values, expected);
+}
+
+TEST(unique, removes_consecutive_duplicates) {
+  open_stl::vector<int> values = {1, 1, 2, 2, 2, 3, 1, 1};
+  int *end = open_stl::unique(values.begin(), values.end());
+  EXPECT_EQ(end - values.begin(), 4);
+  EXPECT_EQ(values[0], 1);
+  EXPECT_EQ(values[1], 2);
+  EXPECT_EQ(values[2], 3);
+  EXPECT_EQ(values[3], 1);
+
+  open_stl::vector<int> empty;
+  EXPECT_EQ(open_stl::unique(empty.begin(), empty.end()), empty.end());
+
+  // With a custom predicate: collapse runs with the same parity.
+  open_stl::vector<int> parity = {1, 3, 5, 2, 4, 7};
+  end = open_stl::unique(parity.begin(), parity.end(),
+                         [](int lhs, int rhs) { return lhs % 2 == rhs % 2; });
+  EXPECT_EQ(end - parity.begin(), 3);
+  EXPECT_EQ(parity[2], 7);
+}
+
+TEST(heap, push_pop_make_and_sort) {
+  std::mt19937 random(9);
+  open_stl::vector<int> values;
+  for (int i = 0; i < 1000; i++) {
+    values.push_back(int(random() % 500));
+    open_stl::push_heap(values.begin(), values.end());
+    ASSERT_TRUE(std::is_heap(values.begin(), values.end()));
+  }
+  EXPECT_TRUE(open_stl::is_heap(values.begin(), values.end()));
+
+  open_stl::vector<int> popped;
+  for (auto end = values.end(); end != values.begin(); --end) {
+    open_stl::pop_heap(values.begin(), end);
+    popped.push_back(*(end - 1));
+  }
+  EXPECT_TRUE(std::is_sorted(popped.begin(), popped.end(),
+                             [](int lhs, int rhs) { return lhs > rhs; }));
+
+  open_stl::vector<int> shuffled = {4, 8, 1, 9, 3, 7, 2};
+  auto greater = [](int lhs, int rhs) { return lhs > rhs; };
+  open_stl::make_heap(shuffled.begin(), shuffled.end(), greater);
+  EXPECT_EQ(shuffled.front(), 1);
+  EXPECT_TRUE(open_stl::is_heap(shuffled.begin(), shuffled.end(), greater));
+  EXPECT_FALSE(open_stl::is_heap(shuffled.begin(), shuffled.end()));
+  open_stl::sort_heap(shuffled.begin(), shuffled.end(), greater);
+  EXPECT_EQ(shuffled, open_stl::vector<int>({9, 8, 7, 4, 3, 2, 1}));
+}
+
+TEST(fill, assigns_every_element) {
+  open_stl::vector<int> values(5);
+  open_stl::fill(values.begin(), values.end(), 9);
+  EXPECT_EQ(values, open_stl::vector<int>({9, 9, 9, 9, 9}));
+}
+
+TEST(transform, unary_and_binary) {
+  int values[] = {1, 2, 3, 4};
+  int squares[4];
+  int *end = open_stl::transform(values, values + 4, squares,
+                                 [](int value) { return value * value; });
+  EXPECT_EQ(end, squares + 4);
+  EXPECT_EQ(squares[3], 16);
+
+  // In place, combining with a second range.
+  open_stl::transform(values, values + 4, squares, values,
+                      [](int lhs, int rhs) { return lhs + rhs; });
+  EXPECT_EQ(values[2], 12);
+}
+
+namespace {
+constexpr int sum_of_sorted_prefix() {
+  int values[] = {9, 4, 7, 1, 8, 2, 6, 3, 5, 0, 19, 14, 17, 11, 18, 12, 16, 13,
+                  15, 10};
+  open_stl::sort(values, values + 20);
+  open_stl::transform(values, values + 20, values,
+                      [](int value) { return value * 2; });
+  open_stl::fill(values + 10, values + 20, 0);
+  int sum = 0;
+  for (int value : values) {
+    sum += value;
+  }
+  return sum;
+}
+}  // namespace
+
+TEST(sort, evaluates_at_compile_time) {
+  // Twenty elements take the introsort path, not just insertion sort.
+  static_assert(sum_of_sorted_prefix() == 2 * 45);
+}
+
 int main(int argc, char **argv) {
   // Initialize Google Test
   ::testing::InitGoogleTest(&argc, argv);
@@ -161,6 +161,67 @@ TEST(array, assighnment_operator) {
   open_stl::array<int, 5> arr2 = {5, 4, 3, 2, 1};
   arr1 = arr2;
   EXPECT_EQ(arr1.front(), 5);
+  open_stl::array<int, 5> arr3 = arr1;
+  EXPECT_EQ(arr3, arr2);
+}
+
+namespace {
+// The CRC-32 table, computed entirely by the compiler.
+constexpr open_stl::array<unsigned, 256> crc_table =
+    open_stl::generate_array<unsigned, 256>([](std::size_t index) {
+      unsigned crc = unsigned(index);
+      for (int bit = 0; bit < 8; bit++) {
+        crc = (crc & 1) ? (crc >> 1) ^ 0xEDB88320u : crc >> 1;
+      }
+      return crc;
+    });
+
+constexpr bool sorts_at_compile_time() {
+  open_stl::array<int, 6> values = {5, 3, 6, 1, 4, 2};
+  open_stl::sort(values.begin(), values.end());
+  return values == open_stl::array<int, 6>{1, 2, 3, 4, 5, 6};
+}
+
+constexpr bool fills_and_swaps_at_compile_time() {
+  open_stl::array<int, 4> lhs;
+  open_stl::array<int, 4> rhs = {1, 2, 3, 4};
+  lhs.fill(7);
+  lhs.swap(rhs);
+  lhs.at(3) = lhs.front() + lhs.back();
+  rhs = lhs;
+  return rhs == open_stl::array<int, 4>{1, 2, 3, 5} && lhs[0] == 1;
+}
+
+// Fills a local array and returns it by copy.
+constexpr open_stl::array<int, 5> countdown() {
+  open_stl::array<int, 5> values;
+  for (int i = 0; i < 5; i++) {
+    values[i] = 5 - i;
+  }
+  return values;
+}
+}  // namespace
+
+TEST(array, constexpr_tables) {
+  static_assert(crc_table[0] == 0);
+  static_assert(crc_table[1] == 0x77073096u);
+  static_assert(crc_table[255] == 0x2D02EF8Du);
+  static_assert(sorts_at_compile_time());
+  static_assert(fills_and_swaps_at_compile_time());
+  static_assert(open_stl::array<int, 3>{1, 2, 3} <
+                open_stl::array<int, 3>{1, 2, 4});
+  static_assert(open_stl::array<int, 3>{1, 2, 3}.size() == 3);
+  static_assert(*(open_stl::array<int, 3>{4, 5, 6}.begin() + 1) == 5);
+  static_assert(countdown()[0] == 5 && countdown()[4] == 1);
+  static_assert(*countdown().rbegin() == 1);
+  static_assert(*(countdown().crbegin() + 1) == 2);
+
+  // The constexpr table is an ordinary array at run time.
+  unsigned crc = 0xFFFFFFFFu;
+  for (char c : {'1', '2', '3', '4', '5', '6', '7', '8', '9'}) {
+    crc = crc_table[(crc ^ unsigned(c)) & 0xFF] ^ (crc >> 8);
+  }
+  EXPECT_EQ(crc ^ 0xFFFFFFFFu, 0xCBF43926u);
 }
 
 int main(int argc, char **argv) {
@@ -0,0 +1,102 @@
+#include <OpenSTL/bloom_filter.h>
+#include <OpenSTL/string.h>
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <random>
+
+TEST(bloom_filter, has_no_false_negatives) {
+  open_stl::bloom_filter<std::uint64_t> filter(100000);
+  EXPECT_GE(filter.bit_count(), 1000000);
+  for (std::uint64_t key = 0; key < 100000; key++) {
+    filter.insert(key * 7919);
+  }
+  for (std::uint64_t key = 0; key < 100000; key++) {
+    ASSERT_TRUE(filter.contains(key * 7919));
+  }
+  filter.clear();
+  EXPECT_FALSE(filter.contains(0));
+}
+
+// The SIMD block operations must set and test the same bits as the scalar
+// masks.
+TEST(bloom_filter, block_operations_match_scalar_masks) {
+  std::mt19937 random(11);
+  for (int round = 0; round < 10000; round++) {
+    std::uint32_t hash = random();
+    std::uint32_t masks[open_stl::internal::bloom_block::lanes];
+    open_stl::internal::bloom_masks(hash, masks);
+
+    open_stl::internal::bloom_block block{};
+    open_stl::internal::bloom_insert(block, hash);
+    for (std::size_t lane = 0; lane < 8; lane++) {
+      ASSERT_EQ(block.words[lane], masks[lane]);
+    }
+    ASSERT_TRUE(open_stl::internal::bloom_contains(block, hash));
+
+    // A random block contains the key exactly when it has every mask bit.
+    bool expected = true;
+    for (std::size_t lane = 0; lane < 8; lane++) {
+      block.words[lane] = random() | random();
+      expected = expected && (block.words[lane] & masks[lane]) != 0;
+    }
+    ASSERT_EQ(open_stl::internal::bloom_contains(block, hash), expected);
+  }
+}
+
+TEST(bloom_filter, false_positive_rate_matches_bits_per_key) {
+  const std::size_t keys = 100000;
+  open_stl::bloom_filter<std::uint64_t> ten_bits(keys);
+  open_stl::bloom_filter<std::uint64_t> sixteen_bits(keys, 16);
+  for (std::uint64_t key = 0; key < keys; key++) {
+    ten_bits.insert(key);
+    sixteen_bits.insert(key);
+  }
+  std::size_t ten_bits_hits = 0;
+  std::size_t sixteen_bits_hits = 0;
+  for (std::uint64_t key = keys; key < 11 * keys; key++) {
+    ten_bits_hits += ten_bits.contains(key);
+    sixteen_bits_hits += sixteen_bits.contains(key);
+  }
+  // About 1% and 0.1% of the million absent keys.
+  EXPECT_LT(ten_bits_hits, 15000);
+  EXPECT_GT(ten_bits_hits, 5000);
+  EXPECT_LT(sixteen_bits_hits, 2000);
+}
+
+TEST(bloom_filter, batches_match_single_operations) {
+  const std::size_t count = 1000;
+  std::unique_ptr<open_stl::string[]> words(new open_stl::string[count]);
+  for (std::size_t i = 0; i < count; i++) {
+    words[i] = open_stl::string("word-");
+    words[i].append(i % 26 + 1, char('a' + i % 26));
+    words[i].append(i / 26 + 1, '!');
+  }
+  open_stl::bloom_filter<open_stl::string> batched(count / 2);
+  open_stl::bloom_filter<open_stl::string> single(count / 2);
+  batched.insert_batch(words.get(), count / 2);
+  for (std::size_t i = 0; i < count / 2; i++) {
+    single.insert(words[i]);
+  }
+  std::unique_ptr<bool[]> results(new bool[count]);
+  std::size_t found = batched.contains_batch(words.get(), count, results.get());
+  std::size_t expected = 0;
+  for (std::size_t i = 0; i < count; i++) {
+    ASSERT_EQ(results[i], single.contains(words[i]));
+    if (i < count / 2) {
+      ASSERT_TRUE(results[i]);
+    }
+    expected += results[i];
+  }
+  EXPECT_EQ(found, expected);
+}
+
+int main(int argc, char **argv) {
+  // Initialize Google Test
+  ::testing::InitGoogleTest(&argc, argv);
+
+  // Run tests
+  return RUN_ALL_TESTS();
+}
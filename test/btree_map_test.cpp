@@ -0,0 +1,164 @@
+#include <OpenSTL/btree_map.h>
+#include <gtest/gtest.h>
+
+#include <map>
+#include <random>
+#include <string>
+#include <type_traits>
+
+TEST(btree_map, insert_and_lookup) {
+  open_stl::btree_map<int, std::string> map;
+  EXPECT_TRUE(map.empty());
+  EXPECT_TRUE(map.begin() == map.end());
+  EXPECT_TRUE(map.insert(open_stl::pair<int, std::string>(3, "c")).second);
+  EXPECT_TRUE(map.emplace(1, "a").second);
+  EXPECT_FALSE(map.emplace(1, "z").second);
+  map[2] = "b";
+
+  EXPECT_EQ(map.size(), 3);
+  EXPECT_EQ(map.at(1), "a");
+  EXPECT_EQ(map.find(2)->second, "b");
+  EXPECT_TRUE(map.find(4) == map.end());
+  EXPECT_TRUE(map.contains(3));
+  EXPECT_EQ(map.count(0), 0);
+  EXPECT_THROW(map.at(4), std::out_of_range);
+
+  EXPECT_FALSE(map.insert_or_assign(3, "C").second);
+  EXPECT_EQ(map.at(3), "C");
+  EXPECT_EQ(map.lower_bound(2).key(), 2);
+  EXPECT_EQ(map.upper_bound(2).key(), 3);
+  EXPECT_TRUE(map.upper_bound(3) == map.end());
+
+  // Iterators convert to const iterators, never the other way round.
+  using map_type = open_stl::btree_map<int, std::string>;
+  static_assert(std::is_convertible_v<map_type::iterator,
+                                      map_type::const_iterator>);
+  static_assert(!std::is_constructible_v<map_type::iterator,
+                                         map_type::const_iterator>);
+  const map_type &view = map;
+  map_type::const_iterator found = view.find(1);
+  EXPECT_EQ(found.value(), "a");
+  EXPECT_EQ(view.at(3), "C");
+}
+
+TEST(btree_map, many_keys_stay_sorted) {
+  open_stl::btree_map<int, int> map;
+  for (int i = 0; i < 100000; i++) {
+    int key = (i * 7919) % 100000;
+    map.insert(open_stl::pair<int, int>(key, key * 2));
+  }
+  EXPECT_EQ(map.size(), 100000);
+  int expected = 0;
+  for (auto element : map) {
+    EXPECT_EQ(element.first, expected);
+    EXPECT_EQ(element.second, expected * 2);
+    expected++;
+  }
+  EXPECT_EQ(expected, 100000);
+
+  // Walk a range backwards from its upper bound.
+  auto it = map.upper_bound(50000);
+  for (int key = 50000; key > 49000; key--) {
+    --it;
+    EXPECT_EQ(it.key(), key);
+  }
+}
+
+TEST(btree_map, bulk_load_from_sorted_vectors) {
+  open_stl::vector<long> keys;
+  open_stl::vector<long> values;
+  for (long i = 0; i < 50000; i++) {
+    keys.push_back(i * 3);
+    values.push_back(i);
+  }
+  open_stl::btree_map<long, long> map(open_stl::sorted_unique, keys, values);
+  EXPECT_EQ(map.size(), 50000);
+  EXPECT_EQ(map.at(2997), 999);
+  EXPECT_FALSE(map.contains(2998));
+  EXPECT_EQ(map.lower_bound(2998).key(), 3000);
+
+  long expected = 0;
+  for (auto it = map.lower_bound(300); it != map.lower_bound(600); ++it) {
+    EXPECT_EQ(it.key(), 300 + expected * 3);
+    expected++;
+  }
+  EXPECT_EQ(expected, 100);
+
+  // The bulk-loaded tree accepts inserts and erases like any other.
+  map[1] = -1;
+  EXPECT_EQ(map.erase(3), 1);
+  EXPECT_EQ(map.erase(3), 0);
+  EXPECT_EQ(map.begin().key(), 0);
+  EXPECT_EQ((++map.begin()).key(), 1);
+  EXPECT_EQ((++++map.begin()).key(), 6);
+
+  open_stl::vector<long> no_values;
+  EXPECT_THROW((open_stl::btree_map<long, long>(open_stl::sorted_unique, keys,
+                                                no_values)),
+               std::invalid_argument);
+}
+
+TEST(btree_map, random_operations_match_std_map) {
+  std::mt19937 random(42);
+  open_stl::btree_map<int, int> map;
+  std::map<int, int> reference;
+  for (int round = 0; round < 200000; round++) {
+    int key = int(random() % 5000);
+    switch (random() % 4) {
+      case 0:
+      case 1:
+        EXPECT_EQ(map.insert(open_stl::pair<int, int>(key, round)).second,
+                  reference.emplace(key, round).second);
+        break;
+      case 2:
+        EXPECT_EQ(map.erase(key), reference.erase(key));
+        break;
+      default:
+        EXPECT_EQ(map.contains(key), reference.count(key) == 1);
+        break;
+    }
+  }
+  ASSERT_EQ(map.size(), reference.size());
+  auto it = map.begin();
+  for (const auto &element : reference) {
+    EXPECT_EQ(it.key(), element.first);
+    EXPECT_EQ(it.value(), element.second);
+    ++it;
+  }
+  EXPECT_TRUE(it == map.end());
+
+  // Erasing everything through iterators empties the tree.
+  for (auto position = map.begin(); position != map.end();) {
+    position = map.erase(position);
+  }
+  EXPECT_TRUE(map.empty());
+}
+
+TEST(btree_map, copy_move_and_compare) {
+  open_stl::btree_map<int, int> map;
+  for (int i = 0; i < 1000; i++) {
+    map[i] = i * i;
+  }
+  open_stl::btree_map<int, int> copy = map;
+  EXPECT_TRUE(copy == map);
+  copy[5] = 0;
+  EXPECT_TRUE(copy != map);
+  EXPECT_EQ(map.at(5), 25);
+
+  open_stl::btree_map<int, int> moved = open_stl::move(copy);
+  EXPECT_EQ(moved.size(), 1000);
+  EXPECT_TRUE(copy.empty());
+  moved.swap(copy);
+  EXPECT_TRUE(moved.empty());
+  EXPECT_EQ(copy.at(5), 0);
+  copy.clear();
+  EXPECT_TRUE(copy.begin() == copy.end());
+}
+
+int main(int argc, char **argv) {
+  // Initialize Google Test
+  ::testing::InitGoogleTest(&argc, argv);
+
+  // Run tests
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,73 @@
+#include <OpenSTL/btree_set.h>
+#include <gtest/gtest.h>
+
+#include <random>
+#include <set>
+#include <string>
+
+TEST(btree_set, insert_find_and_erase) {
+  open_stl::btree_set<std::string> set = {"pear", "apple", "fig", "apple"};
+  EXPECT_EQ(set.size(), 3);
+  EXPECT_EQ(*set.begin(), "apple");
+  EXPECT_TRUE(set.contains("fig"));
+  EXPECT_FALSE(set.insert("fig").second);
+  EXPECT_TRUE(set.emplace(3, 'k').second);
+  EXPECT_EQ(*set.lower_bound("b"), "fig");
+  EXPECT_EQ(*set.upper_bound("kkk"), "pear");
+  EXPECT_EQ(set.erase("apple"), 1);
+  EXPECT_EQ(set.count("apple"), 0);
+  auto it = set.erase(set.find("fig"));
+  EXPECT_EQ(*it, "kkk");
+}
+
+TEST(btree_set, bulk_load_and_range_scan) {
+  open_stl::vector<int> keys;
+  for (int i = 0; i < 100000; i++) {
+    keys.push_back(i * 2);
+  }
+  open_stl::btree_set<int> set(open_stl::sorted_unique, keys);
+  EXPECT_EQ(set.size(), 100000);
+  EXPECT_TRUE(set.contains(199998));
+  EXPECT_FALSE(set.contains(7));
+
+  long long sum = 0;
+  for (auto it = set.lower_bound(1000); it != set.upper_bound(3000); ++it) {
+    sum += *it;
+  }
+  EXPECT_EQ(sum, (1000LL + 3000) * 1001 / 2);
+}
+
+TEST(btree_set, random_operations_match_std_set) {
+  std::mt19937 random(3);
+  // String keys give eight keys per node, so the tree is several levels
+  // deep and erasure rebalances inner nodes as well as leaves.
+  open_stl::btree_set<std::string> set;
+  std::set<std::string> reference;
+  for (int round = 0; round < 200000; round++) {
+    std::string key = std::to_string(random() % 3000);
+    if (random() % 2 == 0) {
+      EXPECT_EQ(set.insert(key).second, reference.insert(key).second);
+    } else {
+      EXPECT_EQ(set.erase(key), reference.erase(key));
+    }
+  }
+  ASSERT_EQ(set.size(), reference.size());
+  auto it = set.end();
+  for (auto element = reference.rbegin(); element != reference.rend();
+       ++element) {
+    --it;
+    EXPECT_EQ(*it, *element);
+  }
+  EXPECT_TRUE(it == set.begin());
+
+  open_stl::btree_set<std::string> copy = set;
+  EXPECT_TRUE(copy == set);
+}
+
+int main(int argc, char **argv) {
+  // Initialize Google Test
+  ::testing::InitGoogleTest(&argc, argv);
+
+  // Run tests
+  return RUN_ALL_TESTS();
+}
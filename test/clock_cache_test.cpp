@@ -0,0 +1,127 @@
+#include <OpenSTL/clock_cache.h>
+#include <OpenSTL/string.h>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdint>
+#include <random>
+#include <thread>
+#include <vector>
+
+TEST(clock_cache, get_put_and_counters) {
+  open_stl::clock_cache<int, int> cache(100);
+  EXPECT_EQ(cache.capacity(), 100);
+  EXPECT_EQ(cache.shard_count(), 16);
+  EXPECT_TRUE(cache.empty());
+
+  int value = 0;
+  EXPECT_FALSE(cache.get(1, value));
+  EXPECT_TRUE(cache.put(1, 10));
+  EXPECT_FALSE(cache.put(1, 11));
+  EXPECT_TRUE(cache.get(1, value));
+  EXPECT_EQ(value, 11);
+  EXPECT_TRUE(cache.contains(1));
+  EXPECT_EQ(cache.size(), 1);
+
+  open_stl::cache_stats stats = cache.stats();
+  EXPECT_EQ(stats.hits, 1);
+  EXPECT_EQ(stats.misses, 1);
+  EXPECT_EQ(stats.evictions, 0);
+
+  EXPECT_TRUE(cache.erase(1));
+  EXPECT_FALSE(cache.erase(1));
+  EXPECT_FALSE(cache.get(1, value));
+  EXPECT_EQ(cache.stats().misses, 2);
+}
+
+TEST(clock_cache, evicts_entries_that_were_not_hit) {
+  // One shard, so the eviction order is fully determined.
+  open_stl::clock_cache<int, int> cache(4, 1);
+  for (int key = 0; key < 4; key++) {
+    cache.put(key, key * 10);
+  }
+  int value;
+  EXPECT_TRUE(cache.get(0, value));
+  EXPECT_TRUE(cache.get(2, value));
+
+  // The hand clears 0's bit, then evicts 1, the first entry not hit.
+  cache.put(4, 40);
+  EXPECT_FALSE(cache.contains(1));
+  // Next it passes 2, clearing its bit, and evicts 3.
+  cache.put(5, 50);
+  EXPECT_FALSE(cache.contains(3));
+  EXPECT_TRUE(cache.contains(0));
+  EXPECT_TRUE(cache.contains(2));
+  EXPECT_EQ(cache.size(), 4);
+  EXPECT_EQ(cache.stats().evictions, 2);
+
+  // A freed slot is reused before anything else is evicted.
+  cache.erase(0);
+  cache.put(6, 60);
+  EXPECT_TRUE(cache.contains(2));
+  EXPECT_EQ(cache.stats().evictions, 2);
+
+  cache.clear();
+  EXPECT_TRUE(cache.empty());
+  for (int key = 10; key < 14; key++) {
+    cache.put(key, key);
+  }
+  EXPECT_EQ(cache.size(), 4);
+  EXPECT_EQ(cache.stats().evictions, 2);
+}
+
+TEST(clock_cache, never_exceeds_capacity) {
+  open_stl::clock_cache<open_stl::string, int> cache(1000, 8);
+  std::mt19937 random(1);
+  int value;
+  // A skewed key distribution: the hot keys should mostly stay cached.
+  for (int round = 0; round < 100000; round++) {
+    int key = random() % 4 == 0 ? int(random() % 20000) : int(random() % 200);
+    open_stl::string name = "user:";
+    name += open_stl::string(1, char('a' + key % 26));
+    name.append(key / 26, 'x');
+    if (!cache.get(name, value)) cache.put(name, key);
+    ASSERT_LE(cache.size(), 1000);
+  }
+  open_stl::cache_stats stats = cache.stats();
+  EXPECT_EQ(stats.hits + stats.misses, 100000);
+  EXPECT_GT(stats.hits, stats.misses);
+  EXPECT_GT(stats.evictions, 0);
+  EXPECT_EQ(cache.size(), 1000);
+}
+
+TEST(clock_cache, concurrent_readers_and_writers) {
+  open_stl::clock_cache<std::uint64_t, std::uint64_t> cache(512, 8);
+  std::vector<std::thread> threads;
+  std::atomic<bool> wrong_value{false};
+  for (int t = 0; t < 4; t++) {
+    threads.emplace_back([&cache, &wrong_value, t] {
+      std::mt19937_64 random(t);
+      for (int round = 0; round < 20000; round++) {
+        std::uint64_t key = random() % 2048;
+        std::uint64_t value;
+        if (cache.get(key, value)) {
+          if (value != key * 3) wrong_value = true;
+        } else {
+          cache.put(key, key * 3);
+        }
+        if (round % 97 == 0) cache.erase(random() % 2048);
+      }
+    });
+  }
+  for (std::thread &thread : threads) {
+    thread.join();
+  }
+  EXPECT_FALSE(wrong_value);
+  EXPECT_LE(cache.size(), 512);
+  open_stl::cache_stats stats = cache.stats();
+  EXPECT_EQ(stats.hits + stats.misses, 4 * 20000);
+}
+
+int main(int argc, char **argv) {
+  // Initialize Google Test
+  ::testing::InitGoogleTest(&argc, argv);
+
+  // Run tests
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,243 @@
+#include <OpenSTL/concurrent_hash_map.h>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+// A key spanning several words, to exercise multi-word copies.
+struct point {
+  std::int32_t x;
+  std::int32_t y;
+  std::int32_t z;
+
+  bool operator==(const point &right) const {
+    return x == right.x && y == right.y && z == right.z;
+  }
+};
+
+struct point_hash {
+  std::size_t operator()(const point &p) const {
+    return std::size_t(p.x) * 73856093u ^ std::size_t(p.y) * 19349663u ^
+           std::size_t(p.z) * 83492791u;
+  }
+};
+
+// Sends every key to the same hash value.
+struct constant_hash {
+  using is_avalanching = void;
+  std::size_t operator()(int) const { return 42; }
+};
+}  // namespace
+
+TEST(concurrent_hash_map, insert_find_erase_and_compute) {
+  open_stl::concurrent_hash_map<int, long> map(0, 4);
+  EXPECT_TRUE(map.empty());
+  EXPECT_EQ(map.stripe_count(), 4);
+
+  long value = 0;
+  EXPECT_FALSE(map.find(1, value));
+  EXPECT_TRUE(map.insert(1, 10));
+  EXPECT_FALSE(map.insert(1, 11));
+  EXPECT_TRUE(map.find(1, value));
+  EXPECT_EQ(value, 10);
+  EXPECT_FALSE(map.insert_or_assign(1, 12));
+  EXPECT_TRUE(map.insert_or_assign(2, 20));
+  EXPECT_TRUE(map.find(1, value));
+  EXPECT_EQ(value, 12);
+  EXPECT_EQ(map.size(), 2);
+
+  EXPECT_TRUE(map.update(2, [](long &v) { v *= 2; }));
+  EXPECT_FALSE(map.update(3, [](long &v) { v *= 2; }));
+  EXPECT_FALSE(map.contains(3));
+  EXPECT_TRUE(map.find(2, value));
+  EXPECT_EQ(value, 40);
+
+  auto add = [](long current, long delta) { return current + delta; };
+  EXPECT_EQ(map.merge(3, 5, add), 5);
+  EXPECT_EQ(map.merge(3, 5, add), 10);
+
+  // compute() sees a default value for an absent key and can decline to
+  // insert it, or erase a present one.
+  EXPECT_FALSE(map.compute(4, [](long &v, bool present) {
+    EXPECT_FALSE(present);
+    EXPECT_EQ(v, 0);
+    return false;
+  }));
+  EXPECT_FALSE(map.contains(4));
+  EXPECT_TRUE(map.compute(4, [](long &v, bool) {
+    v = 44;
+    return true;
+  }));
+  EXPECT_FALSE(map.compute(3, [](long &v, bool present) {
+    EXPECT_TRUE(present);
+    EXPECT_EQ(v, 10);
+    return false;
+  }));
+  EXPECT_FALSE(map.contains(3));
+  EXPECT_EQ(map.size(), 3);
+
+  EXPECT_TRUE(map.erase(1));
+  EXPECT_FALSE(map.erase(1));
+  EXPECT_EQ(map.size(), 2);
+  map.clear();
+  EXPECT_TRUE(map.empty());
+  EXPECT_FALSE(map.contains(2));
+  EXPECT_TRUE(map.insert(2, 1));
+}
+
+TEST(concurrent_hash_map, grows_and_matches_reference) {
+  open_stl::concurrent_hash_map<point, std::uint64_t, point_hash> map(0, 2);
+  std::size_t initial_capacity = map.capacity();
+  std::unordered_map<std::uint64_t, std::uint64_t> reference;
+  std::mt19937_64 random(7);
+  auto key_of = [](std::uint64_t n) {
+    return point{std::int32_t(n), std::int32_t(n * 7), std::int32_t(n >> 3)};
+  };
+  for (int round = 0; round < 200000; round++) {
+    std::uint64_t n = random() % 20000;
+    std::uint64_t value = random();
+    switch (random() % 4) {
+      case 0:
+        ASSERT_EQ(map.erase(key_of(n)), reference.erase(n) == 1);
+        break;
+      case 1:
+        ASSERT_EQ(map.insert(key_of(n), value),
+                  reference.emplace(n, value).second);
+        break;
+      default:
+        ASSERT_EQ(map.insert_or_assign(key_of(n), value),
+                  reference.count(n) == 0);
+        reference[n] = value;
+        break;
+    }
+    ASSERT_EQ(map.size(), reference.size());
+  }
+  EXPECT_GT(map.capacity(), initial_capacity);
+  for (std::uint64_t n = 0; n < 20000; n++) {
+    std::uint64_t value;
+    auto it = reference.find(n);
+    ASSERT_EQ(map.find(key_of(n), value), it != reference.end());
+    if (it != reference.end()) {
+      ASSERT_EQ(value, it->second);
+    }
+  }
+}
+
+TEST(concurrent_hash_map, colliding_keys_overflow_their_buckets) {
+  open_stl::concurrent_hash_map<int, int, constant_hash> map(0, 2);
+  for (int key = 0; key < 200; key++) {
+    ASSERT_TRUE(map.insert(key, key * 2));
+  }
+  EXPECT_EQ(map.size(), 200);
+  for (int key = 0; key < 200; key += 2) {
+    ASSERT_TRUE(map.erase(key));
+  }
+  for (int key = 0; key < 200; key++) {
+    int value = -1;
+    ASSERT_EQ(map.find(key, value), key % 2 == 1);
+    if (key % 2 == 1) {
+      ASSERT_EQ(value, key * 2);
+    }
+  }
+  // Freed overflow slots are reused.
+  for (int key = 200; key < 300; key++) {
+    ASSERT_TRUE(map.insert(key, key));
+  }
+  EXPECT_EQ(map.size(), 200);
+  int value = -1;
+  EXPECT_TRUE(map.find(299, value));
+  EXPECT_EQ(value, 299);
+  map.clear();
+  EXPECT_FALSE(map.contains(1));
+}
+
+TEST(concurrent_hash_map, readers_never_miss_during_growth) {
+  // A tiny initial table, so the writers trigger many online resizes
+  // while the readers look up keys that are known to be present.
+  open_stl::concurrent_hash_map<std::uint64_t, std::uint64_t> map(0, 8);
+  const std::uint64_t per_writer = 20000;
+  std::atomic<std::uint64_t> published[2] = {0, 0};
+  std::atomic<bool> done{false};
+  std::atomic<bool> missed{false};
+  std::atomic<bool> wrong_value{false};
+
+  std::vector<std::thread> threads;
+  for (std::uint64_t w = 0; w < 2; w++) {
+    threads.emplace_back([&, w] {
+      for (std::uint64_t i = 0; i < per_writer; i++) {
+        std::uint64_t key = i * 2 + w;
+        map.insert(key, key * 3);
+        published[w].store(i + 1, std::memory_order_release);
+      }
+    });
+  }
+  for (int r = 0; r < 2; r++) {
+    threads.emplace_back([&, r] {
+      std::mt19937_64 random(r);
+      while (!done.load(std::memory_order_acquire)) {
+        std::uint64_t w = random() % 2;
+        std::uint64_t count = published[w].load(std::memory_order_acquire);
+        if (count == 0) continue;
+        std::uint64_t key = (random() % count) * 2 + w;
+        std::uint64_t value;
+        if (!map.find(key, value)) {
+          missed = true;
+        } else if (value != key * 3) {
+          wrong_value = true;
+        }
+      }
+    });
+  }
+  threads[0].join();
+  threads[1].join();
+  done = true;
+  threads[2].join();
+  threads[3].join();
+
+  EXPECT_FALSE(missed);
+  EXPECT_FALSE(wrong_value);
+  EXPECT_EQ(map.size(), 2 * per_writer);
+}
+
+TEST(concurrent_hash_map, concurrent_merges_are_atomic) {
+  open_stl::concurrent_hash_map<std::uint32_t, std::uint64_t> map(0, 16);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; t++) {
+    threads.emplace_back([&map, t] {
+      std::mt19937 random(t);
+      for (int round = 0; round < 20000; round++) {
+        std::uint32_t key = random() % 3000;
+        map.merge(key, 1, [](std::uint64_t a, std::uint64_t b) {
+          return a + b;
+        });
+        if (round % 50 == 0) {
+          map.update(key, [](std::uint64_t &v) { v += 1000000; });
+        }
+      }
+    });
+  }
+  for (std::thread &thread : threads) {
+    thread.join();
+  }
+  std::uint64_t total = 0;
+  for (std::uint32_t key = 0; key < 3000; key++) {
+    std::uint64_t value;
+    if (map.find(key, value)) total += value;
+  }
+  // Every merge added one and every update a million.
+  EXPECT_EQ(total, 4 * 20000 + std::uint64_t(4 * 400) * 1000000);
+}
+
+int main(int argc, char **argv) {
+  // Initialize Google Test
+  ::testing::InitGoogleTest(&argc, argv);
+
+  // Run tests
+  return RUN_ALL_TESTS();
+}
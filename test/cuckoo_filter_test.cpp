@@ -0,0 +1,116 @@
+#include <OpenSTL/cuckoo_filter.h>
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+TEST(cuckoo_filter, insert_contains_and_erase) {
+  open_stl::cuckoo_filter<std::uint64_t> filter(50000);
+  EXPECT_TRUE(filter.empty());
+  for (std::uint64_t key = 0; key < 50000; key++) {
+    ASSERT_TRUE(filter.insert(key));
+  }
+  EXPECT_EQ(filter.size(), 50000);
+  EXPECT_FALSE(filter.full());
+  for (std::uint64_t key = 0; key < 50000; key++) {
+    ASSERT_TRUE(filter.contains(key));
+  }
+
+  // Erase the even keys; the odd ones must survive.
+  for (std::uint64_t key = 0; key < 50000; key += 2) {
+    ASSERT_TRUE(filter.erase(key));
+  }
+  EXPECT_EQ(filter.size(), 25000);
+  std::size_t still_found = 0;
+  for (std::uint64_t key = 0; key < 50000; key++) {
+    if (key % 2 == 1) {
+      ASSERT_TRUE(filter.contains(key));
+    } else {
+      still_found += filter.contains(key);
+    }
+  }
+  // Only false positives remain among the erased keys.
+  EXPECT_LT(still_found, 25);
+
+  // A key inserted twice needs two erasures.
+  filter.clear();
+  filter.insert(7);
+  filter.insert(7);
+  EXPECT_TRUE(filter.erase(7));
+  EXPECT_TRUE(filter.contains(7));
+  EXPECT_TRUE(filter.erase(7));
+  EXPECT_FALSE(filter.contains(7));
+  EXPECT_FALSE(filter.erase(7));
+}
+
+TEST(cuckoo_filter, low_false_positive_rate) {
+  open_stl::cuckoo_filter<std::uint64_t> filter(100000);
+  for (std::uint64_t key = 0; key < 100000; key++) {
+    filter.insert(key);
+  }
+  std::size_t hits = 0;
+  for (std::uint64_t key = 100000; key < 1100000; key++) {
+    hits += filter.contains(key);
+  }
+  // At most 8 / 65536 per query, about 122 in a million.
+  EXPECT_LT(hits, 250);
+}
+
+TEST(cuckoo_filter, fills_up_and_recovers_after_erase) {
+  open_stl::cuckoo_filter<std::uint64_t> filter(1000);
+  std::uint64_t key = 0;
+  while (filter.insert(key)) {
+    key++;
+  }
+  EXPECT_TRUE(filter.full());
+  // Every key that went in, including the one that filled the filter,
+  // is still found.
+  EXPECT_EQ(filter.size(), key);
+  EXPECT_GT(double(filter.size()), 0.9 * double(filter.capacity()));
+  for (std::uint64_t k = 0; k < key; k++) {
+    ASSERT_TRUE(filter.contains(k));
+  }
+  EXPECT_FALSE(filter.insert(key));
+
+  for (std::uint64_t k = 0; k < 10; k++) {
+    ASSERT_TRUE(filter.erase(k));
+  }
+  EXPECT_FALSE(filter.full());
+  EXPECT_TRUE(filter.insert(key));
+  for (std::uint64_t k = 10; k <= key; k++) {
+    ASSERT_TRUE(filter.contains(k));
+  }
+}
+
+TEST(cuckoo_filter, batches_match_single_operations) {
+  std::vector<std::uint64_t> keys;
+  for (std::uint64_t i = 0; i < 3000; i++) {
+    keys.push_back(i * i + 17);
+  }
+  open_stl::cuckoo_filter<std::uint64_t> batched(1500);
+  open_stl::cuckoo_filter<std::uint64_t> single(1500);
+  EXPECT_EQ(batched.insert_batch(keys.data(), 1500), 1500);
+  for (std::size_t i = 0; i < 1500; i++) {
+    single.insert(keys[i]);
+  }
+  bool results[3000];
+  std::size_t found = batched.contains_batch(keys.data(), 3000, results);
+  std::size_t expected = 0;
+  for (std::size_t i = 0; i < 3000; i++) {
+    ASSERT_EQ(results[i], single.contains(keys[i]));
+    if (i < 1500) {
+      ASSERT_TRUE(results[i]);
+    }
+    expected += results[i];
+  }
+  EXPECT_EQ(found, expected);
+}
+
+int main(int argc, char **argv) {
+  // Initialize Google Test
+  ::testing::InitGoogleTest(&argc, argv);
+
+  // Run tests
+  return RUN_ALL_TESTS();
+}
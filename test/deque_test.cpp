@@ -0,0 +1,162 @@
+#include <OpenSTL/deque.h>
+#include <gtest/gtest.h>
+
+#include <deque>
+#include <random>
+#include <string>
+#include <type_traits>
+
+TEST(deque, push_and_pop_both_ends) {
+  open_stl::deque<int> values;
+  EXPECT_TRUE(values.empty());
+  values.push_back(2);
+  values.push_front(1);
+  values.emplace_back(3);
+  values.emplace_front(0);
+  EXPECT_EQ(values.size(), 4);
+  for (int i = 0; i < 4; i++) {
+    EXPECT_EQ(values[i], i);
+  }
+  EXPECT_EQ(values.front(), 0);
+  EXPECT_EQ(values.back(), 3);
+
+  values.pop_front();
+  values.pop_back();
+  EXPECT_EQ(values.size(), 2);
+  EXPECT_EQ(values.front(), 1);
+  EXPECT_EQ(values.back(), 2);
+  EXPECT_THROW(values.at(2), std::out_of_range);
+}
+
+TEST(deque, references_stay_valid_while_growing) {
+  open_stl::deque<int> values;
+  values.push_back(-1);
+  int *first = &values.front();
+  open_stl::deque<int *> addresses;
+  for (int i = 0; i < 20000; i++) {
+    values.push_back(i);
+    values.push_front(-i - 2);
+    addresses.push_back(&values.back());
+  }
+  EXPECT_EQ(first, &values[20000]);
+  EXPECT_EQ(*first, -1);
+  for (int i = 0; i < 20000; i++) {
+    ASSERT_EQ(*addresses[i], i);
+  }
+}
+
+TEST(deque, matches_std_deque) {
+  open_stl::deque<std::string> values;
+  std::deque<std::string> reference;
+  std::mt19937 rng(32);
+  for (int step = 0; step < 100000; step++) {
+    std::string value = std::to_string(step);
+    switch (rng() % 5) {
+      case 0:
+        values.push_back(value);
+        reference.push_back(value);
+        break;
+      case 1:
+        values.push_front(value);
+        reference.push_front(value);
+        break;
+      case 2:
+        if (!reference.empty()) {
+          values.pop_back();
+          reference.pop_back();
+        }
+        break;
+      case 3:
+        if (!reference.empty()) {
+          values.pop_front();
+          reference.pop_front();
+        }
+        break;
+      default:
+        if (!reference.empty()) {
+          std::size_t index = rng() % reference.size();
+          ASSERT_EQ(values[index], reference[index]);
+        }
+    }
+    ASSERT_EQ(values.size(), reference.size());
+  }
+  std::size_t index = 0;
+  for (const std::string &value : values) {
+    EXPECT_EQ(value, reference[index++]);
+  }
+}
+
+TEST(deque, fifo_queue) {
+  open_stl::deque<int> queue;
+  int next_out = 0;
+  for (int i = 0; i < 100000; i++) {
+    queue.push_back(i);
+    if (i % 3 != 0) {
+      ASSERT_EQ(queue.front(), next_out++);
+      queue.pop_front();
+    }
+  }
+  EXPECT_EQ(queue.size(), 100000 - next_out);
+  while (!queue.empty()) {
+    ASSERT_EQ(queue.front(), next_out++);
+    queue.pop_front();
+  }
+  queue.push_front(7);
+  EXPECT_EQ(queue.back(), 7);
+}
+
+TEST(deque, iterators) {
+  open_stl::deque<int> values;
+  for (int i = 0; i < 3000; i++) {
+    values.push_front(2999 - i);
+  }
+  int expected = 0;
+  for (auto it = values.begin(); it != values.end(); ++it) {
+    ASSERT_EQ(*it, expected++);
+  }
+  EXPECT_EQ(values.end() - values.begin(), 3000);
+  EXPECT_EQ(values.begin()[1500], 1500);
+  open_stl::deque<int>::const_iterator last = values.end() - 1;
+  EXPECT_EQ(*last, 2999);
+  EXPECT_EQ(*values.rbegin(), 2999);
+
+  // Iterators convert to const iterators, never the other way round.
+  using iterator = open_stl::deque<int>::iterator;
+  using const_iterator = open_stl::deque<int>::const_iterator;
+  static_assert(std::is_convertible_v<iterator, const_iterator>);
+  static_assert(!std::is_constructible_v<iterator, const_iterator>);
+}
+
+TEST(deque, copy_move_and_clear) {
+  open_stl::deque<int> values = {1, 2, 3};
+  open_stl::deque<int> copy(values);
+  EXPECT_TRUE(copy == values);
+  copy.push_front(0);
+  EXPECT_TRUE(copy != values);
+
+  open_stl::deque<int> moved(open_stl::move(copy));
+  EXPECT_EQ(moved.size(), 4);
+  EXPECT_TRUE(copy.empty());
+  copy = moved;
+  EXPECT_EQ(copy.front(), 0);
+
+  moved.clear();
+  EXPECT_TRUE(moved.empty());
+  moved.push_back(5);
+  EXPECT_EQ(moved.front(), 5);
+  moved.shrink_to_fit();
+  EXPECT_EQ(moved.back(), 5);
+
+  open_stl::deque<int> sized(5, 9);
+  EXPECT_EQ(sized.size(), 5);
+  sized.resize(2);
+  EXPECT_EQ(sized, open_stl::deque<int>({9, 9}));
+}
+
+int main(int argc, char **argv) {
+  // Initialize Google Test
+  ::testing::InitGoogleTest(&argc, argv);
+
+  // Run tests
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,243 @@
+#include <OpenSTL/dynamic_bitset.h>
+#include <OpenSTL/vector.h>
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+TEST(dynamic_bitset, set_test_and_count) {
+  open_stl::dynamic_bitset bits(200);
+  EXPECT_EQ(bits.size(), 200);
+  EXPECT_EQ(bits.word_count(), 4);
+  EXPECT_TRUE(bits.none());
+  bits.set(0).set(63).set(64).set(199);
+  EXPECT_TRUE(bits.test(63));
+  EXPECT_FALSE(bits.test(62));
+  EXPECT_THROW(bits.test(200), std::out_of_range);
+  EXPECT_EQ(bits.count(), 4);
+  bits.reset(63);
+  bits.flip(1);
+  bits[2] = true;
+  EXPECT_EQ(bits.count(), 5);
+
+  bits.flip();
+  EXPECT_EQ(bits.count(), 195);
+  bits.set();
+  EXPECT_TRUE(bits.all());
+  EXPECT_EQ(bits.count(), 200);
+  EXPECT_EQ((~bits).count(), 0);
+  bits.reset();
+  EXPECT_TRUE(bits.none());
+
+  open_stl::dynamic_bitset ones(70, true);
+  EXPECT_EQ(ones.count(), 70);
+  EXPECT_EQ(ones.data()[1], 0x3f);
+}
+
+TEST(dynamic_bitset, find_first_and_next) {
+  open_stl::dynamic_bitset bits(1000);
+  EXPECT_EQ(bits.find_first(), open_stl::dynamic_bitset::npos);
+  std::vector<std::size_t> positions = {3, 64, 65, 500, 999};
+  for (std::size_t position : positions) {
+    bits.set(position);
+  }
+  std::vector<std::size_t> found;
+  for (std::size_t i = bits.find_first(); i != open_stl::dynamic_bitset::npos;
+       i = bits.find_next(i)) {
+    found.push_back(i);
+  }
+  EXPECT_EQ(found, positions);
+  EXPECT_EQ(bits.find_next(999), open_stl::dynamic_bitset::npos);
+}
+
+TEST(dynamic_bitset, bulk_operations_match_bitwise_loop) {
+  std::mt19937 rng(38);
+  for (std::size_t size : {1u, 63u, 64u, 65u, 1000u, 4099u}) {
+    open_stl::dynamic_bitset a(size);
+    open_stl::dynamic_bitset b(size);
+    for (std::size_t i = 0; i < size; i++) {
+      a[i] = rng() % 2 == 0;
+      b[i] = rng() % 3 == 0;
+    }
+    open_stl::dynamic_bitset both = a & b;
+    open_stl::dynamic_bitset either = a | b;
+    open_stl::dynamic_bitset one = a ^ b;
+    open_stl::dynamic_bitset only_a = open_stl::andnot(a, b);
+    for (std::size_t i = 0; i < size; i++) {
+      ASSERT_EQ(both[i], a[i] && b[i]);
+      ASSERT_EQ(either[i], a[i] || b[i]);
+      ASSERT_EQ(one[i], a[i] != b[i]);
+      ASSERT_EQ(only_a[i], a[i] && !b[i]);
+    }
+    EXPECT_EQ(both.count() + one.count(), either.count());
+    a.andnot(b);
+    EXPECT_EQ(a, only_a);
+  }
+  open_stl::dynamic_bitset small(10);
+  open_stl::dynamic_bitset large(11);
+  EXPECT_THROW(small &= large, std::invalid_argument);
+}
+
+TEST(dynamic_bitset, resize_and_push_back) {
+  open_stl::dynamic_bitset bits;
+  for (int i = 0; i < 130; i++) {
+    bits.push_back(i % 2 == 0);
+  }
+  EXPECT_EQ(bits.size(), 130);
+  EXPECT_EQ(bits.count(), 65);
+  bits.resize(65);
+  EXPECT_EQ(bits.count(), 33);
+  bits.resize(200, true);
+  EXPECT_EQ(bits.count(), 33 + 135);
+  EXPECT_FALSE(bits[63]);
+  EXPECT_TRUE(bits[64]);
+  EXPECT_TRUE(bits[65]);
+  EXPECT_TRUE(bits[199]);
+  // Growing within the last word must not set the bits past size().
+  bits.resize(201, true);
+  bits.resize(203);
+  EXPECT_EQ(bits.count(), 33 + 136);
+  EXPECT_FALSE(bits[202]);
+  bits.resize(0);
+  EXPECT_TRUE(bits.empty());
+  bits.resize(128, true);
+  EXPECT_TRUE(bits.all());
+}
+
+TEST(vector_bool, packs_bits) {
+  open_stl::vector<bool> flags;
+  for (int i = 0; i < 1000; i++) {
+    flags.push_back(i % 3 == 0);
+  }
+  EXPECT_EQ(flags.size(), 1000);
+  EXPECT_EQ(flags.capacity() % 64, 0);
+  EXPECT_EQ(flags.count(), 334);
+  EXPECT_TRUE(flags[999]);
+  EXPECT_FALSE(flags.at(998));
+  EXPECT_THROW(flags.at(1000), std::out_of_range);
+
+  flags[1] = true;
+  flags[0] = flags[2];
+  EXPECT_FALSE(flags.front());
+  EXPECT_TRUE(flags[1]);
+  flags.flip();
+  EXPECT_EQ(flags.count(), 1000 - 334);
+  flags.pop_back();
+  EXPECT_EQ(flags.size(), 999);
+
+  int set = 0;
+  for (bool flag : flags) {
+    set += flag;
+  }
+  EXPECT_EQ(set, int(flags.count()));
+  for (auto flag : flags) {
+    flag = true;
+  }
+  EXPECT_EQ(flags.count(), 999);
+}
+
+TEST(vector_bool, resize_copy_and_compare) {
+  open_stl::vector<bool> flags(70, true);
+  EXPECT_EQ(flags.count(), 70);
+  flags.resize(10);
+  EXPECT_EQ(flags.count(), 10);
+  flags.resize(200);
+  EXPECT_EQ(flags.count(), 10);
+  flags.resize(300, true);
+  EXPECT_EQ(flags.count(), 110);
+
+  open_stl::vector<bool> copy = flags;
+  EXPECT_EQ(copy, flags);
+  copy[250] = false;
+  EXPECT_NE(copy, flags);
+  open_stl::vector<bool> moved = open_stl::move(copy);
+  EXPECT_TRUE(copy.empty());
+  EXPECT_EQ(moved.count(), 109);
+
+  open_stl::vector<bool> listed = {true, false, true};
+  EXPECT_EQ(listed.size(), 3);
+  EXPECT_EQ(listed.count(), 2);
+  listed.clear();
+  EXPECT_TRUE(listed.empty());
+}
+
+TEST(vector_bool, emplace_and_erase_match_std_vector) {
+  std::mt19937 random(3);
+  open_stl::vector<bool> flags;
+  std::vector<bool> reference;
+  for (int round = 0; round < 3000; round++) {
+    std::size_t size = reference.size();
+    switch (random() % 4) {
+      case 0: {
+        std::size_t position = size == 0 ? 0 : random() % (size + 1);
+        bool value = random() % 2 == 0;
+        auto it = flags.emplace(flags.cbegin() + position, value);
+        reference.insert(reference.begin() + position, value);
+        ASSERT_EQ(it - flags.begin(), std::ptrdiff_t(position));
+        break;
+      }
+      case 1:
+        flags.emplace_back(random() % 2 == 0);
+        reference.push_back(flags.back());
+        break;
+      case 2:
+        if (size != 0) {
+          std::size_t position = random() % size;
+          flags.erase(flags.cbegin() + position);
+          reference.erase(reference.begin() + position);
+        }
+        break;
+      default: {
+        std::size_t first = size == 0 ? 0 : random() % size;
+        std::size_t last = first + random() % (size - first + 1) / 4;
+        auto it = flags.erase(flags.cbegin() + first, flags.cbegin() + last);
+        reference.erase(reference.begin() + first, reference.begin() + last);
+        ASSERT_EQ(it - flags.begin(), std::ptrdiff_t(first));
+        break;
+      }
+    }
+    ASSERT_EQ(flags.size(), reference.size());
+  }
+  std::size_t set = 0;
+  for (std::size_t i = 0; i < reference.size(); i++) {
+    ASSERT_EQ(flags[i], reference[i]);
+    set += reference[i];
+  }
+  // Bits past the end stay zero.
+  EXPECT_EQ(flags.count(), set);
+}
+
+TEST(vector_bool, reverse_iteration_and_ordering) {
+  open_stl::vector<bool> flags = {true, false, false, true, true};
+  std::vector<bool> reversed;
+  for (auto it = flags.crbegin(); it != flags.crend(); ++it) {
+    reversed.push_back(*it);
+  }
+  EXPECT_EQ(reversed, (std::vector<bool>{true, true, false, false, true}));
+  *flags.rbegin() = false;
+  EXPECT_FALSE(flags.back());
+
+  open_stl::vector<bool> low(100);
+  open_stl::vector<bool> high(100);
+  high[70] = true;
+  EXPECT_LT(low, high);
+  EXPECT_LE(low, high);
+  EXPECT_GT(high, low);
+  EXPECT_GE(high, low);
+  low[30] = true;
+  EXPECT_GT(low, high);
+  open_stl::vector<bool> prefix(40);
+  prefix[30] = true;
+  EXPECT_LT(prefix, low);
+  EXPECT_LE(low, low);
+  EXPECT_GE(low, low);
+  EXPECT_FALSE(low < low);
+}
+
+int main(int argc, char **argv) {
+  // Initialize Google Test
+  ::testing::InitGoogleTest(&argc, argv);
+
+  // Run tests
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,75 @@
+#include <OpenSTL/eytzinger_index.h>
+#include <OpenSTL/vector.h>
+#include <gtest/gtest.h>
+
+TEST(eytzinger_index, empty) {
+  open_stl::eytzinger_index<int> index;
+  EXPECT_TRUE(index.empty());
+  EXPECT_EQ(index.size(), 0);
+  EXPECT_EQ(index.lower_bound(3), 0);
+  EXPECT_FALSE(index.contains(3));
+}
+
+TEST(eytzinger_index, lower_bound) {
+  open_stl::vector<int> sorted = {1, 3, 3, 5, 8, 13, 21};
+  open_stl::eytzinger_index<int> index(sorted);
+  EXPECT_EQ(index.size(), 7);
+  EXPECT_EQ(index.lower_bound(0), 0);
+  EXPECT_EQ(index.lower_bound(3), 1);
+  EXPECT_EQ(index.lower_bound(4), 3);
+  EXPECT_EQ(index.lower_bound(21), 6);
+  EXPECT_EQ(index.lower_bound(22), 7);
+}
+
+TEST(eytzinger_index, upper_bound) {
+  open_stl::vector<int> sorted = {1, 3, 3, 5, 8};
+  open_stl::eytzinger_index<int> index(sorted);
+  EXPECT_EQ(index.upper_bound(0), 0);
+  EXPECT_EQ(index.upper_bound(3), 3);
+  EXPECT_EQ(index.upper_bound(8), 5);
+}
+
+TEST(eytzinger_index, contains) {
+  open_stl::vector<int> sorted = {2, 4, 6, 8, 10};
+  open_stl::eytzinger_index<int> index(sorted);
+  for (int value = 0; value <= 12; value++) {
+    EXPECT_EQ(index.contains(value), value >= 2 && value <= 10 &&
+                                         value % 2 == 0);
+  }
+}
+
+TEST(eytzinger_index, matches_binary_search) {
+  // Sizes around powers of two exercise both full and partial last levels.
+  for (int size : {1, 2, 3, 7, 8, 9, 100, 1023, 1024, 1025}) {
+    open_stl::vector<long> sorted(size);
+    for (int i = 0; i < size; i++) {
+      sorted[i] = 3L * i;
+    }
+    open_stl::eytzinger_index<long> index(sorted);
+    for (long value = -2; value <= 3L * size + 2; value++) {
+      ASSERT_EQ(index.lower_bound(value),
+                open_stl::lower_bound(sorted.begin(), sorted.end(), value) -
+                    sorted.begin());
+      ASSERT_EQ(index.upper_bound(value),
+                open_stl::upper_bound(sorted.begin(), sorted.end(), value) -
+                    sorted.begin());
+    }
+  }
+}
+
+TEST(eytzinger_index, custom_comparator) {
+  open_stl::vector<int> sorted = {9, 7, 5, 3};
+  auto greater = [](int lhs, int rhs) { return lhs > rhs; };
+  open_stl::eytzinger_index<int, decltype(greater)> index(sorted, greater);
+  EXPECT_EQ(index.lower_bound(6), 2);
+  EXPECT_TRUE(index.contains(7));
+  EXPECT_FALSE(index.contains(6));
+}
+
+int main(int argc, char **argv) {
+  // Initialize Google Test
+  ::testing::InitGoogleTest(&argc, argv);
+
+  // Run tests
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,190 @@
+#include <OpenSTL/flat_hash_map.h>
+#include <gtest/gtest.h>
+
+#include <random>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+
+TEST(flat_hash_map, insert_and_find) {
+  open_stl::flat_hash_map<int, int> map;
+  EXPECT_TRUE(map.empty());
+  EXPECT_TRUE(map.find(1) == map.end());
+
+  EXPECT_TRUE(map.insert(open_stl::make_pair(1, 10)).second);
+  EXPECT_FALSE(map.insert(open_stl::make_pair(1, 20)).second);
+  map[2] = 20;
+  map.emplace(3, 30);
+
+  EXPECT_EQ(map.size(), 3);
+  EXPECT_EQ(map.at(1), 10);
+  EXPECT_EQ(map[2], 20);
+  EXPECT_EQ(map.find(3)->second, 30);
+  EXPECT_TRUE(map.contains(2));
+  EXPECT_EQ(map.count(4), 0);
+  EXPECT_THROW(map.at(4), std::out_of_range);
+
+  EXPECT_FALSE(map.insert_or_assign(1, 11).second);
+  EXPECT_EQ(map.at(1), 11);
+
+  const open_stl::flat_hash_map<int, int> &view = map;
+  static_assert(std::is_same_v<decltype(view.at(1)), const int &>);
+  EXPECT_EQ(view.at(3), 30);
+}
+
+TEST(flat_hash_map, iteration_visits_every_element) {
+  open_stl::flat_hash_map<int, int> map;
+  for (int i = 0; i < 1000; i++) {
+    map[i] = i * 2;
+  }
+  long long sum = 0;
+  std::size_t visited = 0;
+  for (const auto &element : map) {
+    EXPECT_EQ(element.second, element.first * 2);
+    sum += element.first;
+    visited++;
+  }
+  EXPECT_EQ(visited, 1000);
+  EXPECT_EQ(sum, 999 * 1000 / 2);
+  EXPECT_LE(map.load_factor(), 0.875f);
+}
+
+TEST(flat_hash_map, erase_churn_matches_reference) {
+  open_stl::flat_hash_map<int, int> map;
+  std::unordered_map<int, int> reference;
+  std::mt19937 rng(29);
+  // A small key space keeps probe runs long, so erases shift many elements.
+  std::uniform_int_distribution<int> key(0, 2000);
+  for (int step = 0; step < 200000; step++) {
+    int k = key(rng);
+    switch (rng() % 3) {
+      case 0:
+        map[k] = step;
+        reference[k] = step;
+        break;
+      case 1:
+        EXPECT_EQ(map.erase(k), reference.erase(k));
+        break;
+      default:
+        auto it = reference.find(k);
+        auto found = map.find(k);
+        ASSERT_EQ(found == map.end(), it == reference.end());
+        if (it != reference.end()) {
+          EXPECT_EQ(found->second, it->second);
+        }
+    }
+  }
+  ASSERT_EQ(map.size(), reference.size());
+  for (const auto &element : reference) {
+    ASSERT_TRUE(map.contains(element.first));
+    EXPECT_EQ(map.at(element.first), element.second);
+  }
+}
+
+TEST(flat_hash_map, erase_by_iterator_and_erase_if) {
+  open_stl::flat_hash_map<int, int> map;
+  for (int i = 0; i < 500; i++) {
+    map[i] = i;
+  }
+  map.erase(map.find(7));
+  EXPECT_FALSE(map.contains(7));
+
+  std::size_t removed = erase_if(
+      map, [](const open_stl::pair<int, int> &e) { return e.first % 2 == 0; });
+  EXPECT_EQ(removed, 250);
+  EXPECT_EQ(map.size(), 249);
+  for (int i = 0; i < 500; i++) {
+    EXPECT_EQ(map.contains(i), i % 2 == 1 && i != 7);
+  }
+}
+
+TEST(flat_hash_map, identity_hash_keys_spread) {
+  struct identity {
+    std::size_t operator()(int value) const { return value; }
+  };
+  open_stl::flat_hash_map<int, int, identity> map;
+  for (int i = 0; i < 4096; i++) {
+    map[i << 16] = i;
+  }
+  for (int i = 0; i < 4096; i++) {
+    ASSERT_EQ(map.at(i << 16), i);
+  }
+}
+
+TEST(flat_hash_map, reserve_avoids_rehash) {
+  open_stl::flat_hash_map<int, int> map;
+  map.reserve(1000);
+  std::size_t capacity = map.capacity();
+  EXPECT_GE(capacity, 1000);
+  for (int i = 0; i < 1000; i++) {
+    map[i] = i;
+  }
+  EXPECT_EQ(map.capacity(), capacity);
+
+  // A full table only grows for a new key, not for one it already holds.
+  for (int i = 1000; map.size() < capacity - capacity / 8; i++) {
+    map[i] = i;
+  }
+  map[0] = -1;
+  EXPECT_FALSE(map.insert(open_stl::make_pair(1, -1)).second);
+  EXPECT_EQ(map.capacity(), capacity);
+  map[-1] = -1;
+  EXPECT_GT(map.capacity(), capacity);
+  capacity = map.capacity();
+
+  map.clear();
+  EXPECT_TRUE(map.empty());
+  EXPECT_EQ(map.capacity(), capacity);
+  EXPECT_FALSE(map.contains(5));
+}
+
+struct string_hash {
+  using is_transparent = void;
+  std::size_t operator()(std::string_view value) const {
+    return std::hash<std::string_view>()(value);
+  }
+};
+
+TEST(flat_hash_map, heterogeneous_lookup) {
+  open_stl::flat_hash_map<std::string, int, string_hash,
+                          open_stl::equal_to<>>
+      map;
+  map[std::string("alpha")] = 1;
+  map[std::string("beta")] = 2;
+
+  std::string_view key = "alpha";
+  EXPECT_TRUE(map.contains(key));
+  EXPECT_EQ(map.at(key), 1);
+  EXPECT_EQ(map.find("beta")->second, 2);
+  EXPECT_EQ(map.count("gamma"), 0);
+  EXPECT_EQ(map.erase(key), 1);
+  EXPECT_FALSE(map.contains("alpha"));
+}
+
+TEST(flat_hash_map, copy_move_and_compare) {
+  open_stl::flat_hash_map<std::string, int> map = {{"a", 1}, {"b", 2}};
+  open_stl::flat_hash_map<std::string, int> copy = map;
+  EXPECT_TRUE(copy == map);
+  copy["c"] = 3;
+  EXPECT_TRUE(copy != map);
+  EXPECT_EQ(map.size(), 2);
+
+  open_stl::flat_hash_map<std::string, int> moved = std::move(copy);
+  EXPECT_EQ(moved.size(), 3);
+  EXPECT_TRUE(copy.empty());
+  copy = moved;
+  EXPECT_EQ(copy.at("c"), 3);
+
+  moved.swap(map);
+  EXPECT_EQ(map.size(), 3);
+  EXPECT_EQ(moved.size(), 2);
+}
+
+int main(int argc, char **argv) {
+  // Initialize Google Test
+  ::testing::InitGoogleTest(&argc, argv);
+
+  // Run tests
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,96 @@
+#include <OpenSTL/flat_hash_set.h>
+#include <gtest/gtest.h>
+
+#include <random>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+
+TEST(flat_hash_set, insert_contains_erase) {
+  open_stl::flat_hash_set<int> set = {3, 1, 4, 1, 5};
+  EXPECT_EQ(set.size(), 4);
+  EXPECT_TRUE(set.contains(4));
+  EXPECT_FALSE(set.contains(2));
+  EXPECT_FALSE(set.insert(3).second);
+  EXPECT_TRUE(set.emplace(9).second);
+  EXPECT_EQ(*set.find(9), 9);
+
+  EXPECT_EQ(set.erase(1), 1);
+  EXPECT_EQ(set.erase(1), 0);
+  set.erase(set.find(4));
+  EXPECT_EQ(set.size(), 3);
+
+  int sum = 0;
+  for (int key : set) {
+    sum += key;
+  }
+  EXPECT_EQ(sum, 3 + 5 + 9);
+}
+
+TEST(flat_hash_set, churn_matches_reference) {
+  open_stl::flat_hash_set<unsigned> set;
+  std::unordered_set<unsigned> reference;
+  std::mt19937 rng(7);
+  for (int step = 0; step < 100000; step++) {
+    unsigned key = rng() % 1500;
+    if (rng() % 2 == 0) {
+      EXPECT_EQ(set.insert(key).second, reference.insert(key).second);
+    } else {
+      EXPECT_EQ(set.erase(key), reference.erase(key));
+    }
+  }
+  ASSERT_EQ(set.size(), reference.size());
+  for (unsigned key = 0; key < 1500; key++) {
+    EXPECT_EQ(set.contains(key), reference.count(key) == 1);
+  }
+}
+
+TEST(flat_hash_set, erase_if_and_reserve) {
+  open_stl::flat_hash_set<int> set;
+  set.reserve(300);
+  std::size_t capacity = set.capacity();
+  for (int i = 0; i < 300; i++) {
+    set.insert(i);
+  }
+  EXPECT_EQ(set.capacity(), capacity);
+  EXPECT_EQ(erase_if(set, [](int key) { return key >= 100; }), 200);
+  EXPECT_EQ(set.size(), 100);
+  for (int i = 0; i < 300; i++) {
+    EXPECT_EQ(set.contains(i), i < 100);
+  }
+}
+
+struct string_hash {
+  using is_transparent = void;
+  std::size_t operator()(std::string_view value) const {
+    return std::hash<std::string_view>()(value);
+  }
+};
+
+TEST(flat_hash_set, heterogeneous_lookup) {
+  open_stl::flat_hash_set<std::string, string_hash, open_stl::equal_to<>> set;
+  set.insert(std::string("red"));
+  set.insert(std::string("green"));
+  EXPECT_TRUE(set.contains(std::string_view("red")));
+  EXPECT_EQ(set.count("blue"), 0);
+  EXPECT_EQ(set.erase("green"), 1);
+  EXPECT_EQ(set.size(), 1);
+}
+
+TEST(flat_hash_set, copy_and_compare) {
+  open_stl::flat_hash_set<int> set = {1, 2, 3};
+  open_stl::flat_hash_set<int> copy(set);
+  EXPECT_TRUE(copy == set);
+  copy.erase(2);
+  EXPECT_TRUE(copy != set);
+  copy.insert(2);
+  EXPECT_TRUE(copy == set);
+}
+
+int main(int argc, char **argv) {
+  // Initialize Google Test
+  ::testing::InitGoogleTest(&argc, argv);
+
+  // Run tests
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,169 @@
+#include <OpenSTL/flat_map.h>
+#include <gtest/gtest.h>
+
+#include <map>
+#include <random>
+#include <string>
+#include <string_view>
+
+TEST(flat_map, insert_and_lookup) {
+  open_stl::flat_map<int, std::string> map;
+  EXPECT_TRUE(map.empty());
+  EXPECT_TRUE(map.insert(open_stl::pair<int, std::string>(3, "c")).second);
+  EXPECT_TRUE(map.emplace(1, "a").second);
+  EXPECT_FALSE(map.emplace(1, "z").second);
+  map[2] = "b";
+
+  EXPECT_EQ(map.size(), 3);
+  EXPECT_EQ(map.keys(), open_stl::vector<int>({1, 2, 3}));
+  EXPECT_EQ(map.at(1), "a");
+  EXPECT_EQ(map.find(2)->second, "b");
+  EXPECT_TRUE(map.find(4) == map.end());
+  EXPECT_TRUE(map.contains(3));
+  EXPECT_EQ(map.count(0), 0);
+  EXPECT_THROW(map.at(4), std::out_of_range);
+
+  EXPECT_FALSE(map.insert_or_assign(3, "C").second);
+  EXPECT_EQ(map.at(3), "C");
+  EXPECT_EQ(map.lower_bound(2).key(), 2);
+  EXPECT_EQ(map.upper_bound(2).key(), 3);
+}
+
+TEST(flat_map, iteration_is_sorted) {
+  open_stl::flat_map<int, int> map = {{5, 50}, {1, 10}, {3, 30}};
+  int expected = 1;
+  for (auto element : map) {
+    EXPECT_EQ(element.first, expected);
+    EXPECT_EQ(element.second, expected * 10);
+    expected += 2;
+  }
+  for (auto it = map.begin(); it != map.end(); ++it) {
+    it->second += 1;
+  }
+  EXPECT_EQ(map.values(), open_stl::vector<int>({11, 31, 51}));
+  EXPECT_EQ(map.end() - map.begin(), 3);
+  EXPECT_EQ((map.begin() + 2)->first, 5);
+}
+
+TEST(flat_map, bulk_construction_sorts_and_keeps_first) {
+  open_stl::vector<int> keys = {4, 2, 4, 1, 2};
+  open_stl::vector<int> values = {40, 20, 41, 10, 21};
+  open_stl::flat_map<int, int> map(keys, values);
+  EXPECT_EQ(map.keys(), open_stl::vector<int>({1, 2, 4}));
+  EXPECT_EQ(map.values(), open_stl::vector<int>({10, 20, 40}));
+
+  open_stl::flat_map<int, int> sorted(open_stl::sorted_unique,
+                                      open_stl::vector<int>({1, 2}),
+                                      open_stl::vector<int>({5, 6}));
+  EXPECT_EQ(sorted.at(2), 6);
+
+  using int_map = open_stl::flat_map<int, int>;
+  open_stl::vector<int> one_key = {1};
+  EXPECT_THROW(int_map(one_key, open_stl::vector<int>()),
+               std::invalid_argument);
+}
+
+TEST(flat_map, insert_range_merges) {
+  open_stl::flat_map<int, int> map = {{2, 2}, {4, 4}, {6, 6}};
+  open_stl::vector<open_stl::pair<int, int>> batch = {
+      {7, 70}, {1, 10}, {4, 40}, {5, 50}, {1, 11}};
+  map.insert_range(batch.begin(), batch.end());
+  EXPECT_EQ(map.keys(), open_stl::vector<int>({1, 2, 4, 5, 6, 7}));
+  // Keys already present keep their value; the first duplicate wins.
+  EXPECT_EQ(map.values(), open_stl::vector<int>({10, 2, 4, 50, 6, 70}));
+
+  open_stl::vector<open_stl::pair<int, int>> sorted = {{0, 0}, {3, 3}};
+  map.insert_range(open_stl::sorted_unique, sorted.begin(), sorted.end());
+  EXPECT_EQ(map.keys(), open_stl::vector<int>({0, 1, 2, 3, 4, 5, 6, 7}));
+}
+
+// The duplicate key 1 sorts before every existing key, so the merge is
+// done before it reaches the front: the remaining values must not be moved
+// onto themselves.
+TEST(flat_map, insert_range_keeps_values_before_trailing_duplicates) {
+  using vector_map = open_stl::flat_map<int, open_stl::vector<int>>;
+  vector_map map;
+  map.insert({1, open_stl::vector<int>({1, 2})});
+  map.insert({5, open_stl::vector<int>({3, 4})});
+  open_stl::vector<open_stl::pair<int, open_stl::vector<int>>> batch;
+  batch.push_back({1, open_stl::vector<int>({7})});
+  batch.push_back({9, open_stl::vector<int>({8})});
+  map.insert_range(batch.begin(), batch.end());
+  EXPECT_EQ(map.keys(), open_stl::vector<int>({1, 5, 9}));
+  EXPECT_EQ(map.at(1), open_stl::vector<int>({1, 2}));
+  EXPECT_EQ(map.at(5), open_stl::vector<int>({3, 4}));
+  EXPECT_EQ(map.at(9), open_stl::vector<int>({8}));
+}
+
+TEST(flat_map, matches_std_map) {
+  open_stl::flat_map<int, int> map;
+  std::map<int, int> reference;
+  std::mt19937 rng(30);
+  for (int step = 0; step < 20000; step++) {
+    int key = static_cast<int>(rng() % 500);
+    switch (rng() % 4) {
+      case 0:
+        map[key] = step;
+        reference[key] = step;
+        break;
+      case 1:
+        EXPECT_EQ(map.erase(key), reference.erase(key));
+        break;
+      case 2: {
+        open_stl::vector<open_stl::pair<int, int>> batch;
+        for (int i = 0; i < 8; i++) {
+          int k = static_cast<int>(rng() % 500);
+          batch.push_back(open_stl::pair<int, int>(k, step));
+          reference.insert(std::make_pair(k, step));
+        }
+        map.insert_range(batch.begin(), batch.end());
+        break;
+      }
+      default:
+        EXPECT_EQ(map.contains(key), reference.count(key) == 1);
+    }
+  }
+  ASSERT_EQ(map.size(), reference.size());
+  auto it = map.begin();
+  for (const auto &element : reference) {
+    EXPECT_EQ(it->first, element.first);
+    EXPECT_EQ(it->second, element.second);
+    ++it;
+  }
+}
+
+TEST(flat_map, erase_by_iterator) {
+  open_stl::flat_map<int, int> map = {{1, 1}, {2, 2}, {3, 3}};
+  auto next = map.erase(map.find(2));
+  EXPECT_EQ(next->first, 3);
+  EXPECT_EQ(map.keys(), open_stl::vector<int>({1, 3}));
+}
+
+TEST(flat_map, heterogeneous_lookup) {
+  open_stl::flat_map<std::string, int, open_stl::less<>> map = {
+      {"pear", 1}, {"apple", 2}};
+  std::string_view key = "apple";
+  EXPECT_TRUE(map.contains(key));
+  EXPECT_EQ(map.find(key)->second, 2);
+  EXPECT_FALSE(map.contains(std::string_view("plum")));
+}
+
+TEST(flat_map, copy_and_compare) {
+  open_stl::flat_map<int, int> map = {{1, 1}, {2, 2}};
+  open_stl::flat_map<int, int> copy = {{7, 7}};
+  copy = map;
+  EXPECT_TRUE(copy == map);
+  copy[3] = 3;
+  EXPECT_TRUE(copy != map);
+  copy.swap(map);
+  EXPECT_EQ(map.size(), 3);
+  EXPECT_EQ(copy.size(), 2);
+}
+
+int main(int argc, char **argv) {
+  // Initialize Google Test
+  ::testing::InitGoogleTest(&argc, argv);
+
+  // Run tests
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,80 @@
+#include <OpenSTL/flat_set.h>
+#include <gtest/gtest.h>
+
+#include <random>
+#include <set>
+#include <string>
+#include <string_view>
+
+TEST(flat_set, insert_and_lookup) {
+  open_stl::flat_set<int> set = {5, 1, 3, 1};
+  EXPECT_EQ(set.keys(), open_stl::vector<int>({1, 3, 5}));
+  EXPECT_FALSE(set.insert(3).second);
+  EXPECT_EQ(*set.insert(4).first, 4);
+  EXPECT_TRUE(set.contains(4));
+  EXPECT_EQ(set.count(2), 0);
+  EXPECT_EQ(*set.lower_bound(2), 3);
+  EXPECT_EQ(*set.upper_bound(3), 4);
+  EXPECT_EQ(set.find(9), set.end());
+
+  EXPECT_EQ(set.erase(1), 1);
+  EXPECT_EQ(*set.erase(set.find(3)), 4);
+  EXPECT_EQ(set.keys(), open_stl::vector<int>({4, 5}));
+}
+
+TEST(flat_set, bulk_construction_and_insert_range) {
+  open_stl::flat_set<int> set(open_stl::vector<int>({9, 2, 9, 4, 2}));
+  EXPECT_EQ(set.keys(), open_stl::vector<int>({2, 4, 9}));
+
+  int batch[] = {8, 1, 4, 8, 10};
+  set.insert_range(batch, batch + 5);
+  EXPECT_EQ(set.keys(), open_stl::vector<int>({1, 2, 4, 8, 9, 10}));
+
+  int sorted[] = {0, 3, 11};
+  set.insert_range(open_stl::sorted_unique, sorted, sorted + 3);
+  EXPECT_EQ(set.size(), 9);
+  EXPECT_EQ(*set.begin(), 0);
+}
+
+TEST(flat_set, insert_range_keeps_elements_before_trailing_duplicates) {
+  open_stl::flat_set<open_stl::vector<int>> set;
+  set.insert(open_stl::vector<int>({1}));
+  set.insert(open_stl::vector<int>({5, 5}));
+  open_stl::vector<int> batch[] = {open_stl::vector<int>({1}),
+                                   open_stl::vector<int>({9})};
+  set.insert_range(batch, batch + 2);
+  ASSERT_EQ(set.size(), 3);
+  EXPECT_EQ(set.keys()[0], open_stl::vector<int>({1}));
+  EXPECT_EQ(set.keys()[1], open_stl::vector<int>({5, 5}));
+  EXPECT_EQ(set.keys()[2], open_stl::vector<int>({9}));
+}
+
+TEST(flat_set, matches_std_set) {
+  open_stl::flat_set<unsigned> set;
+  std::set<unsigned> reference;
+  std::mt19937 rng(11);
+  for (int step = 0; step < 20000; step++) {
+    unsigned key = rng() % 700;
+    if (rng() % 3 == 0) {
+      EXPECT_EQ(set.erase(key), reference.erase(key));
+    } else {
+      EXPECT_EQ(set.insert(key).second, reference.insert(key).second);
+    }
+  }
+  ASSERT_EQ(set.size(), reference.size());
+  EXPECT_TRUE(std::equal(set.begin(), set.end(), reference.begin()));
+}
+
+TEST(flat_set, heterogeneous_lookup) {
+  open_stl::flat_set<std::string, open_stl::less<>> set = {"b", "a"};
+  EXPECT_TRUE(set.contains(std::string_view("a")));
+  EXPECT_EQ(*set.find(std::string_view("b")), "b");
+}
+
+int main(int argc, char **argv) {
+  // Initialize Google Test
+  ::testing::InitGoogleTest(&argc, argv);
+
+  // Run tests
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,128 @@
+#include <OpenSTL/array.h>
+#include <OpenSTL/hash.h>
+#include <OpenSTL/vector.h>
+#include <gtest/gtest.h>
+
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <set>
+#include <string>
+
+TEST(hash, integers_are_distinct_and_mixed) {
+  open_stl::hash<std::uint64_t> hasher;
+  std::set<std::size_t> seen;
+  for (std::uint64_t i = 0; i < 10000; i++) {
+    seen.insert(hasher(i));
+  }
+  EXPECT_EQ(seen.size(), 10000);
+
+  // Flipping one input bit should flip about half of the output bits.
+  long long flipped = 0;
+  int samples = 0;
+  for (std::uint64_t value = 1; value < 1000; value++) {
+    for (int bit = 0; bit < 64; bit++) {
+      flipped += std::popcount(static_cast<std::uint64_t>(
+          hasher(value) ^ hasher(value ^ (std::uint64_t(1) << bit))));
+      samples++;
+    }
+  }
+  double average = double(flipped) / samples;
+  EXPECT_GT(average, 28.0);
+  EXPECT_LT(average, 36.0);
+}
+
+TEST(hash, integer_types_agree_on_value) {
+  EXPECT_EQ(open_stl::hash<int>()(42), open_stl::hash<long long>()(42));
+  EXPECT_EQ(open_stl::hash<unsigned char>()(7), open_stl::hash<short>()(7));
+  EXPECT_NE(open_stl::hash<int>()(1), open_stl::hash<int>()(2));
+}
+
+TEST(hash, floating_point) {
+  open_stl::hash<double> hasher;
+  EXPECT_EQ(hasher(0.0), hasher(-0.0));
+  EXPECT_NE(hasher(1.0), hasher(-1.0));
+  EXPECT_NE(hasher(0.1), hasher(0.2));
+  EXPECT_EQ(open_stl::hash<float>()(0.0f), open_stl::hash<float>()(-0.0f));
+  EXPECT_EQ(open_stl::hash<long double>()(2.5L), hasher(2.5));
+}
+
+TEST(hash, pointers) {
+  int values[2];
+  open_stl::hash<int *> hasher;
+  EXPECT_EQ(hasher(&values[0]), hasher(&values[0]));
+  EXPECT_NE(hasher(&values[0]), hasher(&values[1]));
+  EXPECT_NE(hasher(nullptr), hasher(&values[0]));
+}
+
+TEST(hash, byte_containers_hash_their_bytes) {
+  open_stl::vector<char> text = {'h', 'a', 's', 'h'};
+  open_stl::array<char, 4> fixed = {'h', 'a', 's', 'h'};
+  std::size_t expected = open_stl::hash_bytes("hash", 4);
+  EXPECT_EQ(open_stl::hash<open_stl::vector<char>>()(text), expected);
+  EXPECT_EQ((open_stl::hash<open_stl::array<char, 4>>()(fixed)), expected);
+
+  open_stl::vector<char> empty;
+  EXPECT_EQ(open_stl::hash<open_stl::vector<char>>()(empty),
+            open_stl::hash_bytes(nullptr, 0));
+}
+
+TEST(hash, bytes_every_length_is_distinct) {
+  // Covers every branch of the length dispatch: empty, 1 to 3, 4 to 16,
+  // 17 to 47 and the 48-byte loop, each with a single byte changed.
+  std::string data(200, 'x');
+  std::set<std::uint64_t> seen;
+  for (std::size_t length = 0; length <= data.size(); length++) {
+    seen.insert(open_stl::hash_bytes(data.data(), length));
+    if (length > 0) {
+      std::string changed = data.substr(0, length);
+      changed[length / 2] = 'y';
+      EXPECT_NE(open_stl::hash_bytes(changed.data(), length),
+                open_stl::hash_bytes(data.data(), length));
+    }
+  }
+  EXPECT_EQ(seen.size(), data.size() + 1);
+}
+
+TEST(hash, bytes_do_not_depend_on_alignment) {
+  alignas(16) char buffer[80];
+  for (int i = 0; i < 80; i++) {
+    buffer[i] = static_cast<char>(i * 37);
+  }
+  alignas(16) char shifted[81];
+  std::memcpy(shifted + 1, buffer, 80);
+  for (std::size_t length : {3, 9, 33, 64}) {
+    EXPECT_EQ(open_stl::hash_bytes(buffer, length),
+              open_stl::hash_bytes(shifted + 1, length));
+  }
+}
+
+TEST(hash, seeds_select_different_functions) {
+  open_stl::seeded_hash<int> first(1);
+  open_stl::seeded_hash<int> second(2);
+  open_stl::seeded_hash<int> again(1);
+  EXPECT_EQ(first(5), again(5));
+  EXPECT_NE(first(5), second(5));
+  EXPECT_EQ(first.seed(), 1);
+
+  EXPECT_NE(open_stl::hash_bytes("abc", 3, 1),
+            open_stl::hash_bytes("abc", 3, 2));
+
+  open_stl::seeded_hash<int> process;
+  EXPECT_EQ(process.seed(), open_stl::process_hash_seed());
+  EXPECT_EQ(open_stl::seeded_hash<int>()(9), process(9));
+}
+
+TEST(hash, falls_back_to_std_hash) {
+  open_stl::hash<std::string> hasher;
+  EXPECT_EQ(hasher("key"), hasher(std::string("key")));
+  EXPECT_NE(hasher("key"), hasher("kez"));
+}
+
+int main(int argc, char **argv) {
+  // Initialize Google Test
+  ::testing::InitGoogleTest(&argc, argv);
+
+  // Run tests
+  return RUN_ALL_TESTS();
+}
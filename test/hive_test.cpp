@@ -0,0 +1,172 @@
+#include <OpenSTL/hive.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+TEST(hive, insert_and_iterate) {
+  open_stl::hive<int> values;
+  EXPECT_TRUE(values.empty());
+  EXPECT_TRUE(values.begin() == values.end());
+  for (int i = 0; i < 100; i++) {
+    values.insert(i);
+  }
+  EXPECT_EQ(values.size(), 100);
+  EXPECT_GE(values.capacity(), 100);
+  int expected = 0;
+  for (int value : values) {
+    EXPECT_EQ(value, expected++);
+  }
+
+  // Reverse iteration crosses group boundaries too.
+  auto it = values.end();
+  for (int i = 99; i >= 0; i--) {
+    --it;
+    EXPECT_EQ(*it, i);
+  }
+  EXPECT_TRUE(it == values.begin());
+}
+
+TEST(hive, erase_keeps_pointers_stable) {
+  open_stl::hive<std::string> names;
+  std::vector<std::string *> pointers;
+  for (int i = 0; i < 50; i++) {
+    pointers.push_back(&*names.insert(std::to_string(i)));
+  }
+  // Erase the odd elements; the even ones must not move.
+  for (auto it = names.begin(); it != names.end();) {
+    if (std::stoi(*it) % 2 == 1) {
+      it = names.erase(it);
+    } else {
+      ++it;
+    }
+  }
+  EXPECT_EQ(names.size(), 25);
+  for (int i = 0; i < 50; i += 2) {
+    EXPECT_EQ(*pointers[i], std::to_string(i));
+  }
+
+  // New elements fill the freed slots instead of growing the hive.
+  std::size_t capacity = names.capacity();
+  for (int i = 0; i < 25; i++) {
+    names.insert("new");
+  }
+  EXPECT_EQ(names.capacity(), capacity);
+  EXPECT_EQ(std::count(names.begin(), names.end(), "new"), 25);
+  for (int i = 0; i < 50; i += 2) {
+    EXPECT_EQ(*pointers[i], std::to_string(i));
+  }
+}
+
+TEST(hive, get_iterator_and_empty_groups) {
+  open_stl::hive<int> values{1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+  int *five = nullptr;
+  for (int &value : values) {
+    if (value == 5) five = &value;
+  }
+  auto it = values.get_iterator(five);
+  ASSERT_TRUE(it != values.end());
+  it = values.erase(it);
+  EXPECT_EQ(*it, 6);
+  EXPECT_TRUE(values.get_iterator(five) == values.end());
+
+  // Erasing the whole first group releases it.
+  std::size_t capacity = values.capacity();
+  it = values.begin();
+  for (int i = 0; i < 7; i++) {
+    it = values.erase(it);
+  }
+  EXPECT_EQ(*values.begin(), 9);
+  EXPECT_LT(values.capacity(), capacity);
+  values.erase(values.begin());
+  values.erase(values.begin());
+  EXPECT_TRUE(values.empty());
+  EXPECT_TRUE(values.begin() == values.end());
+  values.insert(42);
+  EXPECT_EQ(*values.begin(), 42);
+}
+
+// Erasing slot 2 last joins two skipblocks around it, which leaves slot 2
+// in the middle of the merged block.
+TEST(hive, get_iterator_inside_merged_skipblock) {
+  open_stl::hive<int> values{0, 1, 2, 3, 4, 5};
+  int *slots[6];
+  for (int &value : values) {
+    slots[value] = &value;
+  }
+  for (int erased : {3, 1, 2}) {
+    values.erase(values.get_iterator(slots[erased]));
+  }
+  for (int i = 0; i < 6; i++) {
+    bool live = i == 0 || i >= 4;
+    EXPECT_EQ(values.get_iterator(slots[i]) != values.end(), live);
+  }
+  int sum = 0;
+  for (int value : values) {
+    sum += value;
+  }
+  EXPECT_EQ(sum, 0 + 4 + 5);
+}
+
+TEST(hive, random_churn_matches_reference) {
+  std::mt19937 random(7);
+  open_stl::hive<int> values;
+  std::vector<int> reference;
+  int next = 0;
+  for (int round = 0; round < 20000; round++) {
+    if (reference.empty() || random() % 3 != 0) {
+      values.insert(next);
+      reference.push_back(next++);
+    } else {
+      // Erase the element at a random position of the iteration order.
+      std::size_t skip = random() % values.size();
+      auto it = values.begin();
+      for (std::size_t i = 0; i < skip % 64; i++) {
+        ++it;
+      }
+      int value = *it;
+      values.erase(it);
+      reference.erase(std::find(reference.begin(), reference.end(), value));
+    }
+  }
+  ASSERT_EQ(values.size(), reference.size());
+  std::vector<int> forward;
+  for (int value : values) {
+    forward.push_back(value);
+  }
+  std::vector<int> backward;
+  for (auto it = values.end(); it != values.begin();) {
+    backward.push_back(*--it);
+  }
+  std::reverse(backward.begin(), backward.end());
+  EXPECT_EQ(forward, backward);
+  std::sort(forward.begin(), forward.end());
+  std::sort(reference.begin(), reference.end());
+  EXPECT_EQ(forward, reference);
+}
+
+TEST(hive, copy_move_and_clear) {
+  open_stl::hive<int> values{1, 2, 3};
+  values.erase(values.begin());
+  open_stl::hive<int> copy = values;
+  EXPECT_EQ(copy.size(), 2);
+  EXPECT_EQ(*copy.begin(), 2);
+
+  open_stl::hive<int> moved = open_stl::move(copy);
+  EXPECT_EQ(moved.size(), 2);
+  EXPECT_TRUE(copy.empty());
+
+  moved.clear();
+  EXPECT_TRUE(moved.empty());
+  EXPECT_EQ(moved.capacity(), 0);
+}
+
+int main(int argc, char **argv) {
+  // Initialize Google Test
+  ::testing::InitGoogleTest(&argc, argv);
+
+  // Run tests
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,143 @@
+#include <OpenSTL/inplace_vector.h>
+#include <gtest/gtest.h>
+
+#include <new>
+#include <stdexcept>
+#include <string>
+
+namespace {
+// A type with no default constructor that counts its live instances.
+struct tracked {
+  static int live;
+  int value;
+
+  explicit tracked(int v) : value(v) { live++; }
+  tracked(const tracked &right) : value(right.value) { live++; }
+  tracked(tracked &&right) : value(right.value) {
+    right.value = -1;
+    live++;
+  }
+  tracked &operator=(const tracked &) = default;
+  tracked &operator=(tracked &&right) {
+    value = right.value;
+    right.value = -1;
+    return *this;
+  }
+  ~tracked() { live--; }
+
+  bool operator==(const tracked &right) const { return value == right.value; }
+};
+
+int tracked::live = 0;
+}  // namespace
+
+TEST(inplace_vector, push_pop_and_overflow) {
+  open_stl::inplace_vector<int, 4> v;
+  EXPECT_TRUE(v.empty());
+  EXPECT_EQ(v.capacity(), 4);
+  EXPECT_EQ(sizeof(v), 4 * sizeof(int) + sizeof(std::size_t));
+
+  v.push_back(1);
+  EXPECT_EQ(v.emplace_back(2), 2);
+  ASSERT_NE(v.try_push_back(3), nullptr);
+  EXPECT_EQ(*v.try_emplace_back(4), 4);
+  EXPECT_TRUE(v.full());
+
+  // A full vector rejects growth and is left unchanged.
+  EXPECT_EQ(v.try_push_back(5), nullptr);
+  EXPECT_THROW(v.push_back(5), std::bad_alloc);
+  EXPECT_THROW(v.insert(v.begin(), 5), std::bad_alloc);
+  EXPECT_THROW(v.resize(5), std::bad_alloc);
+  EXPECT_THROW((open_stl::inplace_vector<int, 2>{1, 2, 3}), std::bad_alloc);
+  EXPECT_EQ(v, (open_stl::inplace_vector<int, 4>{1, 2, 3, 4}));
+
+  EXPECT_EQ(v.front(), 1);
+  EXPECT_EQ(v.back(), 4);
+  EXPECT_EQ(v.at(2), 3);
+  EXPECT_THROW(v.at(4), std::out_of_range);
+
+  int sum = 0;
+  for (int x : v) {
+    sum += x;
+  }
+  EXPECT_EQ(sum, 10);
+  EXPECT_EQ(*v.rbegin(), 4);
+
+  v.pop_back();
+  EXPECT_EQ(v.size(), 3);
+  v.resize(4, 9);
+  EXPECT_EQ(v.back(), 9);
+  v.resize(1);
+  EXPECT_EQ(v, (open_stl::inplace_vector<int, 4>{1}));
+  v.clear();
+  EXPECT_TRUE(v.empty());
+}
+
+TEST(inplace_vector, insert_and_erase_keep_order) {
+  open_stl::inplace_vector<std::string, 8> v{"a", "d"};
+  EXPECT_EQ(*v.insert(v.begin() + 1, "c"), "c");
+  EXPECT_EQ(*v.emplace(v.begin() + 1, 1, 'b'), "b");
+  v.insert(v.end(), "e");
+  EXPECT_EQ(v, (open_stl::inplace_vector<std::string, 8>{"a", "b", "c", "d",
+                                                           "e"}));
+
+  auto it = v.insert(v.begin() + 2, 2, "x");
+  EXPECT_EQ(it, v.begin() + 2);
+  EXPECT_EQ(v, (open_stl::inplace_vector<std::string, 8>{"a", "b", "x", "x",
+                                                           "c", "d", "e"}));
+  EXPECT_THROW(v.insert(v.begin(), 2, "y"), std::bad_alloc);
+  EXPECT_EQ(v.size(), 7);
+
+  it = v.erase(v.begin() + 2, v.begin() + 4);
+  EXPECT_EQ(*it, "c");
+  it = v.erase(v.begin());
+  EXPECT_EQ(*it, "b");
+  it = v.erase(v.end() - 1);
+  EXPECT_EQ(it, v.end());
+  EXPECT_EQ(v, (open_stl::inplace_vector<std::string, 8>{"b", "c", "d"}));
+}
+
+TEST(inplace_vector, element_lifetimes) {
+  {
+    open_stl::inplace_vector<tracked, 6> v;
+    // Nothing is constructed until it is added.
+    EXPECT_EQ(tracked::live, 0);
+    v.emplace_back(1);
+    v.emplace_back(2);
+    v.push_back(tracked(3));
+    EXPECT_EQ(tracked::live, 3);
+    v.emplace(v.begin(), 0);
+    EXPECT_EQ(tracked::live, 4);
+    EXPECT_EQ(v.front().value, 0);
+    EXPECT_EQ(v.back().value, 3);
+
+    open_stl::inplace_vector<tracked, 6> copy(v);
+    EXPECT_EQ(tracked::live, 8);
+    EXPECT_EQ(copy, v);
+    v.erase(v.begin() + 1);
+    EXPECT_EQ(tracked::live, 7);
+    copy = v;
+    EXPECT_EQ(tracked::live, 6);
+    EXPECT_EQ(copy, v);
+
+    open_stl::inplace_vector<tracked, 6> moved(open_stl::move(copy));
+    EXPECT_EQ(moved, v);
+    moved.emplace_back(7);
+    v.swap(moved);
+    EXPECT_EQ(v.size(), 4);
+    EXPECT_EQ(moved.size(), 3);
+    EXPECT_EQ(v.back().value, 7);
+
+    moved.clear();
+    EXPECT_EQ(tracked::live, 4 + copy.size());
+  }
+  EXPECT_EQ(tracked::live, 0);
+}
+
+int main(int argc, char **argv) {
+  // Initialize Google Test
+  ::testing::InitGoogleTest(&argc, argv);
+
+  // Run tests
+  return RUN_ALL_TESTS();
+}
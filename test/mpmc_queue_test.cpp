@@ -0,0 +1,173 @@
+#include <OpenSTL/mpmc_queue.h>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST(mpmc_queue, push_and_pop) {
+  open_stl::mpmc_queue<int> queue(3);
+  EXPECT_EQ(queue.capacity(), 4);
+  EXPECT_TRUE(queue.empty());
+  for (int i = 0; i < 4; i++) {
+    EXPECT_TRUE(queue.try_push(i));
+  }
+  EXPECT_FALSE(queue.try_push(4));
+  EXPECT_EQ(queue.size(), 4);
+
+  int value = -1;
+  for (int i = 0; i < 4; i++) {
+    EXPECT_TRUE(queue.try_pop(value));
+    EXPECT_EQ(value, i);
+  }
+  EXPECT_FALSE(queue.try_pop(value));
+  EXPECT_EQ(value, 3);
+}
+
+TEST(mpmc_queue, moves_and_emplaces) {
+  open_stl::mpmc_queue<std::string> queue(2);
+  std::string text = "hello";
+  EXPECT_TRUE(queue.try_push(open_stl::move(text)));
+  EXPECT_TRUE(queue.try_emplace(3, 'x'));
+  std::string kept = "kept";
+  EXPECT_FALSE(queue.try_push(open_stl::move(kept)));
+  EXPECT_EQ(kept, "kept");
+  EXPECT_EQ(queue.pop(), "hello");
+  EXPECT_EQ(queue.pop(), "xxx");
+}
+
+TEST(mpmc_queue, batches) {
+  open_stl::mpmc_queue<int> queue(8);
+  int input[20];
+  for (int i = 0; i < 20; i++) {
+    input[i] = i;
+  }
+  int output[20];
+  EXPECT_EQ(queue.try_push_n(input, 6), 6);
+  EXPECT_EQ(queue.try_pop_n(output, 5), 5);
+  EXPECT_EQ(queue.try_push_n(input + 6, 14), 7);
+  EXPECT_EQ(queue.try_pop_n(output + 5, 20), 8);
+  for (int i = 0; i < 13; i++) {
+    EXPECT_EQ(output[i], i);
+  }
+  EXPECT_TRUE(queue.empty());
+
+  queue.push_n(input, 8);
+  queue.pop_n(output, 8);
+  for (int i = 0; i < 8; i++) {
+    EXPECT_EQ(output[i], i);
+  }
+}
+
+TEST(mpmc_queue, empty_batches) {
+  open_stl::mpmc_queue<int> queue(4);
+  int values[2] = {1, 2};
+  EXPECT_EQ(queue.try_push_n(values, 0), 0);
+  EXPECT_EQ(queue.try_pop_n(values, 0), 0);
+  EXPECT_EQ(queue.try_push_n(values, 2), 2);
+  EXPECT_EQ(queue.try_push_n(values, 0), 0);
+  EXPECT_EQ(queue.try_pop_n(values, 0), 0);
+  EXPECT_EQ(queue.size(), 2);
+}
+
+TEST(mpmc_queue, blocking_pop_waits_for_push) {
+  open_stl::mpmc_queue<int> queue(2);
+  std::thread consumer([&queue] {
+    for (int i = 0; i < 100; i++) {
+      EXPECT_EQ(queue.pop(), i);
+    }
+  });
+  for (int i = 0; i < 100; i++) {
+    queue.push(i);
+  }
+  consumer.join();
+  EXPECT_TRUE(queue.empty());
+}
+
+// Every producer sends its own increasing sequence; consumers check that
+// each producer's values arrive in order and that every value arrives once.
+TEST(mpmc_queue, many_producers_and_consumers) {
+  constexpr int producers = 4;
+  constexpr int consumers = 4;
+  constexpr std::uint64_t per_producer = 50000;
+  open_stl::mpmc_queue<std::uint64_t> queue(256);
+  std::atomic<std::uint64_t> sum{0};
+  std::atomic<std::uint64_t> received{0};
+  std::atomic<bool> ordered{true};
+
+  std::vector<std::thread> threads;
+  for (int p = 0; p < producers; p++) {
+    threads.emplace_back([&queue, p] {
+      std::uint64_t base = std::uint64_t(p) << 32;
+      std::uint64_t batch[8];
+      std::uint64_t next = 0;
+      while (next < per_producer) {
+        switch (next % 3) {
+          case 0:
+            queue.push(base | next);
+            next++;
+            break;
+          case 1:
+            if (queue.try_push(base | next)) {
+              next++;
+            } else {
+              std::this_thread::yield();
+            }
+            break;
+          default: {
+            std::uint64_t n = per_producer - next < 8 ? per_producer - next : 8;
+            for (std::uint64_t i = 0; i < n; i++) {
+              batch[i] = base | (next + i);
+            }
+            std::size_t pushed = queue.try_push_n(batch, n);
+            if (pushed == 0) std::this_thread::yield();
+            next += pushed;
+          }
+        }
+      }
+    });
+  }
+  for (int c = 0; c < consumers; c++) {
+    threads.emplace_back([&] {
+      std::uint64_t last[producers];
+      for (int p = 0; p < producers; p++) {
+        last[p] = ~std::uint64_t(0);
+      }
+      std::uint64_t batch[8];
+      auto check = [&](std::uint64_t value) {
+        int producer = int(value >> 32);
+        std::uint64_t index = value & 0xffffffffu;
+        if (last[producer] != ~std::uint64_t(0) && index <= last[producer]) {
+          ordered = false;
+        }
+        last[producer] = index;
+        sum += index;
+      };
+      while (received.load() < producers * per_producer) {
+        std::size_t n = queue.try_pop_n(batch, 8);
+        if (n == 0) std::this_thread::yield();
+        for (std::size_t i = 0; i < n; i++) {
+          check(batch[i]);
+        }
+        received += n;
+      }
+    });
+  }
+  for (std::thread &thread : threads) {
+    thread.join();
+  }
+  EXPECT_TRUE(ordered);
+  EXPECT_EQ(received.load(), producers * per_producer);
+  EXPECT_EQ(sum.load(), producers * (per_producer * (per_producer - 1) / 2));
+  EXPECT_TRUE(queue.empty());
+}
+
+int main(int argc, char **argv) {
+  // Initialize Google Test
+  ::testing::InitGoogleTest(&argc, argv);
+
+  // Run tests
+  return RUN_ALL_TESTS();
+}
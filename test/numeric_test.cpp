@@ -0,0 +1,166 @@
+#include <OpenSTL/numeric.h>
+#include <OpenSTL/vector.h>
+#include <gtest/gtest.h>
+
+#include <cstdint>
+
+namespace {
+// Large enough for the parallel overloads to split the range into blocks on
+// a multi-core machine.
+constexpr std::size_t kLargeSize = 1 << 20;
+
+// Function composition x -> a * x + b: associative but not commutative, so
+// it catches scans that combine blocks in the wrong order.
+struct affine {
+  std::int64_t a = 1;
+  std::int64_t b = 0;
+};
+
+affine compose(const affine &lhs, const affine &rhs) {
+  return {(lhs.a * rhs.a) % 1000003, (lhs.b * rhs.a + rhs.b) % 1000003};
+}
+}  // namespace
+
+TEST(reduce, sequential) {
+  open_stl::vector<int> vec = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11};
+  EXPECT_EQ(open_stl::reduce(vec.begin(), vec.end()), 66);
+  EXPECT_EQ(open_stl::reduce(vec.begin(), vec.end(), 100), 166);
+  EXPECT_EQ(open_stl::reduce(vec.begin(), vec.begin() + 3, 1,
+                             [](int lhs, int rhs) { return lhs * rhs; }),
+            6);
+
+  open_stl::vector<int> empty;
+  EXPECT_EQ(open_stl::reduce(empty.begin(), empty.end(), 7), 7);
+}
+
+TEST(reduce, parallel) {
+  open_stl::vector<std::uint32_t> vec(kLargeSize);
+  for (std::size_t i = 0; i < vec.size(); i++) {
+    vec[i] = static_cast<std::uint32_t>(i % 1000);
+  }
+  std::uint64_t expected =
+      open_stl::reduce(vec.begin(), vec.end(), std::uint64_t(0));
+  EXPECT_EQ(open_stl::reduce(open_stl::execution::par, vec.begin(), vec.end(),
+                             std::uint64_t(0)),
+            expected);
+  EXPECT_EQ(open_stl::reduce(open_stl::execution::seq, vec.begin(), vec.end(),
+                             std::uint64_t(0)),
+            expected);
+
+  open_stl::vector<int> small = {4, 5, 6};
+  EXPECT_EQ(open_stl::reduce(open_stl::execution::par, small.begin(),
+                             small.end()),
+            15);
+}
+
+TEST(transform_reduce, unary) {
+  open_stl::vector<int> vec = {1, 2, 3, 4, 5, 6, 7, 8, 9};
+  auto square = [](int value) { return value * value; };
+  EXPECT_EQ(open_stl::transform_reduce(vec.begin(), vec.end(), 0,
+                                       open_stl::plus<>(), square),
+            285);
+
+  open_stl::vector<std::uint32_t> large(kLargeSize, 3);
+  EXPECT_EQ(open_stl::transform_reduce(
+                open_stl::execution::par, large.begin(), large.end(),
+                std::uint64_t(0), open_stl::plus<>(),
+                [](std::uint32_t value) { return std::uint64_t(value) * 2; }),
+            std::uint64_t(kLargeSize) * 6);
+}
+
+TEST(transform_reduce, binary) {
+  open_stl::vector<int> lhs = {1, 2, 3, 4};
+  open_stl::vector<int> rhs = {5, 6, 7, 8};
+  EXPECT_EQ(open_stl::transform_reduce(lhs.begin(), lhs.end(), rhs.begin(), 0),
+            70);
+
+  open_stl::vector<double> x(kLargeSize, 0.5);
+  open_stl::vector<double> y(kLargeSize, 4.0);
+  EXPECT_DOUBLE_EQ(open_stl::transform_reduce(open_stl::execution::par,
+                                              x.begin(), x.end(), y.begin(),
+                                              0.0),
+                   2.0 * kLargeSize);
+}
+
+TEST(inclusive_scan, sequential) {
+  open_stl::vector<int> vec = {1, 2, 3, 4, 5};
+  open_stl::vector<int> out(5);
+  int *end = open_stl::inclusive_scan(vec.begin(), vec.end(), out.begin());
+  EXPECT_EQ(end, out.end());
+  EXPECT_EQ(out, open_stl::vector<int>({1, 3, 6, 10, 15}));
+
+  open_stl::inclusive_scan(vec.begin(), vec.end(), out.begin(),
+                           open_stl::plus<>(), 10);
+  EXPECT_EQ(out, open_stl::vector<int>({11, 13, 16, 20, 25}));
+
+  open_stl::inclusive_scan(vec.begin(), vec.end(), vec.begin());
+  EXPECT_EQ(vec, open_stl::vector<int>({1, 3, 6, 10, 15}));
+}
+
+TEST(exclusive_scan, sequential) {
+  open_stl::vector<int> vec = {1, 2, 3, 4, 5};
+  open_stl::vector<int> out(5);
+  open_stl::exclusive_scan(vec.begin(), vec.end(), out.begin(), 0);
+  EXPECT_EQ(out, open_stl::vector<int>({0, 1, 3, 6, 10}));
+
+  open_stl::exclusive_scan(vec.begin(), vec.end(), vec.begin(), 1,
+                           [](int lhs, int rhs) { return lhs * rhs; });
+  EXPECT_EQ(vec, open_stl::vector<int>({1, 1, 2, 6, 24}));
+}
+
+TEST(inclusive_scan, parallel) {
+  open_stl::vector<std::uint32_t> counts(kLargeSize);
+  for (std::size_t i = 0; i < counts.size(); i++) {
+    counts[i] = static_cast<std::uint32_t>(i % 7);
+  }
+  open_stl::vector<std::uint32_t> expected(kLargeSize);
+  open_stl::inclusive_scan(counts.begin(), counts.end(), expected.begin());
+
+  open_stl::vector<std::uint32_t> out(kLargeSize);
+  open_stl::inclusive_scan(open_stl::execution::par, counts.begin(),
+                           counts.end(), out.begin());
+  EXPECT_EQ(out, expected);
+
+  open_stl::inclusive_scan(open_stl::execution::par, counts.begin(),
+                           counts.end(), counts.begin());
+  EXPECT_EQ(counts, expected);
+}
+
+TEST(exclusive_scan, parallel) {
+  // CSR row offsets: offsets[i] is where row i starts.
+  open_stl::vector<std::uint32_t> offsets(kLargeSize);
+  for (std::size_t i = 0; i < offsets.size(); i++) {
+    offsets[i] = static_cast<std::uint32_t>(i % 5);
+  }
+  open_stl::vector<std::uint32_t> expected(kLargeSize);
+  open_stl::exclusive_scan(offsets.begin(), offsets.end(), expected.begin(),
+                           std::uint32_t(0));
+  open_stl::exclusive_scan(open_stl::execution::par, offsets.begin(),
+                           offsets.end(), offsets.begin(), std::uint32_t(0));
+  EXPECT_EQ(offsets, expected);
+}
+
+TEST(inclusive_scan, parallel_non_commutative) {
+  open_stl::vector<affine> functions(kLargeSize);
+  for (std::size_t i = 0; i < functions.size(); i++) {
+    functions[i] = {std::int64_t(i % 3 + 1), std::int64_t(i % 11)};
+  }
+  open_stl::vector<affine> expected(kLargeSize);
+  open_stl::inclusive_scan(functions.begin(), functions.end(),
+                           expected.begin(), compose);
+  open_stl::vector<affine> out(kLargeSize);
+  open_stl::inclusive_scan(open_stl::execution::par, functions.begin(),
+                           functions.end(), out.begin(), compose);
+  for (std::size_t i = 0; i < kLargeSize; i++) {
+    ASSERT_EQ(out[i].a, expected[i].a);
+    ASSERT_EQ(out[i].b, expected[i].b);
+  }
+}
+
+int main(int argc, char **argv) {
+  // Initialize Google Test
+  ::testing::InitGoogleTest(&argc, argv);
+
+  // Run tests
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,218 @@
+#include <OpenSTL/functional.h>
+#include <OpenSTL/priority_queue.h>
+#include <OpenSTL/vector.h>
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <limits>
+#include <queue>
+#include <random>
+#include <set>
+#include <string>
+#include <utility>
+
+namespace {
+// Pushes and pops random values and checks the order against the standard
+// priority_queue.
+template <std::size_t Arity>
+void check_against_std() {
+  std::mt19937 random(Arity);
+  open_stl::priority_queue<int, open_stl::vector<int>, open_stl::less<int>,
+                           Arity>
+      queue;
+  std::priority_queue<int> reference;
+  for (int round = 0; round < 50000; round++) {
+    if (random() % 3 != 0 || reference.empty()) {
+      int value = int(random() % 1000);
+      queue.push(value);
+      reference.push(value);
+    } else {
+      ASSERT_EQ(queue.top(), reference.top());
+      queue.pop();
+      reference.pop();
+    }
+    ASSERT_EQ(queue.size(), reference.size());
+  }
+  while (!reference.empty()) {
+    ASSERT_EQ(queue.top(), reference.top());
+    queue.pop();
+    reference.pop();
+  }
+  EXPECT_TRUE(queue.empty());
+}
+}  // namespace
+
+TEST(priority_queue, matches_std_for_every_arity) {
+  check_against_std<2>();
+  check_against_std<3>();
+  check_against_std<4>();
+  check_against_std<8>();
+}
+
+TEST(priority_queue, constructors_and_ordering) {
+  open_stl::vector<int> values = {5, 1, 9, 3, 7, 2, 8};
+  open_stl::priority_queue<int> heapified(open_stl::less<int>(), values);
+  EXPECT_EQ(heapified.size(), 7);
+  EXPECT_EQ(heapified.top(), 9);
+
+  open_stl::priority_queue<int, open_stl::vector<int>, open_stl::greater<int>>
+      min_queue(values.begin(), values.end());
+  open_stl::vector<int> drained;
+  while (!min_queue.empty()) {
+    drained.push_back(min_queue.top());
+    min_queue.pop();
+  }
+  EXPECT_EQ(drained, open_stl::vector<int>({1, 2, 3, 5, 7, 8, 9}));
+
+  open_stl::priority_queue<std::string> words;
+  words.emplace(3, 'b');
+  words.push("c");
+  words.push(std::string("a"));
+  EXPECT_EQ(words.top(), "c");
+  open_stl::priority_queue<std::string> other;
+  other.swap(words);
+  EXPECT_TRUE(words.empty());
+  EXPECT_EQ(other.size(), 3);
+}
+
+TEST(indexed_priority_queue, update_erase_and_decrease_key) {
+  open_stl::indexed_priority_queue<int> queue;
+  queue.push(4, 40);
+  queue.push(1, 10);
+  queue.push(7, 70);
+  queue.push(2, 20);
+  EXPECT_EQ(queue.top_id(), 7);
+  EXPECT_EQ(queue.top(), 70);
+  EXPECT_TRUE(queue.contains(2));
+  EXPECT_FALSE(queue.contains(3));
+  EXPECT_FALSE(queue.contains(100));
+
+  // In a max-heap, decrease_key raises the id towards the top.
+  queue.decrease_key(1, 80);
+  EXPECT_EQ(queue.top_id(), 1);
+  queue.update(1, 5);
+  EXPECT_EQ(queue.top_id(), 7);
+  EXPECT_EQ(queue.priority(1), 5);
+
+  queue.erase(7);
+  EXPECT_FALSE(queue.contains(7));
+  EXPECT_EQ(queue.top_id(), 4);
+  queue.pop();
+  EXPECT_EQ(queue.top_id(), 2);
+  EXPECT_EQ(queue.size(), 2);
+
+  // Ids can come back after removal.
+  queue.push(7, 1);
+  queue.clear();
+  EXPECT_TRUE(queue.empty());
+  EXPECT_FALSE(queue.contains(2));
+  queue.push(2, 3);
+  EXPECT_EQ(queue.top_id(), 2);
+}
+
+TEST(indexed_priority_queue, random_operations_match_ordered_set) {
+  std::mt19937 random(11);
+  open_stl::indexed_priority_queue<int, open_stl::less<int>, 3> queue;
+  // Ordered by (priority, id); ties in priority may pop in any order.
+  std::set<std::pair<int, std::size_t>> reference;
+  open_stl::vector<int> priorities(500);
+  for (int round = 0; round < 100000; round++) {
+    std::size_t id = random() % 500;
+    int priority = int(random() % 1000);
+    if (!queue.contains(id)) {
+      queue.push(id, priority);
+      reference.emplace(priority, id);
+      priorities[id] = priority;
+    } else if (random() % 4 == 0) {
+      queue.erase(id);
+      reference.erase({priorities[id], id});
+    } else {
+      queue.update(id, priority);
+      reference.erase({priorities[id], id});
+      reference.emplace(priority, id);
+      priorities[id] = priority;
+    }
+    ASSERT_EQ(queue.size(), reference.size());
+    if (!reference.empty()) {
+      ASSERT_EQ(queue.top(), reference.rbegin()->first);
+      ASSERT_EQ(queue.priority(queue.top_id()), queue.top());
+    }
+  }
+}
+
+TEST(indexed_priority_queue, increasing_ids) {
+  // Every push extends the id table, which must grow geometrically for
+  // this to finish quickly.
+  open_stl::indexed_priority_queue<int, open_stl::greater<int>> queue;
+  for (int id = 0; id < 200000; id++) {
+    queue.push(id, 200000 - id);
+  }
+  EXPECT_FALSE(queue.contains(200000));
+  for (int id = 199999; id >= 0; id--) {
+    ASSERT_EQ(queue.top_id(), std::size_t(id));
+    queue.pop();
+  }
+  EXPECT_TRUE(queue.empty());
+  EXPECT_FALSE(queue.contains(0));
+}
+
+TEST(indexed_priority_queue, dijkstra) {
+  // A random graph as an adjacency list of (target, weight) pairs.
+  const std::size_t vertices = 2000;
+  std::mt19937 random(5);
+  open_stl::vector<open_stl::vector<std::pair<std::size_t, long>>> edges(
+      vertices);
+  for (std::size_t edge = 0; edge < vertices * 8; edge++) {
+    edges[random() % vertices].push_back(
+        {random() % vertices, long(random() % 100 + 1)});
+  }
+  const long infinity = std::numeric_limits<long>::max();
+
+  open_stl::vector<long> distance(vertices, infinity);
+  open_stl::indexed_priority_queue<long, open_stl::greater<long>> queue;
+  distance[0] = 0;
+  queue.push(0, 0);
+  while (!queue.empty()) {
+    std::size_t vertex = queue.top_id();
+    queue.pop();
+    for (const auto &[target, weight] : edges[vertex]) {
+      long candidate = distance[vertex] + weight;
+      if (candidate >= distance[target]) continue;
+      if (queue.contains(target)) {
+        queue.decrease_key(target, candidate);
+      } else {
+        queue.push(target, candidate);
+      }
+      distance[target] = candidate;
+    }
+  }
+
+  // The same search with the standard heap and lazy deletion.
+  open_stl::vector<long> expected(vertices, infinity);
+  std::priority_queue<std::pair<long, std::size_t>,
+                      std::vector<std::pair<long, std::size_t>>,
+                      std::greater<>>
+      lazy;
+  expected[0] = 0;
+  lazy.push({0, 0});
+  while (!lazy.empty()) {
+    auto [dist, vertex] = lazy.top();
+    lazy.pop();
+    if (dist != expected[vertex]) continue;
+    for (const auto &[target, weight] : edges[vertex]) {
+      if (dist + weight < expected[target]) {
+        expected[target] = dist + weight;
+        lazy.push({expected[target], target});
+      }
+    }
+  }
+  EXPECT_EQ(distance, expected);
+}
+
+int main(int argc, char **argv) {
+  // Initialize Google Test
+  ::testing::InitGoogleTest(&argc, argv);
+
+  // Run tests
+  return RUN_ALL_TESTS();
+}
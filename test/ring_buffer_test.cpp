@@ -0,0 +1,201 @@
+#include <OpenSTL/ring_buffer.h>
+#include <gtest/gtest.h>
+
+#include <deque>
+#include <random>
+#include <string>
+
+TEST(ring_buffer, push_and_pop_both_ends) {
+  open_stl::ring_buffer<int, 4> values;
+  EXPECT_TRUE(values.empty());
+  EXPECT_EQ(values.capacity(), 4);
+  EXPECT_TRUE(values.push_back(2));
+  EXPECT_TRUE(values.push_front(1));
+  EXPECT_TRUE(values.push_back(3));
+  EXPECT_TRUE(values.push_front(0));
+  EXPECT_TRUE(values.full());
+  EXPECT_FALSE(values.push_back(4));
+  EXPECT_FALSE(values.push_front(4));
+  for (int i = 0; i < 4; i++) {
+    EXPECT_EQ(values[i], i);
+  }
+  EXPECT_THROW(values.at(4), std::out_of_range);
+
+  values.pop_front();
+  values.pop_back();
+  EXPECT_EQ(values.size(), 2);
+  EXPECT_EQ(values.front(), 1);
+  EXPECT_EQ(values.back(), 2);
+  values.clear();
+  EXPECT_TRUE(values.empty());
+}
+
+TEST(ring_buffer, overwrite_keeps_latest_values) {
+  open_stl::ring_buffer<int, 8> window;
+  for (int i = 0; i < 20; i++) {
+    window.push_back_overwrite(i);
+  }
+  EXPECT_EQ(window.size(), 8);
+  int expected = 12;
+  for (int value : window) {
+    EXPECT_EQ(value, expected++);
+  }
+
+  window.push_front_overwrite(100);
+  EXPECT_EQ(window.front(), 100);
+  EXPECT_EQ(window.back(), 18);
+}
+
+TEST(ring_buffer, spans_cover_wrapped_contents) {
+  open_stl::ring_buffer<int, 8> values;
+  for (int i = 0; i < 6; i++) {
+    values.push_back(i);
+  }
+  for (int i = 0; i < 4; i++) {
+    values.pop_front();
+  }
+  for (int i = 6; i < 10; i++) {
+    values.push_back(i);
+  }
+  open_stl::pair<int *, std::size_t> first = values.first_span();
+  open_stl::pair<int *, std::size_t> second = values.second_span();
+  ASSERT_EQ(first.second, 4);
+  ASSERT_EQ(second.second, 2);
+  EXPECT_EQ(first.first[0], 4);
+  EXPECT_EQ(first.first[3], 7);
+  EXPECT_EQ(second.first[0], 8);
+  EXPECT_EQ(second.first[1], 9);
+}
+
+TEST(ring_buffer, bulk_copies_wrap_around) {
+  open_stl::ring_buffer<int, 16> values;
+  int input[40];
+  for (int i = 0; i < 40; i++) {
+    input[i] = i;
+  }
+  EXPECT_EQ(values.push_back_n(input, 10), 10);
+  int output[40];
+  EXPECT_EQ(values.pop_front_n(output, 7), 7);
+  EXPECT_EQ(values.push_back_n(input + 10, 30), 13);
+  EXPECT_TRUE(values.full());
+  EXPECT_EQ(values.pop_front_n(output + 7, 40), 16);
+  for (int i = 0; i < 23; i++) {
+    EXPECT_EQ(output[i], i);
+  }
+  EXPECT_TRUE(values.empty());
+
+  values.push_back_overwrite_n(input, 40);
+  EXPECT_EQ(values.front(), 24);
+  EXPECT_EQ(values.back(), 39);
+  values.push_back_overwrite_n(input, 4);
+  EXPECT_EQ(values.front(), 28);
+  EXPECT_EQ(values.back(), 3);
+}
+
+TEST(ring_buffer, dynamic_matches_std_deque) {
+  open_stl::dynamic_ring_buffer<std::string> values(100);
+  EXPECT_EQ(values.capacity(), 100);
+  std::deque<std::string> reference;
+  std::mt19937 rng(33);
+  for (int step = 0; step < 100000; step++) {
+    std::string value = std::to_string(step);
+    switch (rng() % 6) {
+      case 0:
+        EXPECT_EQ(values.push_back(value), reference.size() < 100);
+        if (reference.size() < 100) reference.push_back(value);
+        break;
+      case 1:
+        EXPECT_EQ(values.push_front(value), reference.size() < 100);
+        if (reference.size() < 100) reference.push_front(value);
+        break;
+      case 2:
+        values.push_back_overwrite(value);
+        if (reference.size() == 100) reference.pop_front();
+        reference.push_back(value);
+        break;
+      case 3:
+        if (!reference.empty()) {
+          values.pop_front();
+          reference.pop_front();
+        }
+        break;
+      case 4:
+        if (!reference.empty()) {
+          values.pop_back();
+          reference.pop_back();
+        }
+        break;
+      default: {
+        std::string batch[3] = {value, value + "a", value + "b"};
+        std::size_t written = values.push_back_n(batch, 3);
+        for (std::size_t i = 0; i < written; i++) {
+          reference.push_back(batch[i]);
+        }
+        break;
+      }
+    }
+    ASSERT_EQ(values.size(), reference.size());
+  }
+  for (std::size_t i = 0; i < reference.size(); i++) {
+    EXPECT_EQ(values[i], reference[i]);
+  }
+}
+
+TEST(ring_buffer, dynamic_copy_and_move) {
+  open_stl::dynamic_ring_buffer<int> values(5);
+  for (int i = 0; i < 7; i++) {
+    values.push_back_overwrite(i);
+  }
+  open_stl::dynamic_ring_buffer<int> copy = values;
+  values.pop_front();
+  EXPECT_EQ(copy.size(), 5);
+  EXPECT_EQ(copy.front(), 2);
+
+  open_stl::dynamic_ring_buffer<int> moved = open_stl::move(copy);
+  EXPECT_EQ(moved.back(), 6);
+  EXPECT_TRUE(copy.empty());
+  copy = moved;
+  EXPECT_EQ(copy.front(), 2);
+  EXPECT_EQ(copy.size(), 5);
+}
+
+TEST(ring_buffer, fixed_copy_and_move) {
+  open_stl::ring_buffer<int, 4> values;
+  for (int i = 0; i < 6; i++) {
+    values.push_back_overwrite(i);
+  }
+  open_stl::ring_buffer<int, 4> copy = values;
+  values.pop_front();
+  EXPECT_EQ(copy.size(), 4);
+  EXPECT_EQ(copy.front(), 2);
+
+  open_stl::ring_buffer<int, 4> moved = open_stl::move(copy);
+  EXPECT_EQ(moved.back(), 5);
+  EXPECT_TRUE(copy.empty());
+  copy = moved;
+  EXPECT_EQ(copy.front(), 2);
+}
+
+TEST(ring_buffer, overwrite_without_capacity_drops_values) {
+  open_stl::dynamic_ring_buffer<int> empty(0);
+  empty.push_back_overwrite(1);
+  empty.push_front_overwrite(2);
+  EXPECT_TRUE(empty.empty());
+
+  open_stl::dynamic_ring_buffer<int> values(3);
+  values.push_back(1);
+  open_stl::dynamic_ring_buffer<int> moved = open_stl::move(values);
+  values.push_back_overwrite(2);
+  values.push_front_overwrite(3);
+  EXPECT_TRUE(values.empty());
+  EXPECT_EQ(values.capacity(), 0);
+  EXPECT_EQ(moved.front(), 1);
+}
+
+int main(int argc, char **argv) {
+  // Initialize Google Test
+  ::testing::InitGoogleTest(&argc, argv);
+
+  // Run tests
+  return RUN_ALL_TESTS();
+}
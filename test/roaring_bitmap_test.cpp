@@ -0,0 +1,204 @@
+#include <OpenSTL/roaring_bitmap.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+std::vector<std::uint32_t> values_of(const open_stl::roaring_bitmap &bitmap) {
+  std::vector<std::uint32_t> values;
+  bitmap.for_each([&values](std::uint32_t value) { values.push_back(value); });
+  return values;
+}
+
+std::vector<std::uint32_t> values_of(const std::set<std::uint32_t> &set) {
+  return std::vector<std::uint32_t>(set.begin(), set.end());
+}
+
+// A mix of sparse values, a dense chunk and long runs, so every pair of
+// container kinds meets in the set operations.
+void fill(std::mt19937 &random, open_stl::roaring_bitmap &bitmap,
+          std::set<std::uint32_t> &reference) {
+  for (int i = 0; i < 3000; i++) {
+    std::uint32_t value = random() % (8 << 16);
+    bitmap.add(value);
+    reference.insert(value);
+  }
+  std::uint32_t dense = (random() % 8) << 16;
+  for (int i = 0; i < 20000; i++) {
+    std::uint32_t value = dense + random() % 0x10000;
+    bitmap.add(value);
+    reference.insert(value);
+  }
+  std::uint32_t start = random() % (8 << 16);
+  std::uint32_t length = random() % 100000;
+  bitmap.add_range(start, std::uint64_t(start) + length);
+  for (std::uint32_t value = start; value < start + length; value++) {
+    reference.insert(value);
+  }
+}
+}  // namespace
+
+TEST(roaring_bitmap, add_remove_and_container_changes) {
+  open_stl::roaring_bitmap bitmap = {5, 1, 70000, 1};
+  EXPECT_EQ(bitmap.cardinality(), 3);
+  EXPECT_TRUE(bitmap.contains(70000));
+  EXPECT_FALSE(bitmap.contains(70001));
+  EXPECT_FALSE(bitmap.add(5));
+  EXPECT_EQ(bitmap.to_vector(),
+            open_stl::vector<std::uint32_t>({1, 5, 70000}));
+
+  // Crossing 4096 values turns the array into a bitset and back.
+  for (std::uint32_t value = 0; value < 10000; value += 2) {
+    bitmap.add(value);
+  }
+  EXPECT_EQ(bitmap.cardinality(), 5000 + 3);
+  for (std::uint32_t value = 0; value < 10000; value += 4) {
+    EXPECT_TRUE(bitmap.remove(value));
+  }
+  EXPECT_FALSE(bitmap.remove(0));
+  EXPECT_EQ(bitmap.cardinality(), 2500 + 3);
+  EXPECT_TRUE(bitmap.contains(2));
+  EXPECT_FALSE(bitmap.contains(4));
+
+  EXPECT_TRUE(bitmap.remove(70000));
+  EXPECT_FALSE(bitmap.contains(70000));
+  bitmap.clear();
+  EXPECT_TRUE(bitmap.empty());
+  EXPECT_EQ(bitmap.cardinality(), 0);
+
+  // Ranges may span containers, including whole ones.
+  bitmap.add_range(65530, 3 * 65536 + 10);
+  EXPECT_EQ(bitmap.cardinality(), 3 * 65536 + 10 - 65530);
+  EXPECT_FALSE(bitmap.contains(65529));
+  EXPECT_TRUE(bitmap.contains(65530));
+  EXPECT_TRUE(bitmap.contains(2 * 65536 + 123));
+  EXPECT_FALSE(bitmap.contains(3 * 65536 + 10));
+  bitmap.add_range(4294967290u, std::uint64_t(1) << 32);
+  EXPECT_TRUE(bitmap.contains(4294967295u));
+  EXPECT_TRUE(bitmap.remove(2 * 65536 + 123));
+  EXPECT_FALSE(bitmap.contains(2 * 65536 + 123));
+}
+
+TEST(roaring_bitmap, set_operations_match_std_set) {
+  std::mt19937 random(17);
+  for (int round = 0; round < 4; round++) {
+    open_stl::roaring_bitmap a;
+    open_stl::roaring_bitmap b;
+    std::set<std::uint32_t> a_set;
+    std::set<std::uint32_t> b_set;
+    fill(random, a, a_set);
+    fill(random, b, b_set);
+    // Mix run containers into every other round.
+    if (round % 2 == 1) {
+      EXPECT_TRUE(a.run_optimize());
+    }
+    EXPECT_EQ(values_of(a), values_of(a_set));
+    EXPECT_EQ(a.cardinality(), a_set.size());
+
+    std::vector<std::uint32_t> expected;
+    std::set_intersection(a_set.begin(), a_set.end(), b_set.begin(),
+                          b_set.end(), std::back_inserter(expected));
+    EXPECT_EQ(values_of(a & b), expected);
+    EXPECT_EQ(a.and_cardinality(b), expected.size());
+
+    expected.clear();
+    std::set_union(a_set.begin(), a_set.end(), b_set.begin(), b_set.end(),
+                   std::back_inserter(expected));
+    EXPECT_EQ(values_of(a | b), expected);
+
+    expected.clear();
+    std::set_difference(a_set.begin(), a_set.end(), b_set.begin(),
+                        b_set.end(), std::back_inserter(expected));
+    EXPECT_EQ(values_of(a - b), expected);
+
+    open_stl::roaring_bitmap c = a;
+    c |= b;
+    c -= b;
+    EXPECT_EQ(c, a - b);
+    c &= a;
+    EXPECT_EQ(c, a - b);
+    EXPECT_NE(c, a);
+    EXPECT_EQ((a | b) & a, a);
+  }
+}
+
+TEST(roaring_bitmap, run_optimize_shrinks_ranges) {
+  open_stl::roaring_bitmap bitmap;
+  bitmap.add_range(1000, 60000);
+  bitmap.add(100000);
+  std::size_t before = bitmap.serialized_size();
+  EXPECT_TRUE(bitmap.run_optimize());
+  EXPECT_LT(bitmap.serialized_size(), before);
+  EXPECT_TRUE(bitmap.contains(59999));
+  EXPECT_FALSE(bitmap.contains(60000));
+  EXPECT_EQ(bitmap.cardinality(), 59000 + 1);
+  // Changing a run container expands it again.
+  EXPECT_TRUE(bitmap.remove(30000));
+  EXPECT_FALSE(bitmap.contains(30000));
+  EXPECT_EQ(bitmap.cardinality(), 59000);
+}
+
+TEST(roaring_bitmap, serializes_in_the_portable_format) {
+  // Without runs: cookie, container count, the key and cardinality - 1 of
+  // every container, the offsets, then the containers.
+  open_stl::roaring_bitmap small = {1, 2, 3};
+  const unsigned char no_runs[] = {0x3a, 0x30, 0, 0, 1, 0, 0, 0, 0, 0, 2,
+                                   0,    0x10, 0, 0, 0, 1, 0, 2, 0, 3, 0};
+  ASSERT_EQ(small.serialized_size(), sizeof(no_runs));
+  unsigned char buffer[sizeof(no_runs)];
+  EXPECT_EQ(small.serialize(buffer), sizeof(no_runs));
+  EXPECT_TRUE(std::equal(buffer, buffer + sizeof(no_runs), no_runs));
+  EXPECT_EQ(open_stl::roaring_bitmap::deserialize(no_runs, sizeof(no_runs)),
+            small);
+
+  // With runs: the cookie carries the container count, followed by a
+  // bitset of run containers; below four containers there are no offsets.
+  open_stl::roaring_bitmap range;
+  range.add_range(0, 100);
+  range.run_optimize();
+  const unsigned char with_runs[] = {0x3b, 0x30, 0, 0, 1, 0,    0, 99,
+                                     0,    1,    0, 0, 0, 99, 0};
+  ASSERT_EQ(range.serialized_size(), sizeof(with_runs));
+  unsigned char run_buffer[sizeof(with_runs)];
+  range.serialize(run_buffer);
+  EXPECT_TRUE(std::equal(run_buffer, run_buffer + sizeof(with_runs),
+                         with_runs));
+
+  // Round trips through every container kind.
+  std::mt19937 random(3);
+  open_stl::roaring_bitmap bitmap;
+  std::set<std::uint32_t> reference;
+  fill(random, bitmap, reference);
+  for (int optimize = 0; optimize < 2; optimize++) {
+    if (optimize == 1) bitmap.run_optimize();
+    std::vector<unsigned char> bytes(bitmap.serialized_size());
+    EXPECT_EQ(bitmap.serialize(bytes.data()), bytes.size());
+    open_stl::roaring_bitmap copy =
+        open_stl::roaring_bitmap::deserialize(bytes.data(), bytes.size());
+    EXPECT_EQ(copy, bitmap);
+    EXPECT_EQ(values_of(copy), values_of(reference));
+
+    EXPECT_THROW(open_stl::roaring_bitmap::deserialize(bytes.data(),
+                                                       bytes.size() - 1),
+                 std::invalid_argument);
+  }
+  const unsigned char bad_cookie[] = {1, 2, 3, 4, 0, 0, 0, 0};
+  EXPECT_THROW(open_stl::roaring_bitmap::deserialize(bad_cookie, 8),
+               std::invalid_argument);
+  EXPECT_THROW(open_stl::roaring_bitmap::deserialize(no_runs, 8),
+               std::invalid_argument);
+}
+
+int main(int argc, char **argv) {
+  // Initialize Google Test
+  ::testing::InitGoogleTest(&argc, argv);
+
+  // Run tests
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,137 @@
+#include <OpenSTL/slot_map.h>
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+TEST(slot_map, insert_find_and_erase) {
+  open_stl::slot_map<std::string> map;
+  EXPECT_TRUE(map.empty());
+  open_stl::slot_handle a = map.insert("alpha");
+  open_stl::slot_handle b = map.emplace(3, 'b');
+  std::string gamma = "gamma";
+  open_stl::slot_handle c = map.insert(gamma);
+  EXPECT_EQ(map.size(), 3);
+  EXPECT_EQ(map[a], "alpha");
+  EXPECT_EQ(*map.find(b), "bbb");
+  EXPECT_EQ(map.at(c), "gamma");
+  EXPECT_NE(a, b);
+
+  // Erasing the first value moves the last one into its place.
+  EXPECT_TRUE(map.erase(a));
+  EXPECT_FALSE(map.erase(a));
+  EXPECT_EQ(map.size(), 2);
+  EXPECT_EQ(map.data()[0], "gamma");
+  EXPECT_EQ(map[c], "gamma");
+  EXPECT_EQ(map.handle_at(0), c);
+  EXPECT_EQ(map.find(a), nullptr);
+  EXPECT_FALSE(map.contains(a));
+  EXPECT_THROW(map.at(a), std::out_of_range);
+
+  // The freed slot is reused, but the old handle stays stale.
+  open_stl::slot_handle d = map.insert("delta");
+  EXPECT_EQ(d.index, a.index);
+  EXPECT_NE(d.generation, a.generation);
+  EXPECT_FALSE(map.contains(a));
+  EXPECT_EQ(map[d], "delta");
+
+  // Handles that were never issued are rejected too.
+  EXPECT_FALSE(map.contains(open_stl::slot_handle()));
+  EXPECT_FALSE(map.contains(open_stl::slot_handle{100, 1}));
+
+  std::string joined;
+  for (const std::string &value : map) {
+    joined += value + ",";
+  }
+  EXPECT_EQ(joined, "gamma,bbb,delta,");
+
+  map.clear();
+  EXPECT_TRUE(map.empty());
+  EXPECT_FALSE(map.contains(b));
+  EXPECT_FALSE(map.contains(d));
+  open_stl::slot_handle e = map.insert("epsilon");
+  EXPECT_EQ(map[e], "epsilon");
+  EXPECT_FALSE(map.contains(b));
+}
+
+TEST(slot_map, random_operations_match_reference) {
+  std::mt19937 random(3);
+  open_stl::slot_map<int> map;
+  map.reserve(256);
+  // The live handles and their values, and handles that were erased.
+  std::unordered_map<std::size_t, int> reference;
+  std::vector<open_stl::slot_handle> live;
+  std::vector<open_stl::slot_handle> erased;
+  auto key = [](open_stl::slot_handle handle) {
+    return std::size_t(handle.index) << 32 | handle.generation;
+  };
+  for (int round = 0; round < 100000; round++) {
+    if (live.empty() || random() % 5 < 3) {
+      int value = int(random());
+      open_stl::slot_handle handle = map.insert(value);
+      ASSERT_EQ(reference.count(key(handle)), 0);
+      reference[key(handle)] = value;
+      live.push_back(handle);
+    } else {
+      std::size_t position = random() % live.size();
+      open_stl::slot_handle handle = live[position];
+      live[position] = live.back();
+      live.pop_back();
+      ASSERT_TRUE(map.erase(handle));
+      reference.erase(key(handle));
+      erased.push_back(handle);
+    }
+    ASSERT_EQ(map.size(), reference.size());
+    if (round % 1000 == 0) {
+      for (open_stl::slot_handle handle : live) {
+        ASSERT_EQ(map[handle], reference[key(handle)]);
+      }
+      for (open_stl::slot_handle handle : erased) {
+        ASSERT_EQ(map.find(handle), nullptr);
+      }
+      // Every dense position maps back to a live handle and its value.
+      for (std::size_t i = 0; i < map.size(); i++) {
+        ASSERT_EQ(map.data()[i], reference[key(map.handle_at(i))]);
+      }
+    }
+  }
+}
+
+TEST(slot_map, dense_iteration_sees_every_value_once) {
+  open_stl::slot_map<long> map;
+  std::vector<open_stl::slot_handle> handles;
+  for (long value = 1; value <= 1000; value++) {
+    handles.push_back(map.insert(value));
+  }
+  // Erase every third value; the rest stay packed.
+  long expected = 0;
+  for (std::size_t i = 0; i < handles.size(); i++) {
+    if (i % 3 == 0) {
+      map.erase(handles[i]);
+    } else {
+      expected += long(i + 1);
+    }
+  }
+  long sum = 0;
+  for (long value : map) {
+    sum += value;
+  }
+  EXPECT_EQ(sum, expected);
+  EXPECT_EQ(map.end() - map.begin(), 666);
+  for (long &value : map) {
+    value *= 2;
+  }
+  EXPECT_EQ(map[handles[1]], 4);
+}
+
+int main(int argc, char **argv) {
+  // Initialize Google Test
+  ::testing::InitGoogleTest(&argc, argv);
+
+  // Run tests
+  return RUN_ALL_TESTS();
+}
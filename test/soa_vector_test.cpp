@@ -0,0 +1,149 @@
+#include <OpenSTL/soa_vector.h>
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <string>
+#include <tuple>
+
+namespace {
+// Counts live column buffers.
+int live_columns = 0;
+
+template <typename T>
+struct counting_allocator : open_stl::allocator<T> {
+  template <typename U>
+  struct rebind {
+    using other = counting_allocator<U>;
+  };
+
+  T *allocate(std::size_t count) {
+    live_columns++;
+    return open_stl::allocator<T>::allocate(count);
+  }
+
+  void deallocate(T *ptr) {
+    if (ptr != nullptr) live_columns--;
+    open_stl::allocator<T>::deallocate(ptr);
+  }
+};
+
+using counted_records =
+    open_stl::basic_soa_vector<counting_allocator<char>, int, double,
+                               std::string>;
+}  // namespace
+
+TEST(soa_vector, push_back_and_access) {
+  open_stl::soa_vector<int, double, std::string> records;
+  EXPECT_TRUE(records.empty());
+  records.push_back(1, 1.5, "one");
+  records.push_back(std::make_tuple(2, 2.5, std::string("two")));
+  records.emplace_back(3, 3.5f, "xxxxx");
+  EXPECT_EQ(records.size(), 3);
+
+  auto [id, weight, name] = records[2];
+  EXPECT_EQ(id, 3);
+  EXPECT_EQ(weight, 3.5);
+  EXPECT_EQ(name, "xxxxx");
+  EXPECT_EQ(std::get<2>(records.front()), "one");
+  EXPECT_EQ(std::get<0>(records.back()), 3);
+  EXPECT_THROW(records.at(3), std::out_of_range);
+
+  // The proxy reference writes through to the columns.
+  std::get<1>(records[0]) = 10.0;
+  records[1] = std::make_tuple(20, 20.5, std::string("twenty"));
+  EXPECT_EQ(records.data<1>()[0], 10.0);
+  EXPECT_EQ(records.data<0>()[1], 20);
+  EXPECT_EQ(records.data<2>()[1], "twenty");
+
+  records.pop_back();
+  EXPECT_EQ(records.size(), 2);
+}
+
+TEST(soa_vector, columns_are_contiguous) {
+  open_stl::soa_vector<float, int> points;
+  for (int i = 0; i < 1000; i++) {
+    points.push_back(float(i) * 0.5f, i);
+  }
+  open_stl::span<const float> xs = points.data<0>();
+  open_stl::span<int> ids = points.data<1>();
+  EXPECT_EQ(xs.size(), points.size());
+  EXPECT_EQ(ids.data() + 1, &std::get<1>(points[1]));
+  float sum = 0;
+  for (std::size_t i = 0; i < points.size(); i++) {
+    sum += xs[i];
+    EXPECT_EQ(ids[i], int(i));
+  }
+  EXPECT_EQ(sum, 0.5f * 999 * 1000 / 2);
+}
+
+TEST(soa_vector, reserve_resize_and_clear) {
+  open_stl::soa_vector<int, std::string> values;
+  values.reserve(10);
+  EXPECT_EQ(values.capacity(), 10);
+  values.resize(3);
+  EXPECT_EQ(values.size(), 3);
+  EXPECT_EQ(std::get<0>(values[2]), 0);
+  EXPECT_EQ(std::get<1>(values[2]), "");
+  values.push_back(7, "seven");
+  values.resize(1);
+  values.resize(4);
+  EXPECT_EQ(std::get<1>(values[3]), "");
+  values.clear();
+  EXPECT_TRUE(values.empty());
+  EXPECT_EQ(values.capacity(), 10);
+}
+
+TEST(soa_vector, iterators_and_copies) {
+  open_stl::soa_vector<int, int> pairs;
+  for (int i = 0; i < 100; i++) {
+    pairs.push_back(i, i * i);
+  }
+  int count = 0;
+  for (auto [value, square] : pairs) {
+    EXPECT_EQ(square, value * value);
+    count++;
+  }
+  EXPECT_EQ(count, 100);
+  EXPECT_EQ(pairs.end() - pairs.begin(), 100);
+
+  open_stl::soa_vector<int, int> copy = pairs;
+  EXPECT_EQ(copy, pairs);
+  std::get<1>(copy[5]) = -1;
+  EXPECT_NE(copy, pairs);
+
+  open_stl::soa_vector<int, int> moved = open_stl::move(copy);
+  EXPECT_TRUE(copy.empty());
+  EXPECT_EQ(std::get<1>(moved[5]), -1);
+  copy = pairs;
+  EXPECT_EQ(copy, pairs);
+
+  const open_stl::soa_vector<int, int> &view = pairs;
+  int sum = 0;
+  for (auto [value, square] : view) {
+    sum += value;
+  }
+  EXPECT_EQ(sum, 4950);
+}
+
+TEST(soa_vector, columns_use_the_allocator) {
+  {
+    counted_records records;
+    records.push_back(1, 1.0, "one");
+    EXPECT_EQ(live_columns, 3);
+    for (int i = 0; i < 100; i++) {
+      records.emplace_back(i, 0.5, "");
+    }
+    // Growing replaces every column but keeps one buffer per column.
+    EXPECT_EQ(live_columns, 3);
+    EXPECT_EQ(records.data<2>()[0], "one");
+  }
+  EXPECT_EQ(live_columns, 0);
+}
+
+int main(int argc, char **argv) {
+  // Initialize Google Test
+  ::testing::InitGoogleTest(&argc, argv);
+
+  // Run tests
+  return RUN_ALL_TESTS();
+}
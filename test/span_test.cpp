@@ -0,0 +1,121 @@
+#include <OpenSTL/array.h>
+#include <OpenSTL/span.h>
+#include <OpenSTL/string.h>
+#include <OpenSTL/vector.h>
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+
+namespace {
+// Sums a slice without copying it, as a parser would.
+int sum(open_stl::span<const int> values) {
+  int total = 0;
+  for (int value : values) {
+    total += value;
+  }
+  return total;
+}
+}  // namespace
+
+TEST(span, views_vectors_arrays_and_pointers) {
+  open_stl::vector<int> vector = {1, 2, 3, 4, 5};
+  open_stl::array<int, 3> array = {10, 20, 30};
+  int raw[4] = {7, 7, 7, 7};
+
+  EXPECT_EQ(sum(vector), 15);
+  EXPECT_EQ(sum(array), 60);
+  EXPECT_EQ(sum(raw), 28);
+  EXPECT_EQ(sum(open_stl::span<const int>(vector.data() + 1, 3)), 9);
+  EXPECT_EQ(sum(open_stl::span<const int>(raw, raw + 2)), 14);
+  EXPECT_EQ(sum({}), 0);
+
+  // Writes through a span land in the vector.
+  open_stl::span<int> view = vector;
+  view[0] = 100;
+  EXPECT_EQ(vector[0], 100);
+  EXPECT_EQ(view.data(), vector.data());
+  EXPECT_EQ(view.size(), 5);
+  EXPECT_EQ(view.size_bytes(), 5 * sizeof(int));
+  EXPECT_EQ(view.front(), 100);
+  EXPECT_EQ(view.back(), 5);
+  EXPECT_THROW(view.at(5), std::out_of_range);
+
+  const open_stl::vector<int> &constant = vector;
+  open_stl::span deduced = constant;
+  static_assert(std::is_same_v<decltype(deduced), open_stl::span<const int>>);
+  open_stl::span fixed = array;
+  static_assert(std::is_same_v<decltype(fixed), open_stl::span<int, 3>>);
+  static_assert(sizeof(fixed) == sizeof(int *));
+
+  open_stl::string text = "bytes";
+  open_stl::span<const char> chars = text;
+  EXPECT_EQ(chars.size(), 5);
+  EXPECT_EQ(chars[4], 's');
+}
+
+TEST(span, slicing) {
+  int values[8] = {0, 1, 2, 3, 4, 5, 6, 7};
+  open_stl::span<int> all = values;
+
+  EXPECT_EQ(sum(all.first(3)), 3);
+  EXPECT_EQ(sum(all.last(2)), 13);
+  EXPECT_EQ(sum(all.subspan(2, 3)), 9);
+  EXPECT_EQ(sum(all.subspan(5)), 18);
+  EXPECT_TRUE(all.subspan(8).empty());
+
+  open_stl::span<int, 8> fixed = values;
+  auto head = fixed.first<2>();
+  static_assert(std::is_same_v<decltype(head), open_stl::span<int, 2>>);
+  auto tail = fixed.subspan<3>();
+  static_assert(std::is_same_v<decltype(tail), open_stl::span<int, 5>>);
+  auto middle = all.subspan<1, 2>();
+  static_assert(std::is_same_v<decltype(middle), open_stl::span<int, 2>>);
+  EXPECT_EQ(tail.front(), 3);
+  EXPECT_EQ(middle.back(), 2);
+  EXPECT_EQ(fixed.last<1>()[0], 7);
+
+  // A static extent converts to a dynamic one, and mutable to const.
+  open_stl::span<const int> dynamic = fixed;
+  EXPECT_EQ(dynamic.size(), 8);
+
+  open_stl::span<const std::byte> bytes = open_stl::as_bytes(all.first(2));
+  EXPECT_EQ(bytes.size(), 2 * sizeof(int));
+}
+
+TEST(span, algorithms) {
+  open_stl::vector<int> values = {9, 3, 7, 1, 8, 2};
+  open_stl::span<int> view = values;
+
+  // Sort only the first half.
+  open_stl::sort(view.first(3));
+  EXPECT_EQ(values, open_stl::vector<int>({3, 7, 9, 1, 8, 2}));
+  open_stl::sort(view, [](int lhs, int rhs) { return lhs > rhs; });
+  EXPECT_EQ(values, open_stl::vector<int>({9, 8, 7, 3, 2, 1}));
+  open_stl::sort(view);
+
+  open_stl::span<const int> sorted = values;
+  EXPECT_EQ(*open_stl::lower_bound(sorted, 4), 7);
+  EXPECT_EQ(*open_stl::upper_bound(sorted, 7), 8);
+  EXPECT_TRUE(open_stl::binary_search(sorted, 8));
+  EXPECT_FALSE(open_stl::binary_search(sorted, 4));
+
+  int doubled[6];
+  open_stl::transform(sorted, doubled, [](int value) { return value * 2; });
+  EXPECT_EQ(doubled[5], 18);
+  EXPECT_TRUE(open_stl::equal(sorted.first(2), open_stl::span<int>(values)
+                                                   .subspan(0, 2)));
+  EXPECT_FALSE(open_stl::equal(sorted.first(2), sorted.last(2)));
+
+  open_stl::fill(view.last(2), 0);
+  EXPECT_EQ(values, open_stl::vector<int>({1, 2, 3, 7, 0, 0}));
+}
+
+int main(int argc, char **argv) {
+  // Initialize Google Test
+  ::testing::InitGoogleTest(&argc, argv);
+
+  // Run tests
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,105 @@
+#include <OpenSTL/spsc_queue.h>
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <string>
+#include <thread>
+
+TEST(spsc_queue, push_and_pop) {
+  open_stl::spsc_queue<int, 4> queue;
+  EXPECT_TRUE(queue.empty());
+  EXPECT_EQ(queue.capacity(), 4);
+  for (int i = 0; i < 4; i++) {
+    EXPECT_TRUE(queue.try_push(i));
+  }
+  EXPECT_FALSE(queue.try_push(4));
+  EXPECT_EQ(queue.size(), 4);
+
+  int value = -1;
+  for (int i = 0; i < 4; i++) {
+    EXPECT_TRUE(queue.try_pop(value));
+    EXPECT_EQ(value, i);
+  }
+  EXPECT_FALSE(queue.try_pop(value));
+  EXPECT_EQ(value, 3);
+}
+
+TEST(spsc_queue, moves_and_emplaces) {
+  open_stl::spsc_queue<std::string, 2> queue;
+  std::string text = "hello";
+  EXPECT_TRUE(queue.try_push(open_stl::move(text)));
+  EXPECT_TRUE(queue.try_emplace(3, 'x'));
+  std::string kept = "kept";
+  EXPECT_FALSE(queue.try_push(open_stl::move(kept)));
+  EXPECT_EQ(kept, "kept");
+
+  std::string out[2];
+  EXPECT_EQ(queue.try_pop_n(out, 5), 2);
+  EXPECT_EQ(out[0], "hello");
+  EXPECT_EQ(out[1], "xxx");
+}
+
+TEST(spsc_queue, batches_wrap_around) {
+  open_stl::spsc_queue<int, 8> queue;
+  int input[20];
+  for (int i = 0; i < 20; i++) {
+    input[i] = i;
+  }
+  int output[20];
+  EXPECT_EQ(queue.try_push_n(input, 6), 6);
+  EXPECT_EQ(queue.try_pop_n(output, 5), 5);
+  EXPECT_EQ(queue.try_push_n(input + 6, 14), 7);
+  EXPECT_EQ(queue.try_pop_n(output + 5, 20), 8);
+  for (int i = 0; i < 13; i++) {
+    EXPECT_EQ(output[i], i);
+  }
+  EXPECT_TRUE(queue.empty());
+}
+
+TEST(spsc_queue, transfers_between_threads) {
+  constexpr std::uint64_t count = 1000000;
+  static open_stl::spsc_queue<std::uint64_t, 1024> queue;
+  std::thread producer([] {
+    std::uint64_t batch[16];
+    std::uint64_t next = 0;
+    while (next < count) {
+      if (next % 3 == 0) {
+        if (queue.try_push(next)) {
+          next++;
+        } else {
+          std::this_thread::yield();
+        }
+        continue;
+      }
+      std::uint64_t n = count - next < 16 ? count - next : 16;
+      for (std::uint64_t i = 0; i < n; i++) {
+        batch[i] = next + i;
+      }
+      std::uint64_t pushed = queue.try_push_n(batch, n);
+      if (pushed == 0) std::this_thread::yield();
+      next += pushed;
+    }
+  });
+  std::uint64_t expected = 0;
+  std::uint64_t batch[32];
+  bool ordered = true;
+  while (expected < count) {
+    std::size_t n = queue.try_pop_n(batch, 32);
+    if (n == 0) std::this_thread::yield();
+    for (std::size_t i = 0; i < n; i++) {
+      ordered = ordered && batch[i] == expected;
+      expected++;
+    }
+  }
+  producer.join();
+  EXPECT_TRUE(ordered);
+  EXPECT_TRUE(queue.empty());
+}
+
+int main(int argc, char **argv) {
+  // Initialize Google Test
+  ::testing::InitGoogleTest(&argc, argv);
+
+  // Run tests
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,236 @@
+#include <OpenSTL/flat_hash_map.h>
+#include <OpenSTL/hash.h>
+#include <OpenSTL/string.h>
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstring>
+#include <random>
+#include <stdexcept>
+#include <string>
+
+namespace {
+// Counts live heap buffers, to check which strings allocate.
+int live_buffers = 0;
+
+template <typename T>
+struct counting_allocator : open_stl::allocator<T> {
+  template <typename U>
+  struct rebind {
+    using other = counting_allocator<U>;
+  };
+
+  T *allocate(std::size_t count) {
+    live_buffers++;
+    return open_stl::allocator<T>::allocate(count);
+  }
+
+  void deallocate(T *ptr) {
+    live_buffers--;
+    open_stl::allocator<T>::deallocate(ptr);
+  }
+};
+
+using counted_string = open_stl::basic_string<char, counting_allocator<char>>;
+}  // namespace
+
+TEST(string, short_strings_stay_inline) {
+  EXPECT_EQ(sizeof(open_stl::string), 3 * sizeof(void *));
+  open_stl::string empty;
+  EXPECT_TRUE(empty.empty());
+  EXPECT_STREQ(empty.c_str(), "");
+
+  std::size_t limit = open_stl::string::inline_capacity;
+  EXPECT_EQ(limit, 3 * sizeof(void *) - 1);
+  open_stl::string full(limit, 'x');
+  EXPECT_TRUE(full.is_inline());
+  EXPECT_EQ(full.size(), limit);
+  EXPECT_EQ(full.capacity(), limit);
+  EXPECT_EQ(full.c_str()[limit], '\0');
+
+  full.push_back('y');
+  EXPECT_FALSE(full.is_inline());
+  EXPECT_EQ(full.size(), limit + 1);
+  EXPECT_EQ(full.back(), 'y');
+  full.pop_back();
+  full.shrink_to_fit();
+  EXPECT_TRUE(full.is_inline());
+  EXPECT_EQ(full, open_stl::string(limit, 'x'));
+
+  live_buffers = 0;
+  {
+    counted_string key = "user:1234567890";
+    counted_string copy = key;
+    counted_string moved = open_stl::move(copy);
+    EXPECT_EQ(moved, "user:1234567890");
+    EXPECT_EQ(live_buffers, 0);
+    counted_string long_key(100, 'k');
+    EXPECT_EQ(live_buffers, 1);
+  }
+  EXPECT_EQ(live_buffers, 0);
+}
+
+TEST(string, append_grows_geometrically) {
+  live_buffers = 0;
+  {
+    counted_string text;
+    int reallocations = 0;
+    std::size_t capacity = text.capacity();
+    for (int i = 0; i < 100000; i++) {
+      text.append("ab", 2);
+      if (text.capacity() != capacity) {
+        reallocations++;
+        capacity = text.capacity();
+      }
+    }
+    EXPECT_EQ(text.size(), 200000);
+    EXPECT_LE(reallocations, 20);
+    EXPECT_EQ(live_buffers, 1);
+
+    // Reserving one more character at a time still doubles.
+    counted_string reserved;
+    for (std::size_t i = 0; i < 1000; i++) {
+      reserved.reserve(i + 1);
+      reserved.push_back('r');
+    }
+    EXPECT_LE(reserved.capacity(), 2000);
+    EXPECT_EQ(reserved.size(), 1000);
+  }
+  EXPECT_EQ(live_buffers, 0);
+}
+
+TEST(string, append_from_itself) {
+  open_stl::string text = "abc";
+  for (int i = 0; i < 6; i++) {
+    text.append(text);
+  }
+  EXPECT_EQ(text.size(), 3u << 6);
+  EXPECT_EQ(text.substr(189), "abc");
+  text.append(text.data() + 1, 2);
+  EXPECT_EQ(text.substr(text.size() - 5), "abcbc");
+
+  open_stl::string small = "xy";
+  small.assign(small.data() + 1, 1);
+  EXPECT_EQ(small, "y");
+}
+
+TEST(string, resize_and_overwrite) {
+  open_stl::string text = "value=";
+  text.resize_and_overwrite(64, [](char *data, std::size_t count) {
+    EXPECT_EQ(count, 64);
+    EXPECT_EQ(std::memcmp(data, "value=", 6), 0);
+    std::memcpy(data + 6, "42", 2);
+    return std::size_t(8);
+  });
+  EXPECT_EQ(text, "value=42");
+  EXPECT_GE(text.capacity(), 64);
+
+  text.resize(10, '!');
+  EXPECT_EQ(text, "value=42!!");
+  text.resize(5);
+  EXPECT_EQ(text, "value");
+  text.clear();
+  EXPECT_TRUE(text.empty());
+}
+
+TEST(string, access_search_and_compare) {
+  open_stl::string text = "hello, world";
+  EXPECT_EQ(text.front(), 'h');
+  EXPECT_EQ(text.at(4), 'o');
+  EXPECT_THROW(text.at(12), std::out_of_range);
+  EXPECT_THROW(text.substr(13), std::out_of_range);
+  EXPECT_EQ(text.find('o'), 4);
+  EXPECT_EQ(text.find('o', 5), 8);
+  EXPECT_EQ(text.find('z'), open_stl::string::npos);
+  EXPECT_EQ(text.find("world"), 7);
+  EXPECT_EQ(text.find("worlds"), open_stl::string::npos);
+  EXPECT_EQ(text.find(""), 0);
+  EXPECT_EQ(text.substr(7, 100), "world");
+
+  EXPECT_TRUE(open_stl::string("abc") < open_stl::string("abd"));
+  EXPECT_TRUE(open_stl::string("ab") < open_stl::string("abc"));
+  EXPECT_EQ(open_stl::string("abc").compare(open_stl::string("abc")), 0);
+  EXPECT_TRUE(open_stl::string("b") >= open_stl::string("abc"));
+
+  open_stl::string greeting = open_stl::string("hello") + ", " + "world";
+  EXPECT_EQ(greeting, text);
+  greeting += '!';
+  EXPECT_NE(greeting, text);
+  greeting.swap(text);
+  EXPECT_EQ(text, "hello, world!");
+
+  int letters = 0;
+  for (char ch : text) {
+    letters += (ch >= 'a' && ch <= 'z');
+  }
+  EXPECT_EQ(letters, 10);
+}
+
+TEST(string, random_operations_match_std_string) {
+  std::mt19937 random(7);
+  open_stl::string text;
+  std::string reference;
+  for (int round = 0; round < 20000; round++) {
+    switch (random() % 5) {
+      case 0: {
+        char ch = char('a' + random() % 26);
+        text.push_back(ch);
+        reference.push_back(ch);
+        break;
+      }
+      case 1: {
+        std::size_t count = random() % 40;
+        text.append(count, '#');
+        reference.append(count, '#');
+        break;
+      }
+      case 2: {
+        std::size_t count = random() % 50;
+        text.resize(count, '-');
+        reference.resize(count, '-');
+        break;
+      }
+      case 3:
+        text.shrink_to_fit();
+        break;
+      default: {
+        open_stl::string copy = text;
+        text = open_stl::move(copy);
+        break;
+      }
+    }
+    ASSERT_EQ(text.size(), reference.size());
+    ASSERT_EQ(std::strcmp(text.c_str(), reference.c_str()), 0);
+  }
+}
+
+TEST(string, wide_characters) {
+  open_stl::u32string text = U"a\u00e9\u4e2d";
+  EXPECT_EQ(text.size(), 3);
+  EXPECT_TRUE(text.is_inline());
+  text.append(20, U'z');
+  EXPECT_FALSE(text.is_inline());
+  EXPECT_EQ(text[2], U'\u4e2d');
+  EXPECT_EQ(text.back(), U'z');
+}
+
+TEST(string, hashes_as_a_key) {
+  open_stl::string key = "session";
+  EXPECT_EQ(open_stl::hash<open_stl::string>()(key),
+            open_stl::hash_bytes("session", 7));
+
+  open_stl::flat_hash_map<open_stl::string, int> counts;
+  for (int i = 0; i < 1000; i++) {
+    counts[open_stl::string("key") + open_stl::string(i % 10, '#')]++;
+  }
+  EXPECT_EQ(counts.size(), 10);
+  EXPECT_EQ(counts[open_stl::string("key###")], 100);
+}
+
+int main(int argc, char **argv) {
+  // Initialize Google Test
+  ::testing::InitGoogleTest(&argc, argv);
+
+  // Run tests
+  return RUN_ALL_TESTS();
+}
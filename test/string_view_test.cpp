@@ -0,0 +1,90 @@
+#include <OpenSTL/hash.h>
+#include <OpenSTL/string.h>
+#include <OpenSTL/string_view.h>
+#include <OpenSTL/vector.h>
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+
+TEST(string_view, slices_without_copying) {
+  const char *request = "GET /index.html HTTP/1.1";
+  open_stl::string_view line = request;
+  EXPECT_EQ(line.size(), 24);
+
+  open_stl::string_view method = line.substr(0, line.find(' '));
+  EXPECT_EQ(method, "GET");
+  EXPECT_EQ(method.data(), request);
+
+  line.remove_prefix(method.size() + 1);
+  open_stl::string_view path = line.substr(0, line.find(' '));
+  EXPECT_EQ(path, "/index.html");
+  EXPECT_TRUE(path.starts_with('/'));
+  EXPECT_TRUE(path.ends_with(".html"));
+  EXPECT_FALSE(path.starts_with("/index.html.gz"));
+
+  line.remove_suffix(3);
+  EXPECT_TRUE(line.ends_with("HTTP/"));
+  EXPECT_EQ(line.rfind('/'), line.size() - 1);
+  EXPECT_EQ(line.rfind('z'), open_stl::string_view::npos);
+  EXPECT_TRUE(line.contains("index"));
+  EXPECT_FALSE(line.contains('?'));
+  EXPECT_THROW(line.substr(line.size() + 1), std::out_of_range);
+  EXPECT_THROW(line.at(line.size()), std::out_of_range);
+
+  // Tokenize into views of the original buffer.
+  open_stl::string_view csv = "a,bb,,ccc";
+  open_stl::vector<open_stl::string_view> fields;
+  for (;;) {
+    std::size_t comma = csv.find(',');
+    fields.push_back(csv.substr(0, comma));
+    if (comma == open_stl::string_view::npos) break;
+    csv.remove_prefix(comma + 1);
+  }
+  ASSERT_EQ(fields.size(), 4);
+  EXPECT_EQ(fields[1], "bb");
+  EXPECT_TRUE(fields[2].empty());
+  EXPECT_EQ(fields[3], "ccc");
+}
+
+TEST(string_view, compares_and_searches) {
+  open_stl::string_view text = "abracadabra";
+  EXPECT_EQ(text.find("abra", 1), 7);
+  EXPECT_EQ(text.find("cad"), 4);
+  EXPECT_EQ(text.find("dab", 7), open_stl::string_view::npos);
+  EXPECT_EQ(text.find('c'), 4);
+  EXPECT_EQ(text.find(""), 0);
+
+  EXPECT_TRUE(open_stl::string_view("abc") < open_stl::string_view("abd"));
+  EXPECT_TRUE(open_stl::string_view("ab") < open_stl::string_view("abc"));
+  EXPECT_TRUE(open_stl::string_view("b") > open_stl::string_view("abc"));
+  EXPECT_TRUE(open_stl::string_view("abc") != open_stl::string_view("ab"));
+  EXPECT_EQ(open_stl::string_view("abc").compare("abc"), 0);
+
+  static_assert(open_stl::string_view("constexpr").find('x') == 6);
+  static_assert(open_stl::string_view("prefix").starts_with("pre"));
+}
+
+TEST(string_view, converts_to_and_from_string) {
+  open_stl::string owner = "a key longer than the inline buffer";
+  open_stl::string_view view = owner;
+  EXPECT_EQ(view.data(), owner.data());
+  EXPECT_EQ(view.size(), owner.size());
+  EXPECT_TRUE(owner == view);
+  EXPECT_EQ(owner.find(open_stl::string_view("inline")), 22);
+
+  open_stl::string copy(view.substr(2, 3));
+  EXPECT_EQ(copy, "key");
+  copy.append(open_stl::string_view("chain").substr(0, 4));
+  EXPECT_EQ(copy, "keychai");
+
+  EXPECT_EQ(open_stl::hash<open_stl::string_view>()(view),
+            open_stl::hash<open_stl::string>()(owner));
+}
+
+int main(int argc, char **argv) {
+  // Initialize Google Test
+  ::testing::InitGoogleTest(&argc, argv);
+
+  // Run tests
+  return RUN_ALL_TESTS();
+}
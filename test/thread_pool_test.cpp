@@ -0,0 +1,163 @@
+#include <OpenSTL/numeric.h>
+#include <OpenSTL/thread_pool.h>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST(thread_pool, submit_returns_results) {
+  open_stl::thread_pool pool(4);
+  EXPECT_EQ(pool.size(), 4);
+  std::vector<open_stl::task_handle<int>> handles;
+  for (int i = 0; i < 100; i++) {
+    handles.push_back(pool.submit([i]() { return i * i; }));
+  }
+  for (int i = 0; i < 100; i++) {
+    EXPECT_EQ(handles[i].get(), i * i);
+    EXPECT_FALSE(handles[i].valid());
+  }
+
+  open_stl::task_handle<std::string> text =
+      pool.submit([]() { return std::string("done"); });
+  text.wait();
+  EXPECT_TRUE(text.ready());
+  EXPECT_EQ(text.get(), "done");
+
+  std::atomic<int> calls{0};
+  open_stl::task_handle<void> side_effect =
+      pool.submit([&calls]() { calls++; });
+  side_effect.get();
+  EXPECT_EQ(calls.load(), 1);
+}
+
+TEST(thread_pool, get_rethrows_exceptions) {
+  open_stl::thread_pool pool(2);
+  open_stl::task_handle<int> failing =
+      pool.submit([]() -> int { throw std::runtime_error("failed"); });
+  EXPECT_THROW(failing.get(), std::runtime_error);
+}
+
+std::uint64_t fibonacci(open_stl::thread_pool &pool, int n) {
+  if (n < 2) return n;
+  if (n < 12) return fibonacci(pool, n - 1) + fibonacci(pool, n - 2);
+  open_stl::task_handle<std::uint64_t> left =
+      pool.submit([&pool, n]() { return fibonacci(pool, n - 1); });
+  std::uint64_t right = fibonacci(pool, n - 2);
+  return left.get() + right;
+}
+
+TEST(thread_pool, nested_tasks_do_not_deadlock) {
+  open_stl::thread_pool pool(2);
+  open_stl::task_handle<std::uint64_t> result =
+      pool.submit([&pool]() { return fibonacci(pool, 25); });
+  EXPECT_EQ(result.get(), 75025);
+}
+
+TEST(thread_pool, parallel_for_visits_every_index_once) {
+  open_stl::thread_pool pool(3);
+  std::vector<std::atomic<int>> visits(100000);
+  pool.parallel_for(0, visits.size(),
+                    [&visits](std::size_t i) { visits[i]++; });
+  for (std::size_t i = 0; i < visits.size(); i++) {
+    ASSERT_EQ(visits[i].load(), 1);
+  }
+
+  // Uneven iterations and nested loops.
+  std::atomic<std::uint64_t> sum{0};
+  pool.parallel_for(0, 64, [&pool, &sum](std::size_t i) {
+    pool.parallel_for(0, i * 10, [&sum](std::size_t j) { sum += j; }, 7);
+  }, 1);
+  std::uint64_t expected = 0;
+  for (std::uint64_t i = 0; i < 64; i++) {
+    expected += i * 10 * (i * 10 - 1) / 2;
+  }
+  EXPECT_EQ(sum.load(), expected);
+}
+
+TEST(thread_pool, parallel_for_rethrows_after_finishing) {
+  open_stl::thread_pool pool(3);
+  std::atomic<int> visited{0};
+  EXPECT_THROW(pool.parallel_for(
+                   0, 1000,
+                   [&visited](std::size_t i) {
+                     if (i == 500) throw std::logic_error("index 500");
+                     visited++;
+                   },
+                   1),
+               std::logic_error);
+  EXPECT_EQ(visited.load(), 999);
+}
+
+TEST(thread_pool, shutdown_runs_queued_tasks) {
+  std::atomic<int> calls{0};
+  open_stl::thread_pool pool(2);
+  for (int i = 0; i < 1000; i++) {
+    pool.submit([&calls]() { calls++; });
+  }
+  pool.shutdown();
+  EXPECT_EQ(calls.load(), 1000);
+  EXPECT_EQ(pool.size(), 0);
+  EXPECT_THROW(pool.submit([]() {}), std::runtime_error);
+
+  // Loops still run, on the calling thread.
+  int sum = 0;
+  pool.parallel_for(0, 10, [&sum](std::size_t i) { sum += int(i); });
+  EXPECT_EQ(sum, 45);
+}
+
+TEST(thread_pool, parallel_algorithms_share_the_default_pool) {
+  // Parallel algorithms only split random-access ranges of the library's
+  // own containers or raw pointers.
+  open_stl::vector<std::uint64_t> values(1 << 20);
+  for (std::size_t i = 0; i < values.size(); i++) {
+    values[i] = i;
+  }
+  const std::uint64_t expected =
+      std::uint64_t(values.size()) * (values.size() - 1) / 2;
+  for (int round = 0; round < 20; round++) {
+    std::uint64_t sum = open_stl::reduce(open_stl::execution::par,
+                                         values.begin(), values.end());
+    EXPECT_EQ(sum, expected);
+  }
+
+  // With a single hardware thread every block runs on the caller.
+  if (open_stl::internal::hardware_threads() < 2) return;
+
+  // The caller holds its first element until another thread has worked on
+  // the range, which only a worker of the default pool can do.
+  std::thread::id caller = std::this_thread::get_id();
+  std::atomic<bool> helped{false};
+  bool waited = false;
+  std::uint64_t sum = open_stl::transform_reduce(
+      open_stl::execution::par, values.begin(), values.end(),
+      std::uint64_t(0), open_stl::plus<>(),
+      [&](std::uint64_t value) {
+        if (std::this_thread::get_id() != caller) {
+          helped.store(true, std::memory_order_relaxed);
+        } else if (!waited) {
+          waited = true;
+          auto deadline =
+              std::chrono::steady_clock::now() + std::chrono::seconds(10);
+          while (!helped.load(std::memory_order_relaxed) &&
+                 std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::yield();
+          }
+        }
+        return value;
+      });
+  EXPECT_EQ(sum, expected);
+  EXPECT_TRUE(helped.load());
+}
+
+int main(int argc, char **argv) {
+  // Initialize Google Test
+  ::testing::InitGoogleTest(&argc, argv);
+
+  // Run tests
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,73 @@
+#include <OpenSTL/top_k.h>
+#include <OpenSTL/vector.h>
+#include <gtest/gtest.h>
+
+TEST(top_k, keeps_largest) {
+  open_stl::top_k<int> heaviest(3);
+  EXPECT_TRUE(heaviest.empty());
+  EXPECT_EQ(heaviest.capacity(), 3);
+
+  open_stl::vector<int> values = {5, 1, 9, 3, 7, 9, 2, 8};
+  heaviest.push(values.begin(), values.end());
+  EXPECT_EQ(heaviest.size(), 3);
+  EXPECT_EQ(heaviest.threshold(), 8);
+  EXPECT_EQ(heaviest.sorted(), open_stl::vector<int>({9, 9, 8}));
+}
+
+TEST(top_k, fewer_values_than_k) {
+  open_stl::top_k<int> heaviest(5);
+  heaviest.push(4);
+  heaviest.push(2);
+  EXPECT_EQ(heaviest.size(), 2);
+  EXPECT_EQ(heaviest.sorted(), open_stl::vector<int>({4, 2}));
+}
+
+TEST(top_k, zero_capacity) {
+  open_stl::top_k<int> none(0);
+  none.push(1);
+  EXPECT_TRUE(none.empty());
+  EXPECT_TRUE(none.sorted().empty());
+}
+
+TEST(top_k, custom_comparator_keeps_smallest) {
+  auto greater = [](int lhs, int rhs) { return lhs > rhs; };
+  open_stl::top_k<int, decltype(greater)> fastest(2, greater);
+  for (int latency : {30, 12, 45, 8, 19}) {
+    fastest.push(latency);
+  }
+  EXPECT_EQ(fastest.sorted(), open_stl::vector<int>({8, 12}));
+}
+
+TEST(top_k, stream) {
+  open_stl::top_k<long> heaviest(10);
+  for (long i = 0; i < 100000; i++) {
+    heaviest.push((i * 7919) % 100003);
+  }
+  open_stl::vector<long> top = heaviest.sorted();
+  ASSERT_EQ(top.size(), 10);
+  for (std::size_t i = 1; i < top.size(); i++) {
+    EXPECT_GT(top[i - 1], top[i]);
+  }
+  long count_above = 0;
+  for (long i = 0; i < 100000; i++) {
+    if ((i * 7919) % 100003 >= top.back()) count_above++;
+  }
+  EXPECT_EQ(count_above, 10);
+}
+
+TEST(top_k, clear) {
+  open_stl::top_k<int> heaviest(2);
+  heaviest.push(1);
+  heaviest.clear();
+  EXPECT_TRUE(heaviest.empty());
+  heaviest.push(3);
+  EXPECT_EQ(heaviest.threshold(), 3);
+}
+
+int main(int argc, char **argv) {
+  // Initialize Google Test
+  ::testing::InitGoogleTest(&argc, argv);
+
+  // Run tests
+  return RUN_ALL_TESTS();
+}
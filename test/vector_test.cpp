@@ -614,6 +614,16 @@ TEST(vector, assignment_operator) {
     }
   }
 
+  // Test case for assigning over a non-empty vector
+  {
+    open_stl::vector<int> original = {1, 2, 3};
+    open_stl::vector<int> assigned = {9, 8, 7, 6, 5, 4};
+    assigned = original;
+    ASSERT_EQ(assigned, original);
+    assigned = assigned;
+    ASSERT_EQ(assigned.size(), 3);
+  }
+
   // Test case for move assigning a vector to another vector
   {
     open_stl::vector<int> original = {1, 2, 3, 4, 5};